@@ -0,0 +1,511 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *       Author:  Mahmoud Badr
+ *         File:  Boot.c
+ *        Layer:  App
+ *       Module:  Boot
+ *      Version:  1.00
+ *
+ *  Description:  Boot decision after reset, see Boot.h.
+ *                The EEPROM is only written when a new image passes its checks and on the first flash modifying
+ *                command after it, the RAM copy of the record saves every other write.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <stddef.h>
+#include "Boot.h"
+#include "Fls.h"
+#include "Crc32.h"
+#include "Prof.h"
+#include "Transport.h"
+#include "inc/hw_types.h"
+#include "inc/hw_nvic.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/systick.h"
+#include "driverlib/eeprom.h"
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+/*RAM copy of the EEPROM record, all 0 when the EEPROM didn't come up*/
+static uint32_t BOOT_Record[BOOT_RECORD_WORDS]={0};
+static bool BOOT_EepromReady=false;
+/*SYSCTL_CAUSE_* of the last reset, read once since the register is cleared*/
+static uint32_t BOOT_ResetCause=0U;
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/******************************************************************************
+ * \Syntax          : bool BOOT_ReadHeader(uint32_t Copy_Address,uint32_t* Copy_Header)
+ * \Description     : Read the image header at an address and check it on its own
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Address: Start of the image
+ * \Parameters (out): Copy_Header:  The BOOT_HEADER_WORDS words of the header
+ * \Return value:   : bool
+ *                    true - false (no header, or a torn one)
+ *******************************************************************************/
+static bool BOOT_ReadHeader(uint32_t Copy_Address,uint32_t* Copy_Header)
+{
+    bool Local_Valid=false;
+    uint8_t Local_Counter=0U;
+    if((Copy_Address>=BOOT_APP_MIN_ADDRESS) && ((Copy_Address+BOOT_HEADER_SIZE)<BOOT_APP_END_ADDRESS))
+    {
+        for(Local_Counter=0U;Local_Counter<BOOT_HEADER_WORDS;Local_Counter++)
+        {
+            Copy_Header[Local_Counter]=*((const volatile uint32_t*)FLS_MEMORY(Copy_Address+(4U*Local_Counter)));
+        }
+        /*The vector table right after the header sector, the image inside the flash*/
+        Local_Valid=(Copy_Header[BOOT_HEADER_MAGIC_W]==BOOT_HEADER_MAGIC) &&
+                    (Copy_Header[BOOT_HEADER_LOAD_W]==(Copy_Address+BOOT_HEADER_SIZE)) &&
+                    (Copy_Header[BOOT_HEADER_LENGTH_W]!=0U) &&
+                    (Copy_Header[BOOT_HEADER_LENGTH_W]<=(BOOT_APP_END_ADDRESS-Copy_Header[BOOT_HEADER_LOAD_W])) &&
+                    (CRC32_Calculate(FLS_MEMORY(Copy_Address), BOOT_HEADER_HCRC_W*4U)==Copy_Header[BOOT_HEADER_HCRC_W]);
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    return Local_Valid;
+}
+
+/******************************************************************************
+ * \Syntax          : uint32_t BOOT_CheckImage(uint32_t Copy_Address,bool Copy_FullCheck,uint32_t* Copy_Crc)
+ * \Description     : Check an image with or without header
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Address:   Image header, or vector table of an image without header
+ *                    Copy_FullCheck: true: calculate the CRC32 of the whole image, false: trust the header
+ * \Parameters (out): Copy_Crc:       Image CRC32 of the header, BOOT_RECORD_NO_HEADER without header
+ * \Return value:   : uint32_t
+ *                    The vector table of the application, 0 when the image failed the checks
+ *******************************************************************************/
+static uint32_t BOOT_CheckImage(uint32_t Copy_Address,bool Copy_FullCheck,uint32_t* Copy_Crc)
+{
+    uint32_t Local_Header[BOOT_HEADER_WORDS]={0};
+    uint32_t Local_Vectors=0U;
+    if(BOOT_ReadHeader(Copy_Address, Local_Header)==true)
+    {
+        *Copy_Crc=Local_Header[BOOT_HEADER_CRC_W];
+        /*About 8 cycles per byte with the slice by 8 engine, only once per programmed image*/
+        if((Copy_FullCheck==false) ||
+           (CRC32_Calculate(FLS_MEMORY(Local_Header[BOOT_HEADER_LOAD_W]), Local_Header[BOOT_HEADER_LENGTH_W])==Local_Header[BOOT_HEADER_CRC_W]))
+        {
+            Local_Vectors=Local_Header[BOOT_HEADER_LOAD_W];
+        }
+        else
+        {
+            /*Do Nothing*/
+        }
+    }
+    else
+    {
+        /*Image without header, nothing but its vector table to check*/
+        *Copy_Crc=BOOT_RECORD_NO_HEADER;
+        Local_Vectors=Copy_Address;
+    }
+    if((Local_Vectors!=0U) && (BOOT_IsAppSane(Local_Vectors)==false))
+    {
+        Local_Vectors=0U;
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    return Local_Vectors;
+}
+
+/******************************************************************************
+ * \Syntax          : void BOOT_StartApp(uint32_t Copy_StackPointer,uint32_t Copy_ResetHandler)
+ * \Description     : Load the main stack pointer and branch to the reset handler, never returns
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_StackPointer: Word 0 of the application vector table
+ *                    Copy_ResetHandler: Word 1 of the application vector table
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+#if defined(ccs)
+static void BOOT_StartApp(uint32_t Copy_StackPointer,uint32_t Copy_ResetHandler)
+{
+    /*The arguments are in R0 and R1, nothing of this frame is used after the stack moves*/
+    __asm("    msr     msp, r0\n"
+          "    bx      r1\n");
+}
+#else
+static void BOOT_StartApp(uint32_t Copy_StackPointer,uint32_t Copy_ResetHandler)
+{
+    /*Off target the host stack stays*/
+    ((void(*)(void))(uintptr_t)Copy_ResetHandler)();
+}
+#endif
+
+/******************************************************************************
+ * \Syntax          : bool BOOT_TakeMailbox(void)
+ * \Description     : Read and clear the update request of the application, open the host
+ *                    link it names, or every interface when that link can't be opened
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true: the bootloader stays for the update - false: no request
+ *******************************************************************************/
+static bool BOOT_TakeMailbox(void)
+{
+    bool Local_Update=false;
+    uint32_t Local_Action=HWREG(BOOT_MAILBOX_ACTION);
+    uint32_t Local_Link=HWREG(BOOT_MAILBOX_LINK);
+    uint32_t Local_BitRate=HWREG(BOOT_MAILBOX_BIT_RATE);
+    /*The SRAM holds random words after power up, only a reset the application made counts*/
+    Local_Update=(HWREG(BOOT_MAILBOX_MAGIC)==BOOT_MAILBOX_VALID) &&
+                 (HWREG(BOOT_MAILBOX_CHECK)==BOOT_MAILBOX_CHECK_OF(Local_Action, Local_Link, Local_BitRate)) &&
+                 (Local_Action==BOOT_ACTION_UPDATE) && ((BOOT_ResetCause & (SYSCTL_CAUSE_POR | SYSCTL_CAUSE_BOR))==0U);
+    /*One shot, a reset during the update gets back here through the cleared application record*/
+    HWREG(BOOT_MAILBOX_MAGIC)=0U;
+    if(Local_Update==true)
+    {
+        if((Local_Link==BOOT_ARGS_NO_LINK) ||
+           (TRANSPORT_Resume((TRANSPORT_Kind_t)((Local_Link>>8) & 0xFFU), (uint8_t)(Local_Link & 0xFFU), Local_BitRate)==NULL))
+        {
+            TRANSPORT_Init();
+        }
+        else
+        {
+            /*Do Nothing*/
+        }
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    return Local_Update;
+}
+
+/******************************************************************************
+ * \Syntax          : void BOOT_Autoboot(void)
+ * \Description     : Start the valid application or open the interfaces for the host,
+ *                    returns only when the bootloader has to stay
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BOOT_Autoboot(void)
+{
+    uint32_t Local_AppAddress=0U;
+    uint32_t Local_Header[BOOT_HEADER_WORDS]={0};
+#if BOOT_WAKE_WINDOW_MS!=0U
+    uint32_t Local_Counter=0U;
+#endif
+    bool Local_HostWake=false;
+#if BOOT_AUTOBOOT==BOOT_ON
+    Local_AppAddress=BOOT_GetAppAddress();
+    if((Local_AppAddress==0U) && (BOOT_ReadHeader(BOOT_HEADER_DEFAULT, Local_Header)==true))
+    {
+        /*Programmed but never started, the whole image is checked this once*/
+        Local_AppAddress=BOOT_HEADER_DEFAULT;
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    if(Local_AppAddress!=0U)
+    {
+        Local_AppAddress=BOOT_ValidateApp(Local_AppAddress);
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+#endif
+#if BOOT_WAKE_WINDOW_MS!=0U
+    TRANSPORT_Init();
+    /*The first byte or frame on any interface keeps the bootloader, it is then read as the first command*/
+    for(Local_Counter=0U;(Local_AppAddress!=0U) && (Local_HostWake==false) && (Local_Counter<BOOT_WAKE_WINDOW_MS);Local_Counter++)
+    {
+        if(TRANSPORT_Detect()!=NULL)
+        {
+            Local_HostWake=true;
+        }
+        else
+        {
+            /*1 ms, 3 cycles per loop*/
+            SysCtlDelay(SysCtlClockGet()/3000U);
+        }
+    }
+#endif
+    if((Local_AppAddress!=0U) && (Local_HostWake==false))
+    {
+        BOOT_Jump(Local_AppAddress);
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+#if BOOT_WAKE_WINDOW_MS==0U
+    TRANSPORT_Init();
+#endif
+}
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/******************************************************************************
+ * \Syntax          : void BOOT_Init(void)
+ * \Description     : Take the reset cause, enable the EEPROM and read the application record
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void BOOT_Init(void)
+{
+    BOOT_ResetCause=SysCtlResetCauseGet();
+    SysCtlResetCauseClear(BOOT_ResetCause);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_EEPROM0);
+    while(SysCtlPeripheralReady(SYSCTL_PERIPH_EEPROM0)==false)
+    {
+        /*Wait for the EEPROM clock*/
+    }
+    /*Also completes a program interrupted by a reset or a power loss*/
+    if(EEPROMInit()==EEPROM_INIT_OK)
+    {
+        BOOT_EepromReady=true;
+        EEPROMRead(BOOT_Record, BOOT_RECORD_ADDRESS, sizeof(BOOT_Record));
+    }
+    else
+    {
+        /*Do Nothing, the bootloader stays and waits for the host*/
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BOOT_Decide(void)
+ * \Description     : Start the valid application or open the interfaces for the host,
+ *                    returns only when the bootloader has to stay
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void BOOT_Decide(void)
+{
+    /*Already counting from the reset handler, started here too for the debugger resets that skip it*/
+    HWREG(PROF_DEMCR)|=PROF_DEMCR_TRCENA;
+    HWREG(PROF_DWT_CTRL)|=PROF_DWT_CTRL_CYCCNTENA;
+    BOOT_Init();
+    if(BOOT_TakeMailbox()==false)
+    {
+        BOOT_Autoboot();
+    }
+    else
+    {
+        /*Do Nothing, the application asked for the update, the host link is open*/
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : uint32_t BOOT_GetAppAddress(void)
+ * \Description     : Image of the record when its header and vector table still match it
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : uint32_t
+ *                    The image address (its header or its vector table), 0 without a valid record
+ *******************************************************************************/
+uint32_t BOOT_GetAppAddress(void)
+{
+    uint32_t Local_Address=0U;
+    uint32_t Local_Crc=0U;
+    if((BOOT_Record[0]==BOOT_RECORD_MAGIC) && (BOOT_Record[1]==~BOOT_Record[2]) &&
+       (BOOT_CheckImage(BOOT_Record[1], false, &Local_Crc)!=0U) && (Local_Crc==BOOT_Record[3]))
+    {
+        Local_Address=BOOT_Record[1];
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    return Local_Address;
+}
+
+/******************************************************************************
+ * \Syntax          : uint32_t BOOT_ValidateApp(uint32_t Copy_Address)
+ * \Description     : Check an image and record it to start after the next resets, the whole
+ *                    image CRC32 is only calculated when the record doesn't hold it yet
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Address: Image header, or vector table of an image without header
+ * \Parameters (out): None
+ * \Return value:   : uint32_t
+ *                    The vector table of the application, 0 when the image failed the checks
+ *******************************************************************************/
+uint32_t BOOT_ValidateApp(uint32_t Copy_Address)
+{
+    uint32_t Local_Vectors=0U;
+    uint32_t Local_Crc=0U;
+    if((Copy_Address!=0U) && (Copy_Address==BOOT_GetAppAddress()))
+    {
+        /*Verified when it was recorded and not modified since*/
+        Local_Vectors=BOOT_CheckImage(Copy_Address, false, &Local_Crc);
+    }
+    else
+    {
+        Local_Vectors=BOOT_CheckImage(Copy_Address, true, &Local_Crc);
+        if((Local_Vectors!=0U) && (BOOT_EepromReady==true))
+        {
+            /*A reset in between leaves the magic clear, the record is never half valid*/
+            BOOT_InvalidateApp();
+            BOOT_Record[1]=Copy_Address;
+            BOOT_Record[2]=~Copy_Address;
+            BOOT_Record[3]=Local_Crc;
+            EEPROMProgram(&BOOT_Record[1], BOOT_RECORD_ADDRESS+4U, 12U);
+            BOOT_Record[0]=BOOT_RECORD_MAGIC;
+            EEPROMProgram(&BOOT_Record[0], BOOT_RECORD_ADDRESS, 4U);
+        }
+        else
+        {
+            /*Do Nothing*/
+        }
+    }
+    return Local_Vectors;
+}
+
+/******************************************************************************
+ * \Syntax          : void BOOT_InvalidateApp(void)
+ * \Description     : Clear the application record before the flash is modified,
+ *                    nothing is written when it is already clear
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void BOOT_InvalidateApp(void)
+{
+    if((BOOT_EepromReady==true) && (BOOT_Record[0]!=0U))
+    {
+        BOOT_Record[0]=0U;
+        EEPROMProgram(&BOOT_Record[0], BOOT_RECORD_ADDRESS, 4U);
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : bool BOOT_IsAppSane(uint32_t Copy_Address)
+ * \Description     : Check the initial stack pointer and the reset handler of a vector table
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Address: Vector table of the application
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false
+ *******************************************************************************/
+bool BOOT_IsAppSane(uint32_t Copy_Address)
+{
+    bool Local_Sane=false;
+    uint32_t Local_StackPointer=0U;
+    uint32_t Local_ResetHandler=0U;
+    /*VTOR needs a 1 KB aligned table for the 155 vectors of the TM4C123*/
+    if((Copy_Address>=BOOT_APP_MIN_ADDRESS) && (Copy_Address<BOOT_APP_END_ADDRESS) && ((Copy_Address & 0x3FFUL)==0U))
+    {
+        Local_StackPointer=*((const volatile uint32_t*)FLS_MEMORY(Copy_Address));
+        Local_ResetHandler=*((const volatile uint32_t*)FLS_MEMORY(Copy_Address+4U));
+        /*Erased flash reads 0xFFFFFFFF and fails both, the handler is Thumb code inside the application flash*/
+        Local_Sane=(Local_StackPointer>BOOT_SRAM_START) && (Local_StackPointer<=BOOT_SRAM_END) && ((Local_StackPointer & 7U)==0U) &&
+                   ((Local_ResetHandler & 1U)!=0U) && ((Local_ResetHandler & ~1UL)>Copy_Address) && (Local_ResetHandler<BOOT_APP_END_ADDRESS);
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    return Local_Sane;
+}
+
+/******************************************************************************
+ * \Syntax          : void BOOT_Jump(uint32_t Copy_Address)
+ * \Description     : Leave the interrupts as after reset and start the application
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Address: Vector table of the application
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void BOOT_Jump(uint32_t Copy_Address)
+{
+    uint32_t Local_StackPointer=0U;
+    uint32_t Local_ResetHandler=0U;
+    uint8_t Local_Counter=0U;
+#if BOOT_ARGS==BOOT_ON
+    const TRANSPORT_t* Local_Link=TRANSPORT_GetActive();
+    HWREG(BOOT_ARGS_RESET_CAUSE)=BOOT_ResetCause;
+    if(Local_Link!=NULL)
+    {
+        HWREG(BOOT_ARGS_LINK)=((uint32_t)Local_Link->Ops->Kind<<8) | Local_Link->Channel;
+        HWREG(BOOT_ARGS_BIT_RATE)=TRANSPORT_GetBitRate(Local_Link);
+    }
+    else
+    {
+        HWREG(BOOT_ARGS_LINK)=BOOT_ARGS_NO_LINK;
+        HWREG(BOOT_ARGS_BIT_RATE)=0U;
+    }
+    HWREG(BOOT_ARGS_MAGIC)=BOOT_ARGS_VALID;
+#else
+    HWREG(BOOT_ARGS_MAGIC)=0U;
+#endif
+    /*The reply to the host leaves first, the interrupts still drain the transmit ring*/
+    TRANSPORT_DeInit();
+    SysCtlPeripheralReset(SYSCTL_PERIPH_EEPROM0);
+    SysCtlPeripheralDisable(SYSCTL_PERIPH_EEPROM0);
+    /*No interrupt of the bootloader may reach the vector table of the application*/
+    IntMasterDisable();
+    SysTickIntDisable();
+    SysTickDisable();
+    for(Local_Counter=0U;Local_Counter<BOOT_NVIC_REGS;Local_Counter++)
+    {
+        HWREG(NVIC_DIS0+(4U*Local_Counter))=0xFFFFFFFFUL;
+        HWREG(NVIC_UNPEND0+(4U*Local_Counter))=0xFFFFFFFFUL;
+    }
+    HWREG(NVIC_INT_CTRL)=NVIC_INT_CTRL_PENDSTCLR | NVIC_INT_CTRL_UNPEND_SV;
+    /*Move the Vector table to the start of application*/
+    HWREG(NVIC_VTABLE)=Copy_Address;
+    /*Initial stack pointer and reset handler, the first two words of the vector table*/
+    Local_StackPointer=*((const volatile uint32_t*)FLS_MEMORY(Copy_Address));
+    Local_ResetHandler=*((const volatile uint32_t*)FLS_MEMORY(Copy_Address+4U));
+    HWREG(BOOT_HANDOFF_CYCLES)=HWREG(PROF_DWT_CYCCNT);
+    HWREG(BOOT_HANDOFF_CLOCK)=SysCtlClockGet();
+    /*PRIMASK clear as after reset, nothing is left enabled or pending*/
+    IntMasterEnable();
+    BOOT_StartApp(Local_StackPointer, Local_ResetHandler);
+}
+/**********************************************************************************************************************
+ *  END OF FILE: Boot.c
+ *********************************************************************************************************************/
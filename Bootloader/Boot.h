@@ -0,0 +1,212 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *       Author:  Mahmoud Badr
+ *         File:  Boot.h
+ *        Layer:  App
+ *       Module:  Boot
+ *      Version:  1.00
+ *
+ *  Description:  Boot decision after reset. The image the host started last is kept in a record of the internal
+ *                EEPROM once it passed the checks: the CRC32 of the whole image for an image with a header, the
+ *                vector table only without it. Any flash modifying command clears the record first. With a
+ *                record the following resets only check the header against it and the vector table, then start
+ *                the application at once or after BOOT_WAKE_WINDOW_MS without a byte or frame of the host on any
+ *                interface. The jump leaves the interfaces, the EEPROM and the NVIC as after reset and loads the stack
+ *                pointer of the application vector table. The DWT cycles from reset to the jump and the boot
+ *                arguments (clock, host link and its rate, reset cause) are left in the reserved RAM for the application.
+ *                The application asks for an update through a mailbox in the same RAM and a software reset.
+ *
+ *********************************************************************************************************************/
+
+#ifndef BOOT_H_
+#define BOOT_H_
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+#define BOOT_OFF                0x00
+#define BOOT_ON                 0x01
+
+/* Start the valid application after reset, BOOT_OFF: stay in the bootloader until BL_JUMP_TO_USER_APP */
+#ifndef BOOT_AUTOBOOT
+#define BOOT_AUTOBOOT           BOOT_ON
+#endif
+
+/* Time the interfaces listen for the host before the valid application starts,
+ * 0: jump without opening any interface, the host then needs the application to get back here */
+#ifndef BOOT_WAKE_WINDOW_MS
+#define BOOT_WAKE_WINDOW_MS     20U
+#endif
+
+/* Leave the boot arguments to the application, BOOT_OFF: BOOT_ARGS_MAGIC is cleared instead */
+#ifndef BOOT_ARGS
+#define BOOT_ARGS               BOOT_ON
+#endif
+
+/* EEPROM record of the verified image [Magic][Image address][~Image address][Image CRC32], the magic is written
+ * last. The image CRC32 is the one of its header, or BOOT_RECORD_NO_HEADER for an image without header */
+#define BOOT_RECORD_ADDRESS     0x0000U
+#define BOOT_RECORD_WORDS       4U
+#define BOOT_RECORD_MAGIC       0x424F4F54UL
+#define BOOT_RECORD_NO_HEADER   0x00000000UL
+
+/* Image header, stamped by Host.py in front of the application: one flash sector, the vector table follows it
+ * (VTOR needs 1 KB alignment). Little endian words [Magic][Load address][Length][CRC32][Version][Header CRC32],
+ * the CRC32 covers the Length bytes from the load address, the header CRC32 the 5 words before it */
+#define BOOT_HEADER_SIZE        0x400U
+#define BOOT_HEADER_MAGIC       0x48494C42UL
+#define BOOT_HEADER_WORDS       6U
+#define BOOT_HEADER_MAGIC_W     0U
+#define BOOT_HEADER_LOAD_W      1U
+#define BOOT_HEADER_LENGTH_W    2U
+#define BOOT_HEADER_CRC_W       3U
+#define BOOT_HEADER_VERSION_W   4U
+#define BOOT_HEADER_HCRC_W      5U
+/* Header checked after a reset without record, an image programmed there starts without BL_JUMP_TO_USER_APP */
+#define BOOT_HEADER_DEFAULT     0x00008000UL
+
+/* Top of the SRAM, out of the bootloader linker file, the application must not place anything there either */
+#define BOOT_SHARED_ADDRESS     0x20007FC0UL
+#define BOOT_SHARED_SIZE        0x40U
+/* DWT cycles from reset to the jump and the CPU clock they were counted at, written before every jump */
+#define BOOT_HANDOFF_CYCLES     (BOOT_SHARED_ADDRESS+0x00U)
+#define BOOT_HANDOFF_CLOCK      (BOOT_SHARED_ADDRESS+0x04U)
+/* Boot arguments, only valid with BOOT_ARGS_VALID in BOOT_ARGS_MAGIC. The link is [Kind << 8][Channel]
+ * (TRANSPORT_Kind_t, UART_t / CAN_t) of the host link, BOOT_ARGS_NO_LINK when the host didn't talk, its
+ * bit rate is the one negotiated with BL_SET_BAUD. The reset cause is SYSCTL_CAUSE_* of the last reset,
+ * the bootloader clears the register. The application reopens the link itself, it is reset before the jump */
+#define BOOT_ARGS_MAGIC         (BOOT_SHARED_ADDRESS+0x08U)
+#define BOOT_ARGS_RESET_CAUSE   (BOOT_SHARED_ADDRESS+0x0CU)
+#define BOOT_ARGS_LINK          (BOOT_SHARED_ADDRESS+0x10U)
+#define BOOT_ARGS_BIT_RATE      (BOOT_SHARED_ADDRESS+0x14U)
+#define BOOT_ARGS_VALID         0x41524753UL
+#define BOOT_ARGS_NO_LINK       0xFFFFFFFFUL
+/* Update request of the application, read and cleared by the bootloader at the next reset but a power on or
+ * brown out one. The application writes the action, the host link in the BOOT_ARGS_LINK encoding, its bit rate
+ * (0: the default rate) and the check word, then the magic, and resets with SysCtlReset. The bootloader then
+ * neither starts the application nor waits for a wake byte: it opens only that link at that rate and takes
+ * the host commands on it. With BOOT_ARGS_NO_LINK every interface listens as after a reset without record */
+#define BOOT_MAILBOX_MAGIC      (BOOT_SHARED_ADDRESS+0x20U)
+#define BOOT_MAILBOX_ACTION     (BOOT_SHARED_ADDRESS+0x24U)
+#define BOOT_MAILBOX_LINK       (BOOT_SHARED_ADDRESS+0x28U)
+#define BOOT_MAILBOX_BIT_RATE   (BOOT_SHARED_ADDRESS+0x2CU)
+#define BOOT_MAILBOX_CHECK      (BOOT_SHARED_ADDRESS+0x30U)
+#define BOOT_MAILBOX_VALID      0x55504454UL
+#define BOOT_ACTION_UPDATE      0x00000001UL
+#define BOOT_MAILBOX_CHECK_OF(Action,Link,BitRate)  (~((uint32_t)(Action)^(uint32_t)(Link)^(uint32_t)(BitRate)))
+
+/* Flash of the bootloader, an application vector table is above it */
+#define BOOT_APP_MIN_ADDRESS    0x00008000UL
+#define BOOT_APP_END_ADDRESS    0x00040000UL
+#define BOOT_SRAM_START         0x20000000UL
+#define BOOT_SRAM_END           0x20008000UL
+
+/* NVIC enable / pending registers of the 139 interrupts */
+#define BOOT_NVIC_REGS          5U
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+/******************************************************************************
+ * \Syntax          : void BOOT_Init(void)
+ * \Description     : Take the reset cause, enable the EEPROM and read the application record
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void BOOT_Init(void);
+
+/******************************************************************************
+ * \Syntax          : void BOOT_Decide(void)
+ * \Description     : Take the update request of the application, otherwise start the valid
+ *                    application or open the interfaces for the host, returns only when the
+ *                    bootloader has to stay
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void BOOT_Decide(void);
+
+/******************************************************************************
+ * \Syntax          : uint32_t BOOT_GetAppAddress(void)
+ * \Description     : Image of the record when its header and vector table still match it
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : uint32_t
+ *                    The image address (its header or its vector table), 0 without a valid record
+ *******************************************************************************/
+uint32_t BOOT_GetAppAddress(void);
+
+/******************************************************************************
+ * \Syntax          : uint32_t BOOT_ValidateApp(uint32_t Copy_Address)
+ * \Description     : Check an image and record it to start after the next resets, the whole
+ *                    image CRC32 is only calculated when the record doesn't hold it yet
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Address: Image header, or vector table of an image without header
+ * \Parameters (out): None
+ * \Return value:   : uint32_t
+ *                    The vector table of the application, 0 when the image failed the checks
+ *******************************************************************************/
+uint32_t BOOT_ValidateApp(uint32_t Copy_Address);
+
+/******************************************************************************
+ * \Syntax          : void BOOT_InvalidateApp(void)
+ * \Description     : Clear the application record before the flash is modified,
+ *                    nothing is written when it is already clear
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void BOOT_InvalidateApp(void);
+
+/******************************************************************************
+ * \Syntax          : bool BOOT_IsAppSane(uint32_t Copy_Address)
+ * \Description     : Check the initial stack pointer and the reset handler of a vector table
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Address: Vector table of the application
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false
+ *******************************************************************************/
+bool BOOT_IsAppSane(uint32_t Copy_Address);
+
+/******************************************************************************
+ * \Syntax          : void BOOT_Jump(uint32_t Copy_Address)
+ * \Description     : Leave the boot arguments, wait for the last reply to the host, reset the
+ *                    interfaces and the interrupts, then start the application on its own stack
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Address: Vector table of the application
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void BOOT_Jump(uint32_t Copy_Address);
+
+#endif
+/**********************************************************************************************************************
+ *  END OF FILE: Boot.h
+ *********************************************************************************************************************/
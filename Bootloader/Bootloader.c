@@ -15,28 +15,28 @@
  *  INCLUDES
  *********************************************************************************************************************/
 #include "Uart.h"
+#include "Can.h"
+#include "Transport.h"
 #include "Bootloader.h"
+#include "Crc32.h"
+#include "Fls.h"
+#include "Lz4Dec.h"
+#include "Prof.h"
+#include "Boot.h"
+#include "inc/hw_types.h"
+#include "inc/hw_sysctl.h"
+#include "inc/hw_nvic.h"
 #include "driverlib/flash.h"
 #include "driverlib/can.h"
 
 /**********************************************************************************************************************
- *  LOCAL DATA
- *********************************************************************************************************************/
-static uint8_t BL_HostBuffer[BL_HOST_BUFFER_SIZE]={0};
-static uint8_t BL_Command=0U;
-static uint32_t BL_AppAddress=0U;
-static uint8_t BL_AddFlag=0U;
-static void(*APP_ResetHandler)(void)=NULL;
-static void(*BL_FuncPtrArr[])(void)={BL_GetVersion,BL_GetHelp,BL_GetChipID,BL_ReadProtectLevel,BL_GoToAdd,BL_EraseFlash,BL_WriteMem,
-                                     BL_SetWriteProtoect,BL_ReadMem,BL_GetWriteProtoectState,BL_ReadOTP,BL_SetProtectLevel,BL_JUmpToUserAppCmd};
-
-/**********************************************************************************************************************
- *  LOCAL FUNCTIONS
+ *  LOCAL FUNCTION PROTOTYPES
  *********************************************************************************************************************/
 
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
 /******************************************************************************
  * \Syntax          : void BL_PrintMesssage(char *Copy_Format,...)
- * \Description     : Variatic Function used to send Messages to debug port
+ * \Description     : Variatic Function used to send Messages to the host link
  *
  * \Sync\Async      : Synchronous
  * \Reentrancy      : Non Reentrant
@@ -44,26 +44,11 @@ static void(*BL_FuncPtrArr[])(void)={BL_GetVersion,BL_GetHelp,BL_GetChipID,BL_Re
  * \Parameters (out): None
  * \Return value:   : void
  *******************************************************************************/
-static void BL_PrintMesssage(char *Copy_Format,...)
-{
-    char Local_Message[100]={0};
-    va_list List;
-    /*Enables Access to variable Arguments*/
-    va_start(List, Copy_Format);
-    /*Write Formatted Data from from variable argument list to string*/
-    vsprintf(Local_Message,Copy_Format,List);
-#if BL_DEBUG_METHODE==BL_UART_DEBUG
-    /*Transmit the formatted data throw Your Method*/
-    UART_SendBytes(BL_DEBUG_UART, (uint8_t*)Local_Message, sizeof(Local_Message));
-#elif BL_DEBUG_METHODE==BL_CAN_DUBUG
-
+static void BL_PrintMesssage(char *Copy_Format,...);
 #endif
-    /*Performs cleanup for an ap object initialized by a call to va_start*/
-    va_end(List);
-}
 
 /************************************************************************************************
- * \Syntax          : void BL_SendDataToHost(uint8_t* Copy_HostBuffer,uint8_t Copy_DataLen)
+ * \Syntax          : void BL_SendDataToHost(uint8_t* Copy_HostBuffer,uint16_t Copy_DataLen)
  * \Description     : Send Data to Host
  *
  * \Sync\Async      : Synchronous
@@ -73,18 +58,10 @@ static void BL_PrintMesssage(char *Copy_Format,...)
  * \Parameters (out): None
  * \Return value:   : void
  ************************************************************************************************/
-static void BL_SendDataToHost(uint8_t* Copy_HostBuffer,uint8_t Copy_DataLen)
-{
-    /*Choose the Communication Protocol Between bootloader and Host*/
-#if BL_COMM_PROTOCOL==BL_UART_COMM
-    UART_SendBytes(BL_COMM_METHODE, Copy_HostBuffer, Copy_DataLen);
-#elif BL_COMM_PROTOCOL==BL_CAN_COMM
-
-#endif
-}
+static void BL_SendDataToHost(uint8_t* Copy_HostBuffer,uint16_t Copy_DataLen);
 
 /************************************************************************************************
- * \Syntax          : void BL_ReceiveDataFromHost(uint8_t* Copy_HostBuffer,uint8_t Copy_DataLen)
+ * \Syntax          : void BL_ReceiveDataFromHost(uint8_t* Copy_HostBuffer,uint16_t Copy_DataLen)
  * \Description     : Send Data to Host
  *
  * \Sync\Async      : Synchronous
@@ -94,78 +71,22 @@ static void BL_SendDataToHost(uint8_t* Copy_HostBuffer,uint8_t Copy_DataLen)
  * \Parameters (out): None
  * \Return value:   : void
  ************************************************************************************************/
-static void BL_ReceiveDataFromHost(uint8_t* Copy_HostBuffer,uint8_t Copy_DataLen)
-{
-    /*Choose the Communication Protocol Between bootloader and Host*/
-#if BL_COMM_PROTOCOL==BL_UART_COMM
-    UART_ReceiveBytes(BL_COMM_METHODE, Copy_HostBuffer, Copy_DataLen);
-#elif BL_COMM_PROTOCOL==BL_CAN_COMM
-
-#endif
-}
+static void BL_ReceiveDataFromHost(uint8_t* Copy_HostBuffer,uint16_t Copy_DataLen);
 
 /********************************************************************************************************
- * \Syntax          : bool BL_PerformFlashErase(uint8_t Copy_FirstSector,uint8_t Copy_NumofSectors)
- * \Description     : Erase Number of Sectors from Flash memory
+ * \Syntax          : bool BL_PerformFlashErase(uint16_t Copy_FirstSector,uint16_t Copy_NumofSectors,uint8_t* Copy_Results)
+ * \Description     : Erase Number of Sectors from Flash memory, sectors that are already blank are skipped
  *
  * \Sync\Async      : Synchronous
  * \Reentrancy      : Non Reentrant
  * \Parameters (in) : Copy_FirstSector:  The sector start erasing from
  *                    Copy_NumofSectors: Number of Sectors to be Erased
- * \Parameters (out): None
+ * \Parameters (out): Copy_Results:      BL_SECTOR_ERASED - BL_SECTOR_BLANK - BL_SECTOR_FAILED - BL_SECTOR_PROTECTED
+ *                                       of every sector, packed 4 per byte
  * \Return value:   : bool
  *                    true - false
  **********************************************************************************************************/
-static bool BL_PerformFlashErase(uint8_t Copy_FirstSector,uint8_t Copy_NumofSectors)
-{
-    bool Local_EraseState=false;
-    uint32_t Local_SectorStart=0;
-    uint32_t Local_SectorState=0;
-    uint8_t Local_Counter=0;
-    /*Make Sure that the user wants to Erase total number of sector <= Available Sectors*/
-    if((BL_FLASH_SECTORS_NUM > (uint8_t)(Copy_NumofSectors-Copy_FirstSector)) || (Copy_FirstSector == BL_MASS_ERASE))
-    {
-        Local_EraseState=true;
-        /*Check if the user wants a mass Erase*/
-        if(Copy_FirstSector == BL_MASS_ERASE)
-        {
-            Local_Counter=0;
-            Copy_NumofSectors=255;
-            Copy_FirstSector=0;
-        }
-        else
-        {
-            Local_Counter=Copy_FirstSector;
-        }
-        for( ;Local_Counter<(Copy_NumofSectors+Copy_FirstSector);Local_Counter++)
-        {
-            /*Calculate the Sector Start Address*/
-            Local_SectorStart=FLASH_START_ADDRESS+(Local_Counter*FLASH_SECTOR_SIZE);
-            /*Erase the sectors*/
-            Local_SectorState=FlashErase(Local_SectorStart);
-            if(Local_SectorState==0)
-            {
-#if BL_DUBUG_STATUS==BL_DUBUG_ON
-                BL_PrintMesssage("Successful Erase to Sectors From %d to %d\r\n",Copy_FirstSector,Copy_NumofSectors+Copy_FirstSector);
-#endif
-                Local_EraseState=true;
-            }
-            else
-            {
-#if BL_DUBUG_STATUS==BL_DUBUG_ON
-                BL_PrintMesssage("Failed to Erase Memory\r\n");
-#endif
-                Local_EraseState=false;
-                break;
-            }
-        }
-    }
-    else
-    {
-        /*Do Nothing*/
-    }
-    return Local_EraseState;
-}
+static bool BL_PerformFlashErase(uint16_t Copy_FirstSector,uint16_t Copy_NumofSectors,uint8_t* Copy_Results);
 
 /******************************************************************************
  * \Syntax          : uint8_t BL_RDPHelper(void)
@@ -178,13 +99,7 @@ static bool BL_PerformFlashErase(uint8_t Copy_FirstSector,uint8_t Copy_NumofSect
  * \Return value:   : uint8_t
  *                    The Read Protection Level
  *******************************************************************************/
-static uint8_t BL_RDPHelper(void)
-{
-    tFlashProtection Local_ProtectLevel;
-    /*Get the Protection Level*/
-    Local_ProtectLevel=FlashProtectGet(FLASH_BASE);
-    return Local_ProtectLevel;
-}
+static uint8_t BL_RDPHelper(void);
 
 /************************************************************************************
  * \Syntax          : bool BL_ProgramRDPHelper(uint8_t Copy_PL)
@@ -197,88 +112,36 @@ static uint8_t BL_RDPHelper(void)
  * \Return value:   : bool
  *                    true - false
  ************************************************************************************/
-static bool BL_ProgramRDPHelper(uint8_t Copy_PL)
-{
-    bool Local_ReadStatus=false;
-    int32_t Local_Status;
-    /*Set the flash protect*/
-    Local_Status=FlashProtectSet(FLASH_BASE,(tFlashProtection) Copy_PL);
-    /*Make sure the protect level changed successfully*/
-    if(Local_Status==0)
-    {
-        Local_ReadStatus=true;
-    }
-    else
-    {
-        /*Do Nothing*/
-    }
-    return Local_ReadStatus;
-}
+static bool BL_ProgramRDPHelper(uint8_t Copy_PL);
 
 /**************************************************************************************************************************
- * \Syntax          : bool BL_PerformFlashWrite(uint8_t* Copy_HostPayload,uint32_t Copy_StartAddress,uint8_t Copy_DataLen)
- * \Description     : Perform the write operation on flash
+ * \Syntax          : bool BL_PerformFlashWrite(uint8_t* Copy_HostPayload,uint32_t Copy_StartAddress,uint16_t Copy_DataLen)
+ * \Description     : Collect a write in the coalescing buffer, every write buffer block it completes is programmed
  *
  * \Sync\Async      : Synchronous
  * \Reentrancy      : Non Reentrant
- * \Parameters (in) : Copy_Address Address to be verified
+ * \Parameters (in) : Copy_HostPayload:  Data to be written
+ *                    Copy_StartAddress: Flash address of the data
+ *                    Copy_DataLen:      Data length, any alignment
  * \Parameters (out): None
  * \Return value:   : bool
- *                    true - false
+ *                    true - false (this write or a block left by the previous writes of the sequence failed)
  **************************************************************************************************************************/
-static bool BL_PerformFlashWrite(uint8_t* Copy_HostPayload,uint32_t Copy_StartAddress,uint8_t Copy_DataLen)
-{
-    bool Local_WriteState=false;
-    int32_t Local_Status=1;
-    /*Make a pointer points to every 4 bits*/
-    uint32_t *Local_Dataptr=((uint32_t*)Copy_HostPayload);
-    /*Make Data multiple of four*/
-    uint16_t Local_Number=Copy_DataLen%4;
-    Local_Number+=Copy_DataLen;
-    /*Make sure that flash writing done successfully*/
-    Local_Status=FlashProgram(Local_Dataptr,Copy_StartAddress,(uint32_t)Local_Number);
-    if(Local_Status==0)
-    {
-        Local_WriteState=true;
-    }
-    return Local_WriteState;
-}
+static bool BL_PerformFlashWrite(uint8_t* Copy_HostPayload,uint32_t Copy_StartAddress,uint16_t Copy_DataLen);
 
 /******************************************************************************
- * \Syntax          : uint32_t Calculate_CRC32(const uint8_t *Buffer, uint8_t Buffer_Length)
- * \Description     : Calculate the CRC for Data Sent From Host
+ * \Syntax          : bool BL_CoalesceFlush(void)
+ * \Description     : Program the collected write buffer block in one burst,
+ *                    the bytes no write touched stay 0xFF
  *
  * \Sync\Async      : Synchronous
  * \Reentrancy      : Non Reentrant
- * \Parameters (in) : Buffer:        Data to Calculate the CRC for
- *                    Buffer_Length: Data Length
+ * \Parameters (in) : None
  * \Parameters (out): None
- * \Return value:   : uint32_t
- *                    The Calculated CRC
+ * \Return value:   : bool
+ *                    true - false
  *******************************************************************************/
-static uint32_t Calculate_CRC32(const uint8_t *Buffer, uint8_t Buffer_Length)
-{
-    uint32_t CRC_Value = 0xFFFFFFFF;
-    uint8_t i=0;
-    uint8_t j=0;
-    /*Calculate CRC with our Generator*/
-    for (i = 0; i < Buffer_Length; ++i)
-    {
-        CRC_Value = CRC_Value ^ Buffer[i];
-        for (j = 0; j < 32; ++j)
-        {
-            if (CRC_Value & 0x80000000)
-            {
-                CRC_Value = (CRC_Value << 1) ^ 0x04C11DB7;
-            }
-            else
-            {
-                CRC_Value = (CRC_Value << 1);
-            }
-        }
-    }
-    return CRC_Value;
-}
+static bool BL_CoalesceFlush(void);
 
 /******************************************************************************
  * \Syntax          : bool BL_CRCCheck(void)
@@ -291,30 +154,35 @@ static uint32_t Calculate_CRC32(const uint8_t *Buffer, uint8_t Buffer_Length)
  * \Return value:   : bool
  *                    true - false
  *******************************************************************************/
-static bool BL_CRCCheck(void)
-{
-    bool Local_CRCState=false;
-    uint8_t Local_DataLen=BL_HostBuffer[0]+1U;
-    /*Get the host CRC from the sent Packet*/
-    uint32_t Local_HostCRC=*((uint32_t*)((BL_HostBuffer+Local_DataLen)-BL_CRC_LEN));
-    uint32_t Local_CalculatedCRC=0;
-    /*CRC Verification*/
-    Local_CalculatedCRC=Calculate_CRC32(BL_HostBuffer, (Local_DataLen-BL_CRC_LEN));
-    if(Local_CalculatedCRC == Local_HostCRC)
-    {
-        Local_CRCState=true;
-#if BL_DUBUG_STATUS==BL_DUBUG_ON
-        BL_PrintMesssage("CRC Verification Passed\r\n");
-#endif
-    }
-    else
-    {
-#if BL_DUBUG_STATUS==BL_DUBUG_ON
-        BL_PrintMesssage("CRC Verification Failed");
-#endif
-    }
-    return Local_CRCState;
-}
+static bool BL_CRCCheck(void);
+
+/******************************************************************************
+ * \Syntax          : uint16_t BL_PayloadLength(uint8_t Copy_HeaderLen)
+ * \Description     : Get the payload length of the current frame from its
+ *                    frame length, the 8-bit length field of the write commands
+ *                    can't describe the payload of an extended frame
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_HeaderLen: Bytes from the command to the payload
+ * \Parameters (out): None
+ * \Return value:   : uint16_t
+ *                    The Payload Length
+ *******************************************************************************/
+static uint16_t BL_PayloadLength(uint8_t Copy_HeaderLen);
+
+/******************************************************************************
+ * \Syntax          : void BL_DiscardFromHost(uint16_t Copy_DataLen)
+ * \Description     : Drop a frame that doesn't fit the host buffer to keep
+ *                    the link in sync
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_DataLen: Number of bytes to be dropped
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_DiscardFromHost(uint16_t Copy_DataLen);
 
 /*************************************************************************************************
  * \Syntax          : void BL_SendACK(uint8_t Copy_ReplyLen)
@@ -326,14 +194,7 @@ static bool BL_CRCCheck(void)
  * \Parameters (out): None
  * \Return value:   : void
  *************************************************************************************************/
-static void BL_SendACK(uint8_t Copy_ReplyLen)
-{
-    uint8_t Local_AckVal[2]={0};
-    Local_AckVal[0]=BL_ACK;
-    Local_AckVal[1]=Copy_ReplyLen;
-    /*Send ACK + Length to Flow to Host*/
-    BL_SendDataToHost(Local_AckVal, 2U);
-}
+static void BL_SendACK(uint8_t Copy_ReplyLen);
 
 /******************************************************************************
  * \Syntax          : void BL_SendNACK(void)
@@ -345,12 +206,7 @@ static void BL_SendACK(uint8_t Copy_ReplyLen)
  * \Parameters (out): None
  * \Return value:   : void
  *******************************************************************************/
-static void BL_SendNACK(void)
-{
-    uint8_t Local_NACKVal=BL_NACK;
-    /*Send Not ACK*/
-    BL_SendDataToHost(&Local_NACKVal, 1U);
-}
+static void BL_SendNACK(void);
 
 /******************************************************************************
  * \Syntax          : bool BL_AddressVerification(uint32_t Copy_Address)
@@ -363,50 +219,19 @@ static void BL_SendNACK(void)
  * \Return value:   : bool
  *                    true - false
  *******************************************************************************/
-static bool BL_AddressVerification(uint32_t Copy_Address)
-{
-    bool Local_AddState=false;
-    /*Check if Address is inside the flash range or not*/
-    if(((int32_t)Copy_Address>=FLASH_START_ADDRESS) && (Copy_Address<=FLASH_END_ADDRESS))
-    {
-        Local_AddState=true;
-    }
-    /*Check if Address is inside the SRAM range or not*/
-    else if((Copy_Address>=SRAM_START_ADDRESS) && (Copy_Address<=SRAM_END_ADDRESS))
-    {
-        Local_AddState=true;
-    }
-    else
-    {
-        /* Do Nothing */
-    }
-    return Local_AddState;
-}
+static bool BL_AddressVerification(uint32_t Copy_Address);
 
 /******************************************************************************
- * \Syntax          : void BL_JumpToUserAPP(void)
- * \Description     : Send the Bootloader version to host
+ * \Syntax          : void BL_JumpToUserAPP(uint32_t Copy_AppVectors)
+ * \Description     : Start the application checked by BOOT_ValidateApp
  *
  * \Sync\Async      : Synchronous
  * \Reentrancy      : Non Reentrant
- * \Parameters (in) : None
+ * \Parameters (in) : Copy_AppVectors: Vector table of the application
  * \Parameters (out): None
  * \Return value:   : void
  *******************************************************************************/
-static void BL_JumpToUserAPP(void)
-{
-    uint32_t Local_ResetHandlerAddress=*((volatile uint32_t*)(BL_AppAddress+4U));
-    /*Move the Vector table to the start of application*/
-    VTABLE_REG=BL_AppAddress;
-    /*Pass the Reset Handler Address to pointer to function*/
-    APP_ResetHandler=(void*)Local_ResetHandlerAddress;
-    /*Initialize Stack Pointer*/
-    __asm volatile("        MOV      R12,#0x0200");
-    __asm volatile("        MOVT     R12,#0x2000");
-    __asm volatile("        MSR      MSP,R12");
-    /*Jump to Reset handler Address*/
-    APP_ResetHandler();
-}
+static void BL_JumpToUserAPP(uint32_t Copy_AppVectors);
 
 /******************************************************************************
  * \Syntax          : void BL_GetVersion(void)
@@ -418,24 +243,7 @@ static void BL_JumpToUserAPP(void)
  * \Parameters (out): None
  * \Return value:   : void
  *******************************************************************************/
-static void BL_GetVersion(void)
-{
-    uint8_t Local_BLVersion[]={BL_VENDOR_ID,BL_SW_MAJOR_VERSION,BL_SW_MANOR_VERSION,BL_SW_PATCH_VERSION};
-    if(BL_CRCCheck()==true)
-    {
-        /*Send ACK with 4 bytes as remaining length*/
-        BL_SendACK(4U);
-        /*Send the Version Info to Host*/
-        BL_SendDataToHost(Local_BLVersion,4U);
-#if BL_DUBUG_STATUS==BL_DUBUG_ON
-        BL_PrintMesssage("Read the Bootloader version %d. %d. %d\r\n",Local_BLVersion[1],Local_BLVersion[2],Local_BLVersion[3]);
-#endif
-    }
-    else
-    {
-        BL_SendNACK();
-    }
-}
+static void BL_GetVersion(void);
 
 /******************************************************************************
  * \Syntax          : void BL_GetHelp(void)
@@ -447,25 +255,7 @@ static void BL_GetVersion(void)
  * \Parameters (out): None
  * \Return value:   : void
  *******************************************************************************/
-static void BL_GetHelp(void)
-{
-    uint8_t Local_BLCMD[]={BL_GET_VER,BL_GET_HELP,BL_GET_CID,BL_GET_RDP_LEVEL,BL_GO_TO_ADDR,BL_ERASE_FLASH,BL_WRITE_MEM,BL_ENABLE_DISABLE_WRP,BL_READ_MEM
-                           ,BL_GET_WRP_STATUS,BL_READ_OTP,BL_SET_RDP_LEVEL,BL_JUMP_TO_USER_APP};
-    if(BL_CRCCheck()==true)
-    {
-        /*Send ACK with 12 Bytes as Length to Follow*/
-        BL_SendACK(13U);
-        /*Send the Supported Commands*/
-        BL_SendDataToHost(Local_BLCMD,13U);
-#if BL_DUBUG_STATUS==BL_DUBUG_ON
-        BL_PrintMesssage("Read The commands supported by bootloader\r\n");
-#endif
-    }
-    else
-    {
-        BL_SendNACK();
-    }
-}
+static void BL_GetHelp(void);
 
 /******************************************************************************
  * \Syntax          : void BL_GetChipID(void)
@@ -477,26 +267,7 @@ static void BL_GetHelp(void)
  * \Parameters (out): None
  * \Return value:   : void
  *******************************************************************************/
-static void BL_GetChipID(void)
-{
-    /*Get Chip*/
-    uint16_t Local_ChipID=(uint16_t)DID_REG;
-    uint8_t Local_ChipIDBytes[2]={0};
-    Local_ChipIDBytes[0]=(uint8_t)Local_ChipID;
-    Local_ChipIDBytes[1]=Local_ChipID>>8;
-    if(BL_CRCCheck()==true)
-    {
-        BL_SendACK(2U);
-        BL_SendDataToHost(Local_ChipIDBytes,2U);
-#if BL_DUBUG_STATUS==BL_DUBUG_ON
-        BL_PrintMesssage("Get the Chip Identification %d\r\n");
-#endif
-    }
-    else
-    {
-        BL_SendNACK();
-    }
-}
+static void BL_GetChipID(void);
 
 /******************************************************************************
  * \Syntax          : void BL_GoToAdd(void)
@@ -508,31 +279,987 @@ static void BL_GetChipID(void)
  * \Parameters (out): None
  * \Return value:   : void
  *******************************************************************************/
-static void BL_GoToAdd(void)
-{
-    bool Local_AddState=false;
-    /*Get the Jump Address from Host Packet*/
-    uint32_t Local_HostJumpAddress=*((uint32_t*)(BL_HostBuffer+2));
-    void (*Local_JumpAddptr)(void)=NULL;
-    if(BL_CRCCheck()==true)
-    {
-        BL_SendACK(1U);
-        /*Verify the Address*/
-        Local_AddState=BL_AddressVerification(Local_HostJumpAddress);
-        /*Send the Verification Result to Host*/
-        BL_SendDataToHost((uint8_t*)&Local_AddState, 1U);
-        if(Local_AddState==true)
-        {
-#if BL_DUBUG_STATUS==BL_DUBUG_ON
-            BL_PrintMesssage("The address is valid. Jumping to %x\r\n",Local_HostJumpAddress);
-#endif
-            Local_JumpAddptr=(void*)(Local_HostJumpAddress);
-            /*Jump to Address that the Host want*/
-            Local_JumpAddptr();
-        }
-        else
-        {
-#if BL_DUBUG_STATUS==BL_DUBUG_ON
+static void BL_GoToAdd(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_EraseFlash(void)
+ * \Description     : Erase Number of blocks from flash
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_EraseFlash(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_WriteMem(void)
+ * \Description     : Write Data to specific Memory Address
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_WriteMem(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_ReadProtectLevel(void)
+ * \Description     : Get the Read Protect Level
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_ReadProtectLevel(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_SetProtectLevel(void)
+ * \Description     : Set the Read Protect Level
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void BL_SetProtectLevel(void);
+
+static void BL_JUmpToUserAppCmd(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_PipeSync(void)
+ * \Description     : Wait for the pending pipelined write to be committed to flash
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_PipeSync(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_PipeWriteMem(void)
+ * \Description     : Start committing a write packet and report the commit
+ *                    state of the previous one, the next packet is received
+ *                    in the other host buffer while this one is programmed
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_PipeWriteMem(void);
+
+/*************************************************************************************************************
+ * \Syntax          : void BL_PipeCommit(const uint8_t* Copy_Payload,uint32_t Copy_StartAddress,uint32_t Copy_DataLen)
+ * \Description     : Hand a payload of the current host buffer to the flash engine and switch
+ *                    the reception to the other host buffer
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Payload:      Payload inside BL_HostBuffer
+ *                    Copy_StartAddress: Flash address of the payload
+ *                    Copy_DataLen:      Payload length
+ * \Parameters (out): None
+ * \Return value:   : void
+ *************************************************************************************************************/
+static void BL_PipeCommit(const uint8_t* Copy_Payload,uint32_t Copy_StartAddress,uint32_t Copy_DataLen);
+
+/******************************************************************************
+ * \Syntax          : void BL_StreamReply(uint8_t Copy_Reply)
+ * \Description     : Send ACK + [next expected sequence, stream status] or
+ *                    NACK + [first missing sequence]
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Reply: BL_ACK - BL_NACK
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_StreamReply(uint8_t Copy_Reply);
+
+/******************************************************************************
+ * \Syntax          : void BL_StreamWrite(void)
+ * \Description     : Accept a sequence numbered write frame of a stream
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_StreamWrite(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_SetBaudRate(void)
+ * \Description     : Switch the host link to the proposed baud rate, keep it
+ *                    if the host pings at the new rate, fall back otherwise
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_SetBaudRate(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_GetSectorCRC(void)
+ * \Description     : Send the CRC32 of every flash sector in a range so the
+ *                    host only reprograms the sectors that changed
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_GetSectorCRC(void);
+
+/******************************************************************************
+ * \Syntax          : bool BL_StageFlush(void)
+ * \Description     : Program the decompressed bytes of the staging buffer
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false
+ *******************************************************************************/
+static bool BL_StageFlush(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_CompressedWrite(void)
+ * \Description     : Decompress a chunk of an LZ4 stream into the staging
+ *                    buffer and program every filled sector sized block
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_CompressedWrite(void);
+
+/*TODO: : Future Work Implement this Function here and in host script*/
+void BL_SetWriteProtoect(void);
+
+/*TODO: : Future Work Implement this Function here and in host script*/
+void BL_GetWriteProtoectState(void);
+
+/*TODO: : Future Work Implement this Function here and in host script*/
+void BL_ReadOTP(void);
+
+/******************************************************************************
+ * \Syntax          : uint8_t BL_ReadAccessCheck(uint32_t Copy_Address,uint32_t Copy_Length)
+ * \Description     : Check a range can be read back by the host, it must lie
+ *                    in one memory and no flash block of it may be execute only
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Address: Start of the range
+ *                    Copy_Length:  Range length
+ * \Parameters (out): None
+ * \Return value:   : uint8_t
+ *                    BL_READ_INVALID - BL_READ_OK - BL_READ_PROTECTED
+ *******************************************************************************/
+static uint8_t BL_ReadAccessCheck(uint32_t Copy_Address,uint32_t Copy_Length);
+
+/******************************************************************************
+ * \Syntax          : void BL_ReadMem(void)
+ * \Description     : Stream a memory range back to the host in CRC protected
+ *                    back to back frames
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_ReadMem(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_VerifyCRC(void)
+ * \Description     : Send the CRC32 of a memory range so the host can verify
+ *                    an image without reading it back
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_VerifyCRC(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_EraseAheadSync(void)
+ * \Description     : Wait for the background sector erase and record its result
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_EraseAheadSync(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_EraseAheadService(void)
+ * \Description     : Start the erase of the next sector of the image once the
+ *                    flash engine is free, called while a packet is received
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_EraseAheadService(void);
+
+/*************************************************************************************************
+ * \Syntax          : bool BL_PrepareSectors(uint32_t Copy_StartAddress,uint32_t Copy_DataLen)
+ * \Description     : Make sure the erase ahead sectors a write lands on are erased and queue
+ *                    the erase of the sector after them
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_StartAddress: Flash address of the write
+ *                    Copy_DataLen:      Write length
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false (a sector could not be erased)
+ *************************************************************************************************/
+static bool BL_PrepareSectors(uint32_t Copy_StartAddress,uint32_t Copy_DataLen);
+
+/******************************************************************************
+ * \Syntax          : void BL_SetEraseAhead(void)
+ * \Description     : Let the writes erase the sectors of a window on their own,
+ *                    the next sector is erased while the current one is received
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_SetEraseAhead(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_FanoutStart(void)
+ * \Description     : Open a fan out session for an image range, the broadcast
+ *                    frames received from now on are written to it
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_FanoutStart(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_FanoutStatus(void)
+ * \Description     : Send the number of fan out frames written and a window of
+ *                    the received bitmap, the host resends the missing frames
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_FanoutStatus(void);
+
+/******************************************************************************
+ * \Syntax          : bool BL_FanoutService(void)
+ * \Description     : Write the next queued fan out frame, called while a
+ *                    packet is received
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false (no frame taken)
+ *******************************************************************************/
+static bool BL_FanoutService(void);
+
+/******************************************************************************
+ * \Syntax          : void BL_GetStats(void)
+ * \Description     : Send a range of the cycle profiling table, optionally
+ *                    clear the table once it is sent
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_GetStats(void);
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+/*Ping-pong host buffers, word aligned so payloads can be handed to the flash engine*/
+static uint32_t BL_HostBufferStorage[2][(BL_HOST_BUFFER_SIZE+3U)/4U]={0};
+static uint8_t* BL_HostBuffer=(uint8_t*)BL_HostBufferStorage[0];
+static uint8_t BL_HostBufferIndex=0U;
+/*Length header of the current frame, BL_FrameLen counts the bytes from the command to the CRC*/
+static uint8_t BL_FrameHeader[BL_EXT_HEADER_LEN]={0};
+static uint8_t BL_FrameHeaderLen=1U;
+static uint16_t BL_FrameLen=0U;
+static uint8_t BL_PipeSeq=0U;
+static uint8_t BL_PipeState=BL_PIPE_NONE;
+static uint16_t BL_StreamExpected=0U;
+static uint32_t BL_StreamReceived=0U;
+static bool BL_StreamError=false;
+/*Set by the first frame of a stream, cleared by its empty end frame or by any other command*/
+static bool BL_StreamOpen=false;
+/*Compressed write: decoder history + one sector of decompressed data, about 3 KB of RAM*/
+static LZ4DEC_t BL_Decoder;
+static uint32_t BL_StageBuffer[FLASH_SECTOR_SIZE/4U]={0};
+static uint32_t BL_StageAddress=0U;
+static uint16_t BL_StageLen=0U;
+static bool BL_CompressedError=true;
+/*Sectors erased since the erase ahead window was opened, one bit per sector*/
+static uint32_t BL_ErasedMap[BL_FLASH_SECTORS_NUM/32U]={0};
+static uint16_t BL_EraseAheadFirst=0U;
+static uint16_t BL_EraseAheadEnd=0U;
+static uint16_t BL_EraseAheadNext=BL_FLASH_SECTORS_NUM;
+static bool BL_EraseJob=false;
+static uint32_t BL_CoalesceBuffer[FLS_WRITE_BUFFER_WORDS]={0};
+static uint32_t BL_CoalesceAddress=BL_COALESCE_EMPTY;
+static bool BL_CoalesceError=false;
+/*Set by the first BL_WRITE_MEM after another command, cleared by the empty BL_WRITE_MEM that ends the sequence*/
+static bool BL_WriteSequence=false;
+/*A block of a sequence ended without its empty frame failed, the verify and the jump fail until the next erase*/
+static bool BL_CoalesceLost=false;
+#if TRANSPORT_CAN_ENABLE==TRANSPORT_ON
+/*Fan out session, one received bit per frame*/
+static uint32_t BL_FanoutMap[(BL_FANOUT_MAX_FRAMES+31U)/32U]={0};
+static uint32_t BL_FanoutAddress=0U;
+static uint32_t BL_FanoutLength=0U;
+static uint16_t BL_FanoutFrames=0U;
+static uint16_t BL_FanoutReceived=0U;
+static bool BL_FanoutError=false;
+#endif
+/*Host link, NULL until the host talked on one of the interfaces*/
+static const TRANSPORT_t* BL_Transport=NULL;
+static uint8_t BL_Command=0U;
+static uint32_t BL_AppAddress=0U;
+static uint8_t BL_AddFlag=0U;
+static void(*BL_FuncPtrArr[])(void)={BL_GetVersion,BL_GetHelp,BL_GetChipID,BL_ReadProtectLevel,BL_GoToAdd,BL_EraseFlash,BL_WriteMem,
+                                     BL_SetWriteProtoect,BL_ReadMem,BL_GetWriteProtoectState,BL_ReadOTP,BL_SetProtectLevel,BL_JUmpToUserAppCmd,
+                                     BL_PipeWriteMem,BL_StreamWrite,BL_SetBaudRate,BL_GetSectorCRC,
+                                     BL_CompressedWrite,BL_VerifyCRC,BL_SetEraseAhead,BL_FanoutStart,BL_FanoutStatus,BL_GetStats};
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+/******************************************************************************
+ * \Syntax          : void BL_PrintMesssage(char *Copy_Format,...)
+ * \Description     : Variatic Function used to send Messages to the host link
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Format: The Format of Sent Data
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_PrintMesssage(char *Copy_Format,...)
+{
+    char Local_Message[100]={0};
+    int Local_Length=0;
+    va_list List;
+    /*Enables Access to variable Arguments*/
+    va_start(List, Copy_Format);
+    /*Write Formatted Data from from variable argument list to string*/
+    Local_Length=vsnprintf(Local_Message,sizeof(Local_Message),Copy_Format,List);
+    /*Performs cleanup for an ap object initialized by a call to va_start*/
+    va_end(List);
+    if(Local_Length>=(int)sizeof(Local_Message))
+    {
+        Local_Length=(int)sizeof(Local_Message)-1;
+    }
+    /*Only the host link is clocked, the text goes the way of the replies*/
+    if((BL_Transport!=NULL) && (Local_Length>0))
+    {
+        BL_SendDataToHost((uint8_t*)Local_Message, (uint16_t)Local_Length);
+    }
+}
+#endif
+
+/************************************************************************************************
+ * \Syntax          : void BL_SendDataToHost(uint8_t* Copy_HostBuffer,uint16_t Copy_DataLen)
+ * \Description     : Send Data to Host
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_HostBuffer: Buffer sent to Host
+ *                    Copy_DataLen: the Length of Buffer being sent to Host
+ * \Parameters (out): None
+ * \Return value:   : void
+ ************************************************************************************************/
+static void BL_SendDataToHost(uint8_t* Copy_HostBuffer,uint16_t Copy_DataLen)
+{
+    /*On CAN every call is one IsoTp message, the host joins them back into the reply stream*/
+    TRANSPORT_SendBytes(BL_Transport, Copy_HostBuffer, Copy_DataLen);
+}
+
+/************************************************************************************************
+ * \Syntax          : void BL_ReceiveDataFromHost(uint8_t* Copy_HostBuffer,uint16_t Copy_DataLen)
+ * \Description     : Send Data to Host
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_HostBuffer: Buffer Received from Host
+ *                    Copy_DataLen: the Length of Buffer being Received from Host
+ * \Parameters (out): None
+ * \Return value:   : void
+ ************************************************************************************************/
+static void BL_ReceiveDataFromHost(uint8_t* Copy_HostBuffer,uint16_t Copy_DataLen)
+{
+    /*Every configured interface listens until the first byte or frame of the host*/
+    while(BL_Transport==NULL)
+    {
+        BL_Transport=TRANSPORT_Detect();
+    }
+    /*Arm the receive (uDMA in UART_DMA_MODE, IsoTp reassembly on CAN) and wait for its completion*/
+    TRANSPORT_StartReceive(BL_Transport, Copy_HostBuffer, Copy_DataLen);
+    while(TRANSPORT_IsReceiveComplete(BL_Transport)==false)
+    {
+        /*Keep programming the previous pipelined packet or erasing the next sector while this one arrives*/
+        FLS_Service();
+        BL_EraseAheadService();
+        BL_FanoutService();
+    }
+}
+
+/********************************************************************************************************
+ * \Syntax          : bool BL_PerformFlashErase(uint16_t Copy_FirstSector,uint16_t Copy_NumofSectors,uint8_t* Copy_Results)
+ * \Description     : Erase Number of Sectors from Flash memory, sectors that are already blank are skipped
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_FirstSector:  The sector start erasing from
+ *                    Copy_NumofSectors: Number of Sectors to be Erased
+ * \Parameters (out): Copy_Results:      BL_SECTOR_ERASED - BL_SECTOR_BLANK - BL_SECTOR_FAILED - BL_SECTOR_PROTECTED
+ *                                       of every sector, packed 4 per byte
+ * \Return value:   : bool
+ *                    true - false
+ **********************************************************************************************************/
+static bool BL_PerformFlashErase(uint16_t Copy_FirstSector,uint16_t Copy_NumofSectors,uint8_t* Copy_Results)
+{
+    bool Local_EraseState=false;
+    uint32_t Local_SectorStart=0;
+    uint16_t Local_Counter=0;
+    uint8_t Local_SectorResult=BL_SECTOR_ERASED;
+    PROF_START(PROF_ID_FLASH_ERASE);
+    /*Make Sure that the user wants to Erase total number of sector <= Available Sectors*/
+    if((Copy_NumofSectors!=0U) && ((Copy_FirstSector+Copy_NumofSectors)<=BL_FLASH_SECTORS_NUM))
+    {
+        Local_EraseState=true;
+        for(Local_Counter=0U;Local_Counter<Copy_NumofSectors;Local_Counter++)
+        {
+            /*Calculate the Sector Start Address*/
+            Local_SectorStart=FLASH_START_ADDRESS+((Copy_FirstSector+Local_Counter)*FLASH_SECTOR_SIZE);
+            if(((Copy_FirstSector+Local_Counter)<BL_FLASH_BOOT_SECTORS) || (FlashProtectGet(Local_SectorStart)!=FlashReadWrite))
+            {
+                /*The bootloader sectors and write protected blocks are never erased*/
+                Local_SectorResult=BL_SECTOR_PROTECTED;
+                Local_EraseState=false;
+            }
+            else if(FLS_IsBlank(Local_SectorStart, FLASH_SECTOR_SIZE)==true)
+            {
+                /*An erased sector reads all 0xFF, erasing it again only costs time and wear*/
+                Local_SectorResult=BL_SECTOR_BLANK;
+            }
+            else if(FlashErase(Local_SectorStart)==0)
+            {
+                Local_SectorResult=BL_SECTOR_ERASED;
+            }
+            else
+            {
+                Local_SectorResult=BL_SECTOR_FAILED;
+                Local_EraseState=false;
+            }
+            Copy_Results[Local_Counter>>2]|=(uint8_t)(Local_SectorResult<<((Local_Counter&3U)*2U));
+        }
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+        if(Local_EraseState==true)
+        {
+            BL_PrintMesssage("Successful Erase to Sectors From %d to %d\r\n",Copy_FirstSector,Copy_NumofSectors+Copy_FirstSector);
+        }
+        else
+        {
+            BL_PrintMesssage("Failed to Erase Memory\r\n");
+        }
+#endif
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    PROF_STOP(PROF_ID_FLASH_ERASE);
+    return Local_EraseState;
+}
+
+/******************************************************************************
+ * \Syntax          : uint8_t BL_RDPHelper(void)
+ * \Description     : Read the Read Protection Level Helper Function
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : uint8_t
+ *                    The Read Protection Level
+ *******************************************************************************/
+static uint8_t BL_RDPHelper(void)
+{
+    tFlashProtection Local_ProtectLevel;
+    /*Get the Protection Level*/
+    Local_ProtectLevel=FlashProtectGet(FLASH_BASE);
+    return Local_ProtectLevel;
+}
+
+/************************************************************************************
+ * \Syntax          : bool BL_ProgramRDPHelper(uint8_t Copy_PL)
+ * \Description     : Helper function to set the protection Level of flash sector
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_PL:  Protection Level to be set
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false
+ ************************************************************************************/
+static bool BL_ProgramRDPHelper(uint8_t Copy_PL)
+{
+    bool Local_ReadStatus=false;
+    int32_t Local_Status;
+    /*Set the flash protect*/
+    Local_Status=FlashProtectSet(FLASH_BASE,(tFlashProtection) Copy_PL);
+    /*Make sure the protect level changed successfully*/
+    if(Local_Status==0)
+    {
+        Local_ReadStatus=true;
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    return Local_ReadStatus;
+}
+
+/**************************************************************************************************************************
+ * \Syntax          : bool BL_PerformFlashWrite(uint8_t* Copy_HostPayload,uint32_t Copy_StartAddress,uint16_t Copy_DataLen)
+ * \Description     : Collect a write in the coalescing buffer, every write buffer block it completes is programmed
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_HostPayload:  Data to be written
+ *                    Copy_StartAddress: Flash address of the data
+ *                    Copy_DataLen:      Data length, any alignment
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false (this write or a block left by the previous writes of the sequence failed)
+ **************************************************************************************************************************/
+static bool BL_PerformFlashWrite(uint8_t* Copy_HostPayload,uint32_t Copy_StartAddress,uint16_t Copy_DataLen)
+{
+    bool Local_WriteState=false;
+    uint32_t Local_Block=0U;
+    uint16_t Local_Offset=0U;
+    uint16_t Local_Chunk=0U;
+    uint16_t Local_Counter=0U;
+    PROF_START(PROF_ID_FLASH_WRITE);
+    if((Copy_StartAddress>=FLASH_START_ADDRESS) && ((Copy_StartAddress+Copy_DataLen)<=FLASH_END_ADDRESS))
+    {
+        while(Copy_DataLen!=0U)
+        {
+            Local_Block=Copy_StartAddress & ~(FLS_WRITE_BUFFER_SIZE-1UL);
+            if(Local_Block!=BL_CoalesceAddress)
+            {
+                /*The write moved to another block, program the collected one first*/
+                BL_CoalesceFlush();
+                BL_CoalesceAddress=Local_Block;
+                /*Programming 0xFF leaves a flash word untouched*/
+                for(Local_Counter=0U;Local_Counter<FLS_WRITE_BUFFER_WORDS;Local_Counter++)
+                {
+                    BL_CoalesceBuffer[Local_Counter]=0xFFFFFFFFUL;
+                }
+            }
+            Local_Offset=(uint16_t)(Copy_StartAddress-Local_Block);
+            Local_Chunk=(uint16_t)(FLS_WRITE_BUFFER_SIZE-Local_Offset);
+            if(Local_Chunk>Copy_DataLen)
+            {
+                Local_Chunk=Copy_DataLen;
+            }
+            for(Local_Counter=0U;Local_Counter<Local_Chunk;Local_Counter++)
+            {
+                ((uint8_t*)BL_CoalesceBuffer)[Local_Offset+Local_Counter]=Copy_HostPayload[Local_Counter];
+            }
+            Copy_HostPayload+=Local_Chunk;
+            Copy_StartAddress+=Local_Chunk;
+            Copy_DataLen-=Local_Chunk;
+            if((Local_Offset+Local_Chunk)==FLS_WRITE_BUFFER_SIZE)
+            {
+                /*The last byte of the block is written, program the whole block in one burst*/
+                BL_CoalesceFlush();
+            }
+        }
+        Local_WriteState=true;
+    }
+    /*A failed block is reported by the next write of the sequence or by its empty end frame*/
+    if(BL_CoalesceError==true)
+    {
+        Local_WriteState=false;
+        BL_CoalesceError=false;
+    }
+    PROF_STOP(PROF_ID_FLASH_WRITE);
+    return Local_WriteState;
+}
+
+/******************************************************************************
+ * \Syntax          : bool BL_CoalesceFlush(void)
+ * \Description     : Program the collected write buffer block in one burst,
+ *                    the bytes no write touched stay 0xFF
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false
+ *******************************************************************************/
+static bool BL_CoalesceFlush(void)
+{
+    bool Local_WriteState=true;
+    if(BL_CoalesceAddress!=BL_COALESCE_EMPTY)
+    {
+        PROF_START(PROF_ID_FLASH_BURST);
+        if((BL_PrepareSectors(BL_CoalesceAddress, FLS_WRITE_BUFFER_SIZE)==false) ||
+           (FlashProgram(BL_CoalesceBuffer, BL_CoalesceAddress, FLS_WRITE_BUFFER_SIZE)!=0))
+        {
+            BL_CoalesceError=true;
+            Local_WriteState=false;
+        }
+        PROF_STOP(PROF_ID_FLASH_BURST);
+        BL_CoalesceAddress=BL_COALESCE_EMPTY;
+    }
+    return Local_WriteState;
+}
+
+/******************************************************************************
+ * \Syntax          : bool BL_CRCCheck(void)
+ * \Description     : Check for CRC Sent by the Host
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Address Address to be verified
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false
+ *******************************************************************************/
+static bool BL_CRCCheck(void)
+{
+    bool Local_CRCState=false;
+    uint16_t Local_DataLen=BL_FrameLen+1U;
+    /*Get the host CRC from the sent Packet*/
+    uint32_t Local_HostCRC=*((uint32_t*)((BL_HostBuffer+Local_DataLen)-BL_CRC_LEN));
+    uint32_t Local_CalculatedCRC=0;
+    /*CRC Verification, the frame body follows the length header in both formats*/
+    PROF_START(PROF_ID_FRAME_CRC);
+    Local_CalculatedCRC=CRC32_Calculate(BL_FrameHeader, BL_FrameHeaderLen);
+    Local_CalculatedCRC=CRC32_Update(Local_CalculatedCRC, &BL_HostBuffer[1], (Local_DataLen-1U-BL_CRC_LEN));
+    PROF_STOP(PROF_ID_FRAME_CRC);
+    if(Local_CalculatedCRC == Local_HostCRC)
+    {
+        Local_CRCState=true;
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+        BL_PrintMesssage("CRC Verification Passed\r\n");
+#endif
+    }
+    else
+    {
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+        BL_PrintMesssage("CRC Verification Failed");
+#endif
+    }
+    return Local_CRCState;
+}
+
+/******************************************************************************
+ * \Syntax          : uint16_t BL_PayloadLength(uint8_t Copy_HeaderLen)
+ * \Description     : Get the payload length of the current frame from its
+ *                    frame length, the 8-bit length field of the write commands
+ *                    can't describe the payload of an extended frame
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_HeaderLen: Bytes from the command to the payload
+ * \Parameters (out): None
+ * \Return value:   : uint16_t
+ *                    The Payload Length
+ *******************************************************************************/
+static uint16_t BL_PayloadLength(uint8_t Copy_HeaderLen)
+{
+    uint16_t Local_PayLoadLen=0U;
+    if(BL_FrameLen>=(Copy_HeaderLen+BL_CRC_LEN))
+    {
+        Local_PayLoadLen=BL_FrameLen-Copy_HeaderLen-BL_CRC_LEN;
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    return Local_PayLoadLen;
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_DiscardFromHost(uint16_t Copy_DataLen)
+ * \Description     : Drop a frame that doesn't fit the host buffer to keep
+ *                    the link in sync
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_DataLen: Number of bytes to be dropped
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_DiscardFromHost(uint16_t Copy_DataLen)
+{
+    uint16_t Local_Chunk=0U;
+    while(Copy_DataLen>0U)
+    {
+        Local_Chunk=(Copy_DataLen>BL_MAX_FRAME_LEN) ? BL_MAX_FRAME_LEN : Copy_DataLen;
+        BL_ReceiveDataFromHost(&BL_HostBuffer[1], Local_Chunk);
+        Copy_DataLen-=Local_Chunk;
+    }
+}
+
+/*************************************************************************************************
+ * \Syntax          : void BL_SendACK(uint8_t Copy_ReplyLen)
+ * \Description     : Send ACK + Length to Follow to host in case of CRC verification Passed
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_ReplyLen : The Reply length to be followed by ACK
+ * \Parameters (out): None
+ * \Return value:   : void
+ *************************************************************************************************/
+static void BL_SendACK(uint8_t Copy_ReplyLen)
+{
+    uint8_t Local_AckVal[2]={0};
+    Local_AckVal[0]=BL_ACK;
+    Local_AckVal[1]=Copy_ReplyLen;
+    /*Send ACK + Length to Flow to Host*/
+    BL_SendDataToHost(Local_AckVal, 2U);
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_SendNACK(void)
+ * \Description     : Send Not ACK to host in case of CRC verification failed
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_SendNACK(void)
+{
+    uint8_t Local_NACKVal=BL_NACK;
+    /*Send Not ACK*/
+    BL_SendDataToHost(&Local_NACKVal, 1U);
+}
+
+/******************************************************************************
+ * \Syntax          : bool BL_AddressVerification(uint32_t Copy_Address)
+ * \Description     : Verify the Address sent by host is in range of memory
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Address Address to be verified
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false
+ *******************************************************************************/
+static bool BL_AddressVerification(uint32_t Copy_Address)
+{
+    bool Local_AddState=false;
+    /*Check if Address is inside the flash range or not*/
+    if(((int32_t)Copy_Address>=FLASH_START_ADDRESS) && (Copy_Address<=FLASH_END_ADDRESS))
+    {
+        Local_AddState=true;
+    }
+    /*Check if Address is inside the SRAM range or not*/
+    else if((Copy_Address>=SRAM_START_ADDRESS) && (Copy_Address<=SRAM_END_ADDRESS))
+    {
+        Local_AddState=true;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return Local_AddState;
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_JumpToUserAPP(uint32_t Copy_AppVectors)
+ * \Description     : Start the application checked by BOOT_ValidateApp
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_AppVectors: Vector table of the application
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_JumpToUserAPP(uint32_t Copy_AppVectors)
+{
+    /*BOOT_Jump waits for the reply of the command before the interface is reset*/
+    BOOT_Jump(Copy_AppVectors);
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_GetVersion(void)
+ * \Description     : Send the Bootloader version to host
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_GetVersion(void)
+{
+    /*Version followed by the frame capabilities, hosts that only know the
+     *first 4 bytes still read the whole reply through the Length to Follow*/
+    uint8_t Local_BLVersion[]={BL_VENDOR_ID,BL_SW_MAJOR_VERSION,BL_SW_MANOR_VERSION,BL_SW_PATCH_VERSION,
+                               BL_FRAME_VERSION,(uint8_t)BL_MAX_FRAME_LEN,(uint8_t)(BL_MAX_FRAME_LEN>>8)};
+    if(BL_CRCCheck()==true)
+    {
+        /*Send ACK with the Version Info length as remaining length*/
+        BL_SendACK(sizeof(Local_BLVersion));
+        /*Send the Version Info to Host*/
+        BL_SendDataToHost(Local_BLVersion,sizeof(Local_BLVersion));
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+        BL_PrintMesssage("Read the Bootloader version %d. %d. %d\r\n",Local_BLVersion[1],Local_BLVersion[2],Local_BLVersion[3]);
+#endif
+    }
+    else
+    {
+        BL_SendNACK();
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_GetHelp(void)
+ * \Description     : Send the Commands codes to host
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_GetHelp(void)
+{
+    uint8_t Local_BLCMD[]={BL_GET_VER,BL_GET_HELP,BL_GET_CID,BL_GET_RDP_LEVEL,BL_GO_TO_ADDR,BL_ERASE_FLASH,BL_WRITE_MEM,BL_ENABLE_DISABLE_WRP,BL_READ_MEM
+                           ,BL_GET_WRP_STATUS,BL_READ_OTP,BL_SET_RDP_LEVEL,BL_JUMP_TO_USER_APP,BL_PIPE_WRITE_MEM,BL_STREAM_WRITE,BL_SET_BAUD,BL_GET_SECTOR_CRC,
+                           BL_COMPRESSED_WRITE,BL_VERIFY_CRC,BL_ERASE_AHEAD,BL_FANOUT_START,BL_FANOUT_STATUS,BL_GET_STATS};
+    if(BL_CRCCheck()==true)
+    {
+        /*Send ACK with the number of supported commands as Length to Follow*/
+        BL_SendACK(sizeof(Local_BLCMD));
+        /*Send the Supported Commands*/
+        BL_SendDataToHost(Local_BLCMD,sizeof(Local_BLCMD));
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+        BL_PrintMesssage("Read The commands supported by bootloader\r\n");
+#endif
+    }
+    else
+    {
+        BL_SendNACK();
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_GetChipID(void)
+ * \Description     : Get the chip Identification Number
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_GetChipID(void)
+{
+    /*Get Chip*/
+    uint16_t Local_ChipID=(uint16_t)DID_REG;
+    uint8_t Local_ChipIDBytes[2]={0};
+    Local_ChipIDBytes[0]=(uint8_t)Local_ChipID;
+    Local_ChipIDBytes[1]=Local_ChipID>>8;
+    if(BL_CRCCheck()==true)
+    {
+        BL_SendACK(2U);
+        BL_SendDataToHost(Local_ChipIDBytes,2U);
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+        BL_PrintMesssage("Get the Chip Identification %d\r\n");
+#endif
+    }
+    else
+    {
+        BL_SendNACK();
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_GoToAdd(void)
+ * \Description     : Go to specific Memory Address
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_GoToAdd(void)
+{
+    bool Local_AddState=false;
+    /*Get the Jump Address from Host Packet*/
+    uint32_t Local_HostJumpAddress=*((uint32_t*)(BL_HostBuffer+2));
+    void (*Local_JumpAddptr)(void)=NULL;
+    if(BL_CRCCheck()==true)
+    {
+        BL_SendACK(1U);
+        /*Verify the Address*/
+        Local_AddState=BL_AddressVerification(Local_HostJumpAddress);
+        /*Send the Verification Result to Host*/
+        BL_SendDataToHost((uint8_t*)&Local_AddState, 1U);
+        if(Local_AddState==true)
+        {
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+            BL_PrintMesssage("The address is valid. Jumping to %x\r\n",Local_HostJumpAddress);
+#endif
+            Local_JumpAddptr=(void*)(uintptr_t)(Local_HostJumpAddress);
+            /*Jump to Address that the Host want*/
+            Local_JumpAddptr();
+        }
+        else
+        {
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
             BL_PrintMesssage("The address isn't Valid\r\n");
 #endif
         }
@@ -544,8 +1271,685 @@ static void BL_GoToAdd(void)
 }
 
 /******************************************************************************
- * \Syntax          : void BL_EraseFlash(void)
- * \Description     : Erase Number of blocks from flash
+ * \Syntax          : void BL_EraseFlash(void)
+ * \Description     : Erase Number of blocks from flash
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_EraseFlash(void)
+{
+    /*Overall state followed by the per sector results*/
+    uint8_t Local_EraseReply[1U+(BL_FLASH_SECTORS_NUM/4U)]={0};
+    uint16_t Local_FirstSector=BL_HostBuffer[2];
+    uint16_t Local_NumofSectors=BL_HostBuffer[3];
+    uint16_t Local_ReplyLen=1U;
+    if(BL_CRCCheck()==true)
+    {
+        /*A reset in the middle of an update must not start a half written application*/
+        BOOT_InvalidateApp();
+        /*A new update, the write failures of the previous one are behind*/
+        BL_CoalesceLost=false;
+        if(Local_FirstSector==BL_MASS_ERASE)
+        {
+            /*A mass erase wipes everything after the bootloader, the flash controller mass erase would wipe it too*/
+            Local_FirstSector=BL_FLASH_BOOT_SECTORS;
+            Local_NumofSectors=BL_FLASH_SECTORS_NUM-BL_FLASH_BOOT_SECTORS;
+        }
+        else
+        {
+            /*Do Nothing*/
+        }
+        /*Set the Address Flag low to take the next Application base address when programming,
+         *a delta update erasing sectors above the application base keeps the known base*/
+        if((BL_HostBuffer[2]==BL_MASS_ERASE) ||
+           ((BL_AppAddress>=(FLASH_START_ADDRESS+(Local_FirstSector*FLASH_SECTOR_SIZE))) &&
+            (BL_AppAddress<(FLASH_START_ADDRESS+((Local_FirstSector+Local_NumofSectors)*FLASH_SECTOR_SIZE)))))
+        {
+            BL_AddFlag=0U;
+        }
+        else
+        {
+            /*Do Nothing*/
+        }
+        /*A rejected range has no sector results to report*/
+        if((Local_FirstSector+Local_NumofSectors)<=BL_FLASH_SECTORS_NUM)
+        {
+            Local_ReplyLen+=(Local_NumofSectors+3U)/4U;
+        }
+        else
+        {
+            /*Do Nothing*/
+        }
+        /*The reply length only depends on the requested range, acknowledge before the erase runs*/
+        BL_SendACK((uint8_t)Local_ReplyLen);
+        /*Erase the number of sectors that host needs*/
+        Local_EraseReply[0]=(uint8_t)BL_PerformFlashErase(Local_FirstSector, Local_NumofSectors, &Local_EraseReply[1]);
+        BL_SendDataToHost(Local_EraseReply, Local_ReplyLen);
+    }
+    else
+    {
+        BL_SendNACK();
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_WriteMem(void)
+ * \Description     : Write Data to specific Memory Address
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_WriteMem(void)
+{
+    bool Local_AddressState=false;
+    uint32_t Local_StartAddress=*((uint32_t*)(BL_HostBuffer+2));
+    /*Command + Address + Length byte come before the payload*/
+    uint32_t Local_PayLoadLen=BL_PayloadLength(6U);
+    if(BL_CRCCheck()==true)
+    {
+        if(BL_WriteSequence==false)
+        {
+            /*First write of a sequence, a block that failed before it is never charged to its writes*/
+            BL_WriteSequence=true;
+            BL_CoalesceError=false;
+        }
+        if(Local_PayLoadLen==0U)
+        {
+            /*End of the sequence, program the tail block so the status covers every write of it*/
+            BL_SendACK(1U);
+            BL_CoalesceFlush();
+            if(BL_CoalesceError==false)
+            {
+                Local_AddressState=true;
+            }
+            BL_CoalesceError=false;
+            BL_WriteSequence=false;
+        }
+        else
+        {
+            BOOT_InvalidateApp();
+            /*Get the First Address of the Application*/
+            if(BL_AddFlag==0U)
+            {
+                /*Set the Flag to 1 to Make sure that we take the application base Address*/
+                BL_AddFlag=1U;
+                BL_AppAddress=Local_StartAddress;
+            }
+            BL_SendACK(1U);
+            Local_AddressState=BL_AddressVerification(Local_StartAddress);
+            if(Local_AddressState==true)
+            {
+                Local_AddressState=BL_PerformFlashWrite(&BL_HostBuffer[7],Local_StartAddress,Local_PayLoadLen);
+            }
+            else
+            {
+
+            }
+        }
+        BL_SendDataToHost((uint8_t*)&Local_AddressState, 1U);
+    }
+    else
+    {
+        BL_SendNACK();
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_ReadProtectLevel(void)
+ * \Description     : Get the Read Protect Level
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_ReadProtectLevel(void)
+{
+    uint8_t Local_PRLevel=0U;
+    if(BL_CRCCheck()==true)
+    {
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+        BL_PrintMesssage("Read Protection Level\r\n");
+#endif
+        BL_SendACK(1U);
+        /*Read the protect Level*/
+        Local_PRLevel=BL_RDPHelper();
+        BL_SendDataToHost(&Local_PRLevel, 1U);
+    }
+    else
+    {
+        BL_SendNACK();
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_SetProtectLevel(void)
+ * \Description     : Set the Read Protect Level
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void BL_SetProtectLevel(void)
+{
+    bool Local_PRState=false;
+    if(BL_CRCCheck()==true)
+    {
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+        BL_PrintMesssage("Read Protection Level\r\n");
+#endif
+        BL_SendACK(1U);
+        /*Set the Protect Level*/
+        Local_PRState=BL_ProgramRDPHelper(BL_HostBuffer[2]);
+        BL_SendDataToHost((uint8_t*)&Local_PRState, 1);
+    }
+    else
+    {
+        BL_SendNACK();
+    }
+}
+
+static void BL_JUmpToUserAppCmd(void)
+{
+    bool Local_State=false;
+    uint32_t Local_AppVectors=0U;
+    if(BL_CRCCheck()==true)
+    {
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+        BL_PrintMesssage("Jumping to User Application\r\n");
+#endif
+        BL_SendACK(1U);
+        if(BL_AppAddress==0U)
+        {
+            /*Nothing written since reset, the application recorded by a previous session*/
+            BL_AppAddress=BOOT_GetAppAddress();
+        }
+        /*Make sure that there is an intact Application on the sector, recorded for the next resets*/
+        if((BL_AppAddress!=0U) && (BL_CoalesceLost==false))
+        {
+            Local_AppVectors=BOOT_ValidateApp(BL_AppAddress);
+        }
+        if(Local_AppVectors!=0U)
+        {
+            Local_State=true;
+            /*Send the Jumping State*/
+            BL_SendDataToHost((uint8_t*)&Local_State, 1);
+            /*Jump to user Application*/
+            BL_JumpToUserAPP(Local_AppVectors);
+        }
+        else
+        {
+            BL_SendDataToHost((uint8_t*)&Local_State, 1);
+        }
+    }
+    else
+    {
+        BL_SendNACK();
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_PipeSync(void)
+ * \Description     : Wait for the pending pipelined write to be committed to flash
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_PipeSync(void)
+{
+    if(BL_PipeState==BL_PIPE_PENDING)
+    {
+        if(FLS_WaitJob()==FLS_DONE)
+        {
+            BL_PipeState=BL_PIPE_PASSED;
+        }
+        else
+        {
+            BL_PipeState=BL_PIPE_FAILED;
+        }
+    }
+}
+
+/*************************************************************************************************************
+ * \Syntax          : void BL_PipeCommit(const uint8_t* Copy_Payload,uint32_t Copy_StartAddress,uint32_t Copy_DataLen)
+ * \Description     : Hand a payload of the current host buffer to the flash engine and switch
+ *                    the reception to the other host buffer
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Payload:      Payload inside BL_HostBuffer
+ *                    Copy_StartAddress: Flash address of the payload
+ *                    Copy_DataLen:      Payload length
+ * \Parameters (out): None
+ * \Return value:   : void
+ *************************************************************************************************************/
+static void BL_PipeCommit(const uint8_t* Copy_Payload,uint32_t Copy_StartAddress,uint32_t Copy_DataLen)
+{
+    BL_PipeState=BL_PIPE_FAILED;
+    if((Copy_StartAddress>=FLASH_START_ADDRESS) && ((Copy_StartAddress+Copy_DataLen)<=FLASH_END_ADDRESS))
+    {
+        if((BL_PrepareSectors(Copy_StartAddress, Copy_DataLen)==true) && (FLS_ProgramStart(Copy_Payload, Copy_StartAddress, Copy_DataLen)==true))
+        {
+            BL_PipeState=BL_PIPE_PENDING;
+            /*This buffer belongs to the flash engine now, receive the next packet in the other one*/
+            BL_HostBufferIndex^=1U;
+            BL_HostBuffer=(uint8_t*)BL_HostBufferStorage[BL_HostBufferIndex];
+        }
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_PipeWriteMem(void)
+ * \Description     : Start committing a write packet and report the commit
+ *                    state of the previous one, the next packet is received
+ *                    in the other host buffer while this one is programmed
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_PipeWriteMem(void)
+{
+    uint8_t Local_Reply[2]={0};
+    uint8_t Local_Seq=BL_HostBuffer[2];
+    uint32_t Local_StartAddress=*((uint32_t*)(BL_HostBuffer+3));
+    /*Command + Sequence + Address + Length byte come before the payload*/
+    uint32_t Local_PayLoadLen=BL_PayloadLength(7U);
+    if(BL_CRCCheck()==true)
+    {
+        BOOT_InvalidateApp();
+        /*The previous packet has been programming while this one was received*/
+        BL_PipeSync();
+        Local_Reply[0]=BL_PipeSeq;
+        Local_Reply[1]=BL_PipeState;
+        BL_SendACK(2U);
+        BL_SendDataToHost(Local_Reply, 2U);
+        if(Local_PayLoadLen==0U)
+        {
+            /*Empty packet flushes the pipeline*/
+            BL_PipeState=BL_PIPE_NONE;
+        }
+        else
+        {
+            BL_PipeSeq=Local_Seq;
+            if(BL_AddFlag==0U)
+            {
+                BL_AddFlag=1U;
+                BL_AppAddress=Local_StartAddress;
+            }
+            BL_PipeCommit(&BL_HostBuffer[8], Local_StartAddress, Local_PayLoadLen);
+        }
+    }
+    else
+    {
+        BL_SendNACK();
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_StreamReply(uint8_t Copy_Reply)
+ * \Description     : Send ACK + [next expected sequence, stream status] or
+ *                    NACK + [first missing sequence]
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Reply: BL_ACK - BL_NACK
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_StreamReply(uint8_t Copy_Reply)
+{
+    uint8_t Local_Reply[3]={0};
+    Local_Reply[0]=(uint8_t)BL_StreamExpected;
+    Local_Reply[1]=(uint8_t)(BL_StreamExpected>>8);
+    if(Copy_Reply==BL_ACK)
+    {
+        Local_Reply[2]=(BL_StreamError==true) ? BL_PIPE_FAILED : BL_PIPE_PASSED;
+        BL_SendACK(3U);
+        BL_SendDataToHost(Local_Reply, 3U);
+    }
+    else
+    {
+        Local_Reply[2]=BL_NACK;
+        /*NACK byte followed by the sequence the host has to resend*/
+        BL_SendDataToHost(&Local_Reply[2], 1U);
+        BL_SendDataToHost(Local_Reply, 2U);
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_StreamWrite(void)
+ * \Description     : Accept a sequence numbered write frame of a stream
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_StreamWrite(void)
+{
+    uint16_t Local_Seq=(uint16_t)BL_HostBuffer[2] | ((uint16_t)BL_HostBuffer[3]<<8);
+    uint32_t Local_StartAddress=*((uint32_t*)(BL_HostBuffer+4));
+    /*Command + 16-bit Sequence + Address + Length byte come before the payload*/
+    uint32_t Local_PayLoadLen=BL_PayloadLength(8U);
+    uint16_t Local_Offset=0U;
+    if(BL_CRCCheck()==true)
+    {
+        BOOT_InvalidateApp();
+        /*Collect the commit result of the previous frame*/
+        BL_PipeSync();
+        if(BL_PipeState==BL_PIPE_FAILED)
+        {
+            BL_StreamError=true;
+        }
+        BL_PipeState=BL_PIPE_NONE;
+        if(Local_PayLoadLen==0U)
+        {
+            /*End of stream, the status now covers every frame and is kept for a resent end frame*/
+            BL_StreamOpen=false;
+            BL_StreamReply(BL_ACK);
+        }
+        else
+        {
+            if(BL_StreamOpen==false)
+            {
+                /*First frame of a new stream, a resent sequence 0 of an open stream is only a duplicate*/
+                BL_StreamOpen=true;
+                BL_StreamExpected=0U;
+                BL_StreamReceived=0U;
+                BL_StreamError=false;
+            }
+            if(Local_Seq==0U)
+            {
+                BL_AddFlag=1U;
+                BL_AppAddress=Local_StartAddress;
+            }
+            Local_Offset=(uint16_t)(Local_Seq-BL_StreamExpected);
+            /*Frames behind the window or already received are only acknowledged again*/
+            if((Local_Offset<BL_STREAM_WINDOW) && ((BL_StreamReceived & (1UL<<Local_Offset))==0U))
+            {
+                BL_PipeCommit(&BL_HostBuffer[9], Local_StartAddress, Local_PayLoadLen);
+                if(BL_PipeState==BL_PIPE_FAILED)
+                {
+                    BL_StreamError=true;
+                }
+                BL_StreamReceived|=(1UL<<Local_Offset);
+                /*Slide the window over the contiguous frames*/
+                while((BL_StreamReceived & 1UL)!=0U)
+                {
+                    BL_StreamReceived>>=1;
+                    BL_StreamExpected++;
+                }
+            }
+            /*A hole before received frames asks for a selective retransmission*/
+            BL_StreamReply((BL_StreamReceived==0U) ? BL_ACK : BL_NACK);
+        }
+    }
+    else
+    {
+        BL_StreamReply(BL_NACK);
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_SetBaudRate(void)
+ * \Description     : Switch the host link to the proposed baud rate, keep it
+ *                    if the host pings at the new rate, fall back otherwise
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_SetBaudRate(void)
+{
+    bool Local_BaudState=false;
+    uint32_t Local_NewBaud=*((uint32_t*)(BL_HostBuffer+2));
+    UARTBAUD_Divisor_t Local_Divisor;
+    UARTBAUD_Session_t Local_Session;
+    uint8_t Local_Data=0U;
+    uint8_t Local_Pong=UARTBAUD_PONG;
+    UART_t Local_Uart=(UART_t)BL_Transport->Channel;
+    if(BL_CRCCheck()==true)
+    {
+        BL_SendACK(1U);
+        /*Refuse rates the UART clock can't generate before leaving the current one, CAN keeps its bit rate*/
+        if(BL_Transport->Ops->Kind==TRANSPORT_KIND_UART)
+        {
+            Local_BaudState=UARTBAUD_Calculate(SysCtlClockGet(), Local_NewBaud, &Local_Divisor);
+        }
+        else
+        {
+            /*Do Nothing*/
+        }
+        BL_SendDataToHost((uint8_t*)&Local_BaudState, 1U);
+        if(Local_BaudState==true)
+        {
+            UARTBAUD_Start(&Local_Session, UART_GetBaudRate(Local_Uart), Local_NewBaud, BL_BAUD_PING_TIMEOUT_MS);
+            /*Flushes the reply out at the old rate before switching*/
+            UART_SetBaudRate(Local_Uart, Local_NewBaud);
+            while(Local_Session.State==UARTBAUD_WAIT_PING)
+            {
+                if(UART_ReadBytes(Local_Uart, &Local_Data, 1U)==1U)
+                {
+                    UARTBAUD_OnByte(&Local_Session, Local_Data);
+                }
+                else
+                {
+                    /*About 1 ms, SysCtlDelay takes 3 cycles per loop*/
+                    SysCtlDelay(SysCtlClockGet()/3000U);
+                    UARTBAUD_OnTick(&Local_Session);
+                }
+            }
+            if(Local_Session.State==UARTBAUD_CONFIRMED)
+            {
+                BL_SendDataToHost(&Local_Pong, 1U);
+            }
+            else
+            {
+                /*The host didn't make it to the new rate*/
+                UART_SetBaudRate(Local_Uart, UARTBAUD_ActiveBaud(&Local_Session));
+            }
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+            BL_PrintMesssage("Baud rate %d\r\n",UARTBAUD_ActiveBaud(&Local_Session));
+#endif
+        }
+    }
+    else
+    {
+        BL_SendNACK();
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_GetSectorCRC(void)
+ * \Description     : Send the CRC32 of every flash sector in a range so the
+ *                    host only reprograms the sectors that changed
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_GetSectorCRC(void)
+{
+    uint8_t Local_RangeState=BL_READ_INVALID;
+    uint16_t Local_FirstSector=BL_HostBuffer[2];
+    uint16_t Local_NumofSectors=BL_HostBuffer[3];
+    uint16_t Local_Counter=0U;
+    uint32_t Local_SectorCRC=0U;
+    if(BL_CRCCheck()==true)
+    {
+        if((Local_NumofSectors!=0U) && (Local_NumofSectors<=BL_SECTOR_CRC_MAX) && ((Local_FirstSector+Local_NumofSectors)<=BL_FLASH_SECTORS_NUM))
+        {
+            /*Same access rules as the read back, the CRC of a sector reveals its content*/
+            Local_RangeState=BL_ReadAccessCheck(FLASH_START_ADDRESS+(Local_FirstSector*FLASH_SECTOR_SIZE), Local_NumofSectors*FLASH_SECTOR_SIZE);
+        }
+        else
+        {
+            /*Do Nothing*/
+        }
+        if(Local_RangeState==BL_READ_OK)
+        {
+            /*Range State followed by a little endian CRC32 per sector*/
+            BL_SendACK(1U+(Local_NumofSectors*4U));
+            BL_SendDataToHost(&Local_RangeState, 1U);
+            for(Local_Counter=Local_FirstSector;Local_Counter<(Local_FirstSector+Local_NumofSectors);Local_Counter++)
+            {
+                Local_SectorCRC=CRC32_Calculate(FLS_MEMORY(FLASH_START_ADDRESS+(Local_Counter*FLASH_SECTOR_SIZE)), FLASH_SECTOR_SIZE);
+                BL_SendDataToHost((uint8_t*)&Local_SectorCRC, 4U);
+            }
+        }
+        else
+        {
+            BL_SendACK(1U);
+            BL_SendDataToHost(&Local_RangeState, 1U);
+        }
+    }
+    else
+    {
+        BL_SendNACK();
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : bool BL_StageFlush(void)
+ * \Description     : Program the decompressed bytes of the staging buffer
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false
+ *******************************************************************************/
+static bool BL_StageFlush(void)
+{
+    bool Local_WriteState=false;
+    uint8_t* Local_Stage=(uint8_t*)BL_StageBuffer;
+    uint16_t Local_Length=BL_StageLen;
+    /*FlashProgram takes whole words, pad the tail like erased flash*/
+    while((Local_Length%4U)!=0U)
+    {
+        Local_Stage[Local_Length]=0xFFU;
+        Local_Length++;
+    }
+    if((BL_StageAddress>=FLASH_START_ADDRESS) && ((BL_StageAddress+Local_Length)<=FLASH_END_ADDRESS))
+    {
+        if((BL_PrepareSectors(BL_StageAddress, Local_Length)==true) && (FlashProgram(BL_StageBuffer, BL_StageAddress, Local_Length)==0))
+        {
+            Local_WriteState=true;
+        }
+    }
+    BL_StageAddress+=BL_StageLen;
+    BL_StageLen=0U;
+    return Local_WriteState;
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_CompressedWrite(void)
+ * \Description     : Decompress a chunk of an LZ4 stream into the staging
+ *                    buffer and program every filled sector sized block
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_CompressedWrite(void)
+{
+    uint8_t Local_Flags=BL_HostBuffer[2];
+    uint32_t Local_StartAddress=*((uint32_t*)(BL_HostBuffer+3));
+    /*Command + Flags + Address come before the compressed chunk*/
+    uint16_t Local_PayLoadLen=BL_PayloadLength(6U);
+    uint16_t Local_Offset=0U;
+    uint32_t Local_Consumed=0U;
+    uint32_t Local_Produced=0U;
+    LZ4DEC_Status_t Local_Status=LZ4DEC_NEED_INPUT;
+    bool Local_WriteState=false;
+    if(BL_CRCCheck()==true)
+    {
+        BOOT_InvalidateApp();
+        if((Local_Flags & BL_CWRITE_START)!=0U)
+        {
+            LZ4DEC_Init(&BL_Decoder);
+            BL_StageAddress=Local_StartAddress;
+            BL_StageLen=0U;
+            BL_CompressedError=((Local_StartAddress%4U)!=0U);
+            if(BL_AddFlag==0U)
+            {
+                BL_AddFlag=1U;
+                BL_AppAddress=Local_StartAddress;
+            }
+        }
+        /*A match may still produce output after the last input byte*/
+        while((BL_CompressedError==false) && ((Local_Offset<Local_PayLoadLen) || (Local_Status==LZ4DEC_OUTPUT_FULL)))
+        {
+            Local_Status=LZ4DEC_Decode(&BL_Decoder, &BL_HostBuffer[7U+Local_Offset], Local_PayLoadLen-Local_Offset, &Local_Consumed,
+                                       ((uint8_t*)BL_StageBuffer)+BL_StageLen, FLASH_SECTOR_SIZE-BL_StageLen, &Local_Produced);
+            Local_Offset+=Local_Consumed;
+            BL_StageLen+=Local_Produced;
+            if(Local_Status==LZ4DEC_ERROR)
+            {
+                BL_CompressedError=true;
+            }
+            else if(BL_StageLen==FLASH_SECTOR_SIZE)
+            {
+                BL_CompressedError=(BL_StageFlush()==false);
+            }
+            else
+            {
+                /*Do Nothing*/
+            }
+        }
+        if(((Local_Flags & BL_CWRITE_END)!=0U) && (BL_CompressedError==false))
+        {
+            if(LZ4DEC_IsComplete(&BL_Decoder)==false)
+            {
+                BL_CompressedError=true;
+            }
+            else if(BL_StageLen!=0U)
+            {
+                BL_CompressedError=(BL_StageFlush()==false);
+            }
+            else
+            {
+                /*Do Nothing*/
+            }
+        }
+        Local_WriteState=(BL_CompressedError==false);
+        BL_SendACK(1U);
+        BL_SendDataToHost((uint8_t*)&Local_WriteState, 1U);
+    }
+    else
+    {
+        BL_SendNACK();
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_VerifyCRC(void)
+ * \Description     : Send the CRC32 of a memory range so the host can verify
+ *                    an image without reading it back
  *
  * \Sync\Async      : Synchronous
  * \Reentrancy      : Non Reentrant
@@ -553,17 +1957,31 @@ static void BL_GoToAdd(void)
  * \Parameters (out): None
  * \Return value:   : void
  *******************************************************************************/
-static void BL_EraseFlash(void)
+static void BL_VerifyCRC(void)
 {
-    bool Local_FlashEraseState=false;
+    uint32_t Local_StartAddress=*((uint32_t*)(BL_HostBuffer+2));
+    uint32_t Local_Length=*((uint32_t*)(BL_HostBuffer+6));
+    uint8_t Local_Reply[5]={0};
+    uint32_t Local_RangeCRC=0U;
     if(BL_CRCCheck()==true)
     {
-        /*Set the Address Flag low to take the next Application base address when programming*/
-        BL_AddFlag=0U;
-        BL_SendACK(1U);
-        /*Erase the number of sectors that host needs*/
-        Local_FlashEraseState=BL_PerformFlashErase(BL_HostBuffer[2], BL_HostBuffer[3]);
-        BL_SendDataToHost((uint8_t*)&Local_FlashEraseState, 1U);
+        /*Same access rules as the read back, the CRC of a short range reveals its content*/
+        Local_Reply[0]=BL_ReadAccessCheck(Local_StartAddress, Local_Length);
+        if((Local_Reply[0]==BL_READ_OK) && (BL_CoalesceLost==true))
+        {
+            /*The flash doesn't hold what the host was told is written*/
+            Local_Reply[0]=BL_READ_WRITE_FAILED;
+        }
+        if(Local_Reply[0]==BL_READ_OK)
+        {
+            Local_RangeCRC=CRC32_Calculate(FLS_MEMORY(Local_StartAddress), Local_Length);
+            Local_Reply[1]=(uint8_t)Local_RangeCRC;
+            Local_Reply[2]=(uint8_t)(Local_RangeCRC>>8);
+            Local_Reply[3]=(uint8_t)(Local_RangeCRC>>16);
+            Local_Reply[4]=(uint8_t)(Local_RangeCRC>>24);
+        }
+        BL_SendACK(5U);
+        BL_SendDataToHost(Local_Reply, 5U);
     }
     else
     {
@@ -572,8 +1990,8 @@ static void BL_EraseFlash(void)
 }
 
 /******************************************************************************
- * \Syntax          : void BL_WriteMem(void)
- * \Description     : Write Data to specific Memory Address
+ * \Syntax          : void BL_EraseAheadSync(void)
+ * \Description     : Wait for the background sector erase and record its result
  *
  * \Sync\Async      : Synchronous
  * \Reentrancy      : Non Reentrant
@@ -581,41 +1999,137 @@ static void BL_EraseFlash(void)
  * \Parameters (out): None
  * \Return value:   : void
  *******************************************************************************/
-static void BL_WriteMem(void)
+static void BL_EraseAheadSync(void)
 {
-    bool Local_AddressState=false;
-    uint32_t Local_StartAddress=*((uint32_t*)(BL_HostBuffer+2));
-    uint32_t Local_PayLoadLen= BL_HostBuffer[6];
-    if(BL_CRCCheck()==true)
+    if(BL_EraseJob==true)
     {
-        /*Get the First Address of the Application*/
-        if(BL_AddFlag==0U)
+        if(FLS_WaitJob()==FLS_DONE)
         {
-            /*Set the Flag to 1 to Make sure that we take the application base Address*/
-            BL_AddFlag=1U;
-            BL_AppAddress=Local_StartAddress;
+            BL_ErasedMap[BL_EraseAheadNext>>5]|=(1UL<<(BL_EraseAheadNext & 31U));
         }
-        BL_SendACK(1U);
-        Local_AddressState=BL_AddressVerification(Local_StartAddress);
-        if(Local_AddressState==true)
+        else
+        {
+            /*Do Nothing, the sector is erased again in the foreground when it is written*/
+        }
+        BL_EraseJob=false;
+        BL_EraseAheadNext=BL_FLASH_SECTORS_NUM;
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_EraseAheadService(void)
+ * \Description     : Start the erase of the next sector of the image once the
+ *                    flash engine is free, called while a packet is received
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_EraseAheadService(void)
+{
+    uint32_t Local_SectorStart=0U;
+    if(BL_EraseJob==true)
+    {
+        if(FLS_Service()!=FLS_BUSY)
         {
-            Local_AddressState=BL_PerformFlashWrite(&BL_HostBuffer[7],Local_StartAddress,Local_PayLoadLen);
+            BL_EraseAheadSync();
+        }
+    }
+    else if((BL_EraseAheadNext>=BL_EraseAheadFirst) && (BL_EraseAheadNext<BL_EraseAheadEnd))
+    {
+        if(BL_PipeState==BL_PIPE_PENDING)
+        {
+            /*Collect the pipelined write once it ends to free the engine for the erase*/
+            if(FLS_Service()!=FLS_BUSY)
+            {
+                BL_PipeSync();
+            }
+        }
+        else if((BL_ErasedMap[BL_EraseAheadNext>>5] & (1UL<<(BL_EraseAheadNext & 31U)))!=0U)
+        {
+            BL_EraseAheadNext=BL_FLASH_SECTORS_NUM;
         }
         else
         {
-
+            Local_SectorStart=FLASH_START_ADDRESS+(BL_EraseAheadNext*FLASH_SECTOR_SIZE);
+            if(FLS_IsBlank(Local_SectorStart, FLASH_SECTOR_SIZE)==true)
+            {
+                BL_ErasedMap[BL_EraseAheadNext>>5]|=(1UL<<(BL_EraseAheadNext & 31U));
+                BL_EraseAheadNext=BL_FLASH_SECTORS_NUM;
+            }
+            else
+            {
+                /*The CPU stalls on flash fetches during the erase, uDMA keeps receiving the packet*/
+                BL_EraseJob=FLS_EraseStart(Local_SectorStart);
+            }
         }
-        BL_SendDataToHost((uint8_t*)&Local_AddressState, 1U);
     }
     else
     {
-        BL_SendNACK();
+        /*Do Nothing*/
+    }
+}
+
+/*************************************************************************************************
+ * \Syntax          : bool BL_PrepareSectors(uint32_t Copy_StartAddress,uint32_t Copy_DataLen)
+ * \Description     : Make sure the erase ahead sectors a write lands on are erased and queue
+ *                    the erase of the sector after them
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_StartAddress: Flash address of the write
+ *                    Copy_DataLen:      Write length
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false (a sector could not be erased)
+ *************************************************************************************************/
+static bool BL_PrepareSectors(uint32_t Copy_StartAddress,uint32_t Copy_DataLen)
+{
+    bool Local_State=true;
+    uint16_t Local_Sector=0U;
+    uint16_t Local_LastSector=0U;
+    if((BL_EraseAheadEnd!=0U) && (Copy_DataLen!=0U) && (Copy_StartAddress>=FLASH_START_ADDRESS) && ((Copy_StartAddress+Copy_DataLen)<=FLASH_END_ADDRESS))
+    {
+        BL_EraseAheadSync();
+        Local_Sector=(uint16_t)((Copy_StartAddress-FLASH_START_ADDRESS)/FLASH_SECTOR_SIZE);
+        Local_LastSector=(uint16_t)((Copy_StartAddress+Copy_DataLen-1U-FLASH_START_ADDRESS)/FLASH_SECTOR_SIZE);
+        for( ;(Local_Sector<=Local_LastSector) && (Local_State==true);Local_Sector++)
+        {
+            /*Sectors outside the window are left to the explicit erase command*/
+            if((Local_Sector>=BL_EraseAheadFirst) && (Local_Sector<BL_EraseAheadEnd) &&
+               ((BL_ErasedMap[Local_Sector>>5] & (1UL<<(Local_Sector & 31U)))==0U))
+            {
+                /*The background erase did not get to this sector, erase it now*/
+                if((FLS_IsBlank(FLASH_START_ADDRESS+(Local_Sector*FLASH_SECTOR_SIZE), FLASH_SECTOR_SIZE)==true) ||
+                   (FlashErase(FLASH_START_ADDRESS+(Local_Sector*FLASH_SECTOR_SIZE))==0))
+                {
+                    BL_ErasedMap[Local_Sector>>5]|=(1UL<<(Local_Sector & 31U));
+                }
+                else
+                {
+                    Local_State=false;
+                }
+            }
+        }
+        /*Erase the following sector while the next packets are received, only inside the window*/
+        if(((Local_LastSector+1U)>=BL_EraseAheadFirst) && ((Local_LastSector+1U)<BL_EraseAheadEnd))
+        {
+            BL_EraseAheadNext=Local_LastSector+1U;
+        }
+        else
+        {
+            BL_EraseAheadNext=BL_FLASH_SECTORS_NUM;
+        }
     }
+    return Local_State;
 }
 
 /******************************************************************************
- * \Syntax          : void BL_ReadProtectLevel(void)
- * \Description     : Get the Read Protect Level
+ * \Syntax          : void BL_SetEraseAhead(void)
+ * \Description     : Let the writes erase the sectors of a window on their own,
+ *                    the next sector is erased while the current one is received
  *
  * \Sync\Async      : Synchronous
  * \Reentrancy      : Non Reentrant
@@ -623,18 +2137,35 @@ static void BL_WriteMem(void)
  * \Parameters (out): None
  * \Return value:   : void
  *******************************************************************************/
-static void BL_ReadProtectLevel(void)
+static void BL_SetEraseAhead(void)
 {
-    uint8_t Local_PRLevel=0U;
+    bool Local_State=false;
+    uint16_t Local_FirstSector=BL_HostBuffer[2];
+    uint16_t Local_NumofSectors=BL_HostBuffer[3];
+    uint8_t Local_Counter=0U;
     if(BL_CRCCheck()==true)
     {
-#if BL_DUBUG_STATUS==BL_DUBUG_ON
-        BL_PrintMesssage("Read Protection Level\r\n");
-#endif
+        BOOT_InvalidateApp();
+        BL_CoalesceLost=false;
+        /*Close the previous window and forget its erased sectors*/
+        BL_EraseAheadEnd=0U;
+        BL_EraseAheadNext=BL_FLASH_SECTORS_NUM;
+        for(Local_Counter=0U;Local_Counter<(BL_FLASH_SECTORS_NUM/32U);Local_Counter++)
+        {
+            BL_ErasedMap[Local_Counter]=0U;
+        }
+        /*An empty window disables the erase ahead, the bootloader sectors are never in a window.
+         *Without uDMA the stalled CPU would overrun the UART FIFO during a background erase,
+         *on CAN the receive mailbox FIFO holds a whole flow control block meanwhile*/
+        if((BL_Transport->Ops->ReceivesDuringStall==true) && (Local_NumofSectors!=0U) && (Local_FirstSector>=BL_FLASH_BOOT_SECTORS) && ((Local_FirstSector+Local_NumofSectors)<=BL_FLASH_SECTORS_NUM))
+        {
+            BL_EraseAheadFirst=Local_FirstSector;
+            BL_EraseAheadEnd=Local_FirstSector+Local_NumofSectors;
+            BL_EraseAheadNext=Local_FirstSector;
+            Local_State=true;
+        }
         BL_SendACK(1U);
-        /*Read the protect Level*/
-        Local_PRLevel=BL_RDPHelper();
-        BL_SendDataToHost(&Local_PRLevel, 1U);
+        BL_SendDataToHost((uint8_t*)&Local_State, 1U);
     }
     else
     {
@@ -643,8 +2174,9 @@ static void BL_ReadProtectLevel(void)
 }
 
 /******************************************************************************
- * \Syntax          : void BL_SetProtectLevel(void)
- * \Description     : Set the Read Protect Level
+ * \Syntax          : void BL_FanoutStart(void)
+ * \Description     : Open a fan out session for an image range, the broadcast
+ *                    frames received from now on are written to it
  *
  * \Sync\Async      : Synchronous
  * \Reentrancy      : Non Reentrant
@@ -652,18 +2184,57 @@ static void BL_ReadProtectLevel(void)
  * \Parameters (out): None
  * \Return value:   : void
  *******************************************************************************/
-void BL_SetProtectLevel(void)
+static void BL_FanoutStart(void)
 {
-    bool Local_PRState=false;
+    uint32_t Local_StartAddress=*((uint32_t*)(BL_HostBuffer+2));
+    uint32_t Local_Length=*((uint32_t*)(BL_HostBuffer+6));
+    uint8_t Local_State=BL_FANOUT_IDLE;
+#if TRANSPORT_CAN_ENABLE==TRANSPORT_ON
+    uint16_t Local_Counter=0U;
+    uint16_t Local_Sequence=0U;
+    uint8_t Local_Data[BL_FANOUT_FRAME_LEN];
+#endif
     if(BL_CRCCheck()==true)
     {
-#if BL_DUBUG_STATUS==BL_DUBUG_ON
-        BL_PrintMesssage("Read Protection Level\r\n");
+        BOOT_InvalidateApp();
+#if TRANSPORT_CAN_ENABLE==TRANSPORT_ON
+        BL_FanoutFrames=0U;
+        BL_FanoutReceived=0U;
+        BL_FanoutError=false;
+        for(Local_Counter=0U;Local_Counter<((BL_FANOUT_MAX_FRAMES+31U)/32U);Local_Counter++)
+        {
+            BL_FanoutMap[Local_Counter]=0U;
+        }
+        /*No broadcast on a point to point link*/
+        if(BL_Transport->Ops->Kind==TRANSPORT_KIND_CAN)
+        {
+            /*Frames left from a previous session would land in the new image*/
+            while(CAN_ReadBroadcast((CAN_t)BL_Transport->Channel, &Local_Sequence, Local_Data)==true)
+            {
+                /*Do Nothing*/
+            }
+            /*The broadcast never reaches the bootloader sectors*/
+            if((Local_Length!=0U) && (Local_Length<=(BL_FANOUT_MAX_FRAMES*BL_FANOUT_FRAME_LEN)) &&
+               (Local_StartAddress>=(FLASH_START_ADDRESS+(BL_FLASH_BOOT_SECTORS*FLASH_SECTOR_SIZE))) &&
+               ((Local_StartAddress+Local_Length)<=FLASH_END_ADDRESS))
+            {
+                BL_FanoutAddress=Local_StartAddress;
+                BL_FanoutLength=Local_Length;
+                BL_FanoutFrames=(uint16_t)((Local_Length+BL_FANOUT_FRAME_LEN-1U)/BL_FANOUT_FRAME_LEN);
+                Local_State=BL_FANOUT_ACTIVE;
+            }
+        }
+        else
+        {
+            /*Do Nothing*/
+        }
+#else
+        /*No broadcast on a point to point link*/
+        (void)Local_StartAddress;
+        (void)Local_Length;
 #endif
         BL_SendACK(1U);
-        /*Set the Protect Level*/
-        Local_PRState=BL_ProgramRDPHelper(BL_HostBuffer[2]);
-        BL_SendDataToHost((uint8_t*)&Local_PRState, 1);
+        BL_SendDataToHost(&Local_State, 1U);
     }
     else
     {
@@ -671,28 +2242,60 @@ void BL_SetProtectLevel(void)
     }
 }
 
-static void BL_JUmpToUserAppCmd(void)
+/******************************************************************************
+ * \Syntax          : void BL_FanoutStatus(void)
+ * \Description     : Send the number of fan out frames written and a window of
+ *                    the received bitmap, the host resends the missing frames
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_FanoutStatus(void)
 {
-    bool Local_State=false;
+    /*First frame of the window, a multiple of 8*/
+    uint16_t Local_FirstFrame=(uint16_t)BL_HostBuffer[2] | ((uint16_t)BL_HostBuffer[3]<<8);
+    uint8_t Local_Reply[3U+BL_FANOUT_STATUS_WINDOW]={0};
+#if TRANSPORT_CAN_ENABLE==TRANSPORT_ON
+    uint16_t Local_Counter=0U;
+    uint16_t Local_Byte=0U;
+#endif
     if(BL_CRCCheck()==true)
     {
-#if BL_DUBUG_STATUS==BL_DUBUG_ON
-        BL_PrintMesssage("Jumping to User Application\r\n");
-#endif
-        BL_SendACK(1U);
-        /*Make sure that there is Application on the sector*/
-        if(BL_AppAddress!=0U)
-        {
-            Local_State=true;
-            /*Send the Jumping State*/
-            BL_SendDataToHost((uint8_t*)&Local_State, 1);
-            /*Jump to user Application*/
-            BL_JumpToUserAPP();
-        }
-        else
+#if TRANSPORT_CAN_ENABLE==TRANSPORT_ON
+        if(BL_FanoutFrames!=0U)
         {
-            BL_SendDataToHost((uint8_t*)&Local_State, 1);
+            /*The bus keeps the frame order, every frame sent before this command is already queued*/
+            while(BL_FanoutService()==true)
+            {
+                /*Do Nothing*/
+            }
+            BL_CoalesceFlush();
+            /*A block of the session that failed when it was programmed*/
+            if(BL_CoalesceError==true)
+            {
+                BL_CoalesceError=false;
+                BL_FanoutError=true;
+            }
+            Local_Reply[0]=(BL_FanoutError==true) ? BL_FANOUT_FAILED : BL_FANOUT_ACTIVE;
+            Local_Reply[1]=(uint8_t)BL_FanoutReceived;
+            Local_Reply[2]=(uint8_t)(BL_FanoutReceived>>8);
+            for(Local_Counter=0U;Local_Counter<BL_FANOUT_STATUS_WINDOW;Local_Counter++)
+            {
+                Local_Byte=(uint16_t)((Local_FirstFrame>>3)+Local_Counter);
+                if(Local_Byte<((BL_FanoutFrames+7U)/8U))
+                {
+                    Local_Reply[3U+Local_Counter]=(uint8_t)(BL_FanoutMap[Local_Byte>>2]>>((Local_Byte & 3U)*8U));
+                }
+            }
         }
+#else
+        (void)Local_FirstFrame;
+#endif
+        BL_SendACK(sizeof(Local_Reply));
+        BL_SendDataToHost(Local_Reply, sizeof(Local_Reply));
     }
     else
     {
@@ -700,6 +2303,55 @@ static void BL_JUmpToUserAppCmd(void)
     }
 }
 
+/******************************************************************************
+ * \Syntax          : bool BL_FanoutService(void)
+ * \Description     : Write the next queued fan out frame, called while a
+ *                    packet is received
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false (no frame taken)
+ *******************************************************************************/
+static bool BL_FanoutService(void)
+{
+    bool Local_State=false;
+#if TRANSPORT_CAN_ENABLE==TRANSPORT_ON
+    uint16_t Local_Sequence=0U;
+    uint8_t Local_Data[BL_FANOUT_FRAME_LEN];
+    uint32_t Local_Offset=0U;
+    uint32_t Local_Length=BL_FANOUT_FRAME_LEN;
+    /*The frames wait in their ring while the flash engine runs a pipelined write or an erase ahead*/
+    if((BL_Transport->Ops->Kind==TRANSPORT_KIND_CAN) && (BL_PipeState!=BL_PIPE_PENDING) && (BL_EraseJob==false) &&
+       (CAN_ReadBroadcast((CAN_t)BL_Transport->Channel, &Local_Sequence, Local_Data)==true))
+    {
+        Local_State=true;
+        /*Frames of no session and frames resent for another node are dropped*/
+        if((Local_Sequence<BL_FanoutFrames) && ((BL_FanoutMap[Local_Sequence>>5] & (1UL<<(Local_Sequence & 31U)))==0U))
+        {
+            Local_Offset=(uint32_t)Local_Sequence*BL_FANOUT_FRAME_LEN;
+            if((BL_FanoutLength-Local_Offset)<Local_Length)
+            {
+                Local_Length=BL_FanoutLength-Local_Offset;
+            }
+            /*Consecutive frames are collected into write buffer bursts*/
+            if(BL_PerformFlashWrite(Local_Data, BL_FanoutAddress+Local_Offset, (uint16_t)Local_Length)==true)
+            {
+                BL_FanoutMap[Local_Sequence>>5]|=(1UL<<(Local_Sequence & 31U));
+                BL_FanoutReceived++;
+            }
+            else
+            {
+                BL_FanoutError=true;
+            }
+        }
+    }
+#endif
+    return Local_State;
+}
+
 /*TODO: : Future Work Implement this Function here and in host script*/
 void BL_SetWriteProtoect(void)
 {
@@ -717,10 +2369,167 @@ void BL_ReadOTP(void)
 
 }
 
-/*TODO: : Future Work Implement this Function here and in host script*/
+/******************************************************************************
+ * \Syntax          : uint8_t BL_ReadAccessCheck(uint32_t Copy_Address,uint32_t Copy_Length)
+ * \Description     : Check a range can be read back by the host, it must lie
+ *                    in one memory and no flash block of it may be execute only
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Address: Start of the range
+ *                    Copy_Length:  Range length
+ * \Parameters (out): None
+ * \Return value:   : uint8_t
+ *                    BL_READ_INVALID - BL_READ_OK - BL_READ_PROTECTED
+ *******************************************************************************/
+static uint8_t BL_ReadAccessCheck(uint32_t Copy_Address,uint32_t Copy_Length)
+{
+    uint8_t Local_ReadState=BL_READ_INVALID;
+    uint32_t Local_Block=0U;
+    if((Copy_Length==0U) || (Copy_Length>(FLASH_END_ADDRESS-FLASH_START_ADDRESS)))
+    {
+        /*Do Nothing*/
+    }
+    else if((Copy_Address>=FLASH_START_ADDRESS) && (Copy_Address<FLASH_END_ADDRESS) && (Copy_Length<=(FLASH_END_ADDRESS-Copy_Address)))
+    {
+        Local_ReadState=BL_READ_OK;
+        /*Execute only blocks must not leak through the bootloader*/
+        for(Local_Block=Copy_Address-(Copy_Address%BL_FLASH_PROTECT_BLOCK);Local_Block<(Copy_Address+Copy_Length);Local_Block+=BL_FLASH_PROTECT_BLOCK)
+        {
+            if(FlashProtectGet(Local_Block)==FlashExecuteOnly)
+            {
+                Local_ReadState=BL_READ_PROTECTED;
+                break;
+            }
+        }
+    }
+    else if((Copy_Address>=SRAM_START_ADDRESS) && (Copy_Address<SRAM_END_ADDRESS) && (Copy_Length<=(SRAM_END_ADDRESS-Copy_Address)))
+    {
+        Local_ReadState=BL_READ_OK;
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    return Local_ReadState;
+}
+
+/******************************************************************************
+ * \Syntax          : void BL_ReadMem(void)
+ * \Description     : Stream a memory range back to the host in CRC protected
+ *                    back to back frames
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
 static void BL_ReadMem(void)
 {
+    uint32_t Local_StartAddress=*((uint32_t*)(BL_HostBuffer+2));
+    uint32_t Local_Length=*((uint32_t*)(BL_HostBuffer+6));
+    uint8_t Local_ReadState=BL_READ_INVALID;
+    uint16_t Local_Chunk=0U;
+    uint8_t Local_ChunkHeader[2]={0};
+    uint32_t Local_ChunkCRC=0U;
+    if(BL_CRCCheck()==true)
+    {
+        Local_ReadState=BL_ReadAccessCheck(Local_StartAddress, Local_Length);
+        BL_SendACK(1U);
+        BL_SendDataToHost(&Local_ReadState, 1U);
+        /*The data is sent straight from memory, the transmit ring keeps the line busy*/
+        while((Local_ReadState==BL_READ_OK) && (Local_Length>0U))
+        {
+            Local_Chunk=(Local_Length>BL_READ_CHUNK_SIZE) ? BL_READ_CHUNK_SIZE : (uint16_t)Local_Length;
+            Local_ChunkHeader[0]=(uint8_t)Local_Chunk;
+            Local_ChunkHeader[1]=(uint8_t)(Local_Chunk>>8);
+            Local_ChunkCRC=CRC32_Calculate(Local_ChunkHeader, 2U);
+            Local_ChunkCRC=CRC32_Update(Local_ChunkCRC, FLS_MEMORY(Local_StartAddress), Local_Chunk);
+            BL_SendDataToHost(Local_ChunkHeader, 2U);
+            BL_SendDataToHost((uint8_t*)FLS_MEMORY(Local_StartAddress), Local_Chunk);
+            BL_SendDataToHost((uint8_t*)&Local_ChunkCRC, 4U);
+            Local_StartAddress+=Local_Chunk;
+            Local_Length-=Local_Chunk;
+        }
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+        BL_PrintMesssage("Read Memory State %d\r\n",Local_ReadState);
+#endif
+    }
+    else
+    {
+        BL_SendNACK();
+    }
+}
 
+/******************************************************************************
+ * \Syntax          : void BL_GetStats(void)
+ * \Description     : Send a range of the cycle profiling table, optionally
+ *                    clear the table once it is sent
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void BL_GetStats(void)
+{
+    uint8_t Local_Header[6]={0};
+#if PROF_STATUS==PROF_ON
+    uint8_t Local_First=BL_HostBuffer[2];
+    uint8_t Local_Number=BL_HostBuffer[3];
+    uint8_t Local_Flags=BL_HostBuffer[4];
+    uint32_t Local_Clock=SysCtlClockGet();
+    uint32_t Local_Fields[4]={0};
+    const PROF_Entry_t* Local_Entry=NULL;
+    uint8_t Local_Counter=0U;
+#endif
+    if(BL_CRCCheck()==true)
+    {
+#if PROF_STATUS==PROF_ON
+        /*The clock lets the host turn the cycles into time*/
+        Local_Header[1]=PROF_ENTRIES_NUM;
+        Local_Header[2]=(uint8_t)Local_Clock;
+        Local_Header[3]=(uint8_t)(Local_Clock>>8);
+        Local_Header[4]=(uint8_t)(Local_Clock>>16);
+        Local_Header[5]=(uint8_t)(Local_Clock>>24);
+        if((Local_Number<=BL_STATS_MAX_ENTRIES) && ((Local_First+Local_Number)<=PROF_ENTRIES_NUM))
+        {
+            Local_Header[0]=BL_STATS_OK;
+            BL_SendACK(sizeof(Local_Header)+(Local_Number*sizeof(Local_Fields)));
+            BL_SendDataToHost(Local_Header, sizeof(Local_Header));
+            for(Local_Counter=0U;Local_Counter<Local_Number;Local_Counter++)
+            {
+                Local_Entry=PROF_GetEntry(Local_First+Local_Counter);
+                Local_Fields[0]=Local_Entry->Count;
+                Local_Fields[1]=Local_Entry->Min;
+                Local_Fields[2]=Local_Entry->Max;
+                Local_Fields[3]=(Local_Entry->Count!=0U) ? (uint32_t)(Local_Entry->Total/Local_Entry->Count) : 0U;
+                BL_SendDataToHost((uint8_t*)Local_Fields, sizeof(Local_Fields));
+            }
+            if((Local_Flags & BL_STATS_RESET)!=0U)
+            {
+                PROF_Reset();
+            }
+        }
+        else
+        {
+            Local_Header[0]=BL_STATS_INVALID;
+            BL_SendACK(sizeof(Local_Header));
+            BL_SendDataToHost(Local_Header, sizeof(Local_Header));
+        }
+#else
+        /*Production build, the profiling is compiled out*/
+        Local_Header[0]=BL_STATS_DISABLED;
+        BL_SendACK(sizeof(Local_Header));
+        BL_SendDataToHost(Local_Header, sizeof(Local_Header));
+#endif
+    }
+    else
+    {
+        BL_SendNACK();
+    }
 }
 
 /**********************************************************************************************************************
@@ -739,22 +2548,81 @@ static void BL_ReadMem(void)
  *******************************************************************************/
 void BL_FetchHostCommand(void)
 {
+    uint8_t Local_Ack=0U;
     /*Receive the Packet Length from Host*/
-    BL_ReceiveDataFromHost(&BL_HostBuffer[0], 1);
+    BL_ReceiveDataFromHost(&BL_FrameHeader[0], 1);
 #if BL_DUBUG_STATUS==BL_DUBUG_ON
     BL_PrintMesssage("Bootloader Starts\r\n");
 #endif
-    /*Receive the Reset of packet from Host*/
-    BL_ReceiveDataFromHost(&BL_HostBuffer[1], BL_HostBuffer[0]);
-    BL_Command=BL_HostBuffer[1]-BL_GET_VER;
-    if(BL_HostBuffer[1]<=BL_JUMP_TO_USER_APP)
+    if(BL_FrameHeader[0]==BL_EXT_FRAME_MARKER)
+    {
+        /*Extended frame, the 16-bit length follows the marker*/
+        BL_ReceiveDataFromHost(&BL_FrameHeader[1], 2);
+        BL_FrameHeaderLen=BL_EXT_HEADER_LEN;
+        BL_FrameLen=(uint16_t)BL_FrameHeader[1] | ((uint16_t)BL_FrameHeader[2]<<8);
+    }
+    else
     {
-        /*Call the appropriate Function to Fetch the Command*/
-        BL_FuncPtrArr[BL_Command]();
+        BL_FrameHeaderLen=1U;
+        BL_FrameLen=BL_FrameHeader[0];
+    }
+    BL_HostBuffer[0]=BL_FrameHeader[0];
+    if(BL_FrameHeader[0]==BL_WAKE_BYTE)
+    {
+        /*Host holding the bootloader after reset, it repeats the byte until this ACK*/
+        Local_Ack=BL_ACK;
+        BL_SendDataToHost(&Local_Ack, 1U);
+    }
+    else if((BL_FrameLen<BL_MIN_FRAME_LEN) || (BL_FrameLen>BL_MAX_FRAME_LEN))
+    {
+        /*Drop the frame and let the host retry*/
+        BL_DiscardFromHost(BL_FrameLen);
+        BL_SendNACK();
     }
     else
     {
-        BL_PrintMesssage("Wrong Message ID From Host!!");
+        /*Receive the Reset of packet from Host, the command is always at BL_HostBuffer[1]*/
+        PROF_START(PROF_ID_RECEIVE);
+        BL_ReceiveDataFromHost(&BL_HostBuffer[1], BL_FrameLen);
+        PROF_STOP(PROF_ID_RECEIVE);
+        BL_Command=BL_HostBuffer[1]-BL_GET_VER;
+        if((BL_HostBuffer[1]>=BL_GET_VER) && (BL_HostBuffer[1]<=BL_GET_STATS))
+        {
+            if((BL_HostBuffer[1]!=BL_PIPE_WRITE_MEM) && (BL_HostBuffer[1]!=BL_STREAM_WRITE))
+            {
+                /*Other commands must see the flash with the pipelined writes committed*/
+                BL_PipeSync();
+                BL_EraseAheadSync();
+                /*And end a stream the host left without its end frame*/
+                BL_StreamOpen=false;
+            }
+            if(BL_HostBuffer[1]!=BL_WRITE_MEM)
+            {
+                /*And with the tail of the coalesced writes programmed*/
+                BL_CoalesceFlush();
+                if(BL_WriteSequence==true)
+                {
+                    /*The host ended the write sequence without its empty frame, nobody is told of a failed tail but the verify and the jump*/
+                    BL_WriteSequence=false;
+                    if(BL_CoalesceError==true)
+                    {
+                        BL_CoalesceError=false;
+                        BL_CoalesceLost=true;
+                    }
+                }
+            }
+            /*Call the appropriate Function to Fetch the Command*/
+            PROF_START(PROF_ID_COMMAND+BL_Command);
+            BL_FuncPtrArr[BL_Command]();
+            PROF_STOP(PROF_ID_COMMAND+BL_Command);
+        }
+        else
+        {
+            BL_SendNACK();
+#if BL_DUBUG_STATUS==BL_DUBUG_ON
+            BL_PrintMesssage("Wrong Message ID From Host!!\r\n");
+#endif
+        }
     }
 }
 /**********************************************************************************************************************
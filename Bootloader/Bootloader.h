@@ -28,38 +28,26 @@
 #define SRAM_START_ADDRESS      SRAM_BASE
 #define SRAM_END_ADDRESS        (SRAM_BASE+32*1024UL)
 #define FLASH_SECTOR_SIZE       1024UL
-#define BL_HOST_BUFFER_SIZE     300U
+/* Sectors holding the bootloader itself, never erased (a mass erase wipes the sectors after them) */
+#define BL_FLASH_BOOT_SECTORS   32U
+/* Large enough for a full flash sector in one extended frame:
+ * length header + BL_STREAM_WRITE header + 1 KB payload + CRC */
+#define BL_HOST_BUFFER_SIZE     1040U
 
-/* Set the Debug State
+/* Number of BL_STREAM_WRITE frames the host may send ahead of the first
+ * unacknowledged one (max 32), the host window must not be larger */
+#define BL_STREAM_WINDOW        4U
+
+/* Time the host has to send UARTBAUD_PING at the new rate after BL_SET_BAUD
+ * before the bootloader falls back to the previous rate */
+#define BL_BAUD_PING_TIMEOUT_MS 1000U
+
+/* Set the Debug State, the messages go to the host over the active transport
  * BL_DEBUG_OFF
  * BL_DUBUG_ON */
 #define BL_DUBUG_STATUS         BL_DUBUG_OFF
 
-/* Set the Dubug Method
- * BL_UART_DEBUG
- * BL_CAN_DUBUG  */
-#define BL_DEBUG_METHODE        BL_UART_DEBUG
-
-/* Set the Debug UART Peripheral
- * UART_0
- * UART_1
- * UART_2
- * UART_3
- * UART_4
- * UART_5
- * UART_6
- * UART_7 */
-#define BL_DEBUG_UART           UART_0
-
-/* Set the Communication Protocol with Host
- * BL_UART_COMM
- * BL_CAN_COMM  */
-#define BL_COMM_PROTOCOL        BL_UART_COMM
-
-/* Set the Communication Method
- * UART_0:7
- * CAN0 : 1 */
-#define BL_COMM_METHODE         UART_0
+/* The host link is picked at run time among the interfaces enabled in Transport.h */
 
 /**********************************************************************************************************************
  *  LOCAL MACROS CONSTANT\FUNCTION
@@ -77,309 +65,94 @@
 #define BL_READ_OTP             0x1A
 #define BL_SET_RDP_LEVEL        0x1B
 #define BL_JUMP_TO_USER_APP     0x1C
+#define BL_PIPE_WRITE_MEM       0x1D
+#define BL_STREAM_WRITE         0x1E
+#define BL_SET_BAUD             0x1F
+#define BL_GET_SECTOR_CRC       0x20
+#define BL_COMPRESSED_WRITE     0x21
+#define BL_VERIFY_CRC           0x22
+#define BL_ERASE_AHEAD          0x23
+#define BL_FANOUT_START         0x24
+#define BL_FANOUT_STATUS        0x25
+#define BL_GET_STATS            0x26
 
 #define BL_MASS_ERASE           0xff
 
+/* Result of every sector of a BL_ERASE_FLASH, packed 4 per byte after the overall state, sector 0 in bits 1:0 */
+#define BL_SECTOR_ERASED        0x00
+#define BL_SECTOR_BLANK         0x01
+#define BL_SECTOR_FAILED        0x02
+#define BL_SECTOR_PROTECTED     0x03
+
 #define BL_VENDOR_ID            0x10
 #define BL_SW_MAJOR_VERSION     1U
-#define BL_SW_MANOR_VERSION     0U
+#define BL_SW_MANOR_VERSION     1U
 #define BL_SW_PATCH_VERSION     0U
 
+/* Frame formats, reported to the host by BL_GET_VER after the version bytes
+ * Legacy:   [Len][Cmd][Args..][CRC32]              Len = bytes after it (<=255)
+ * Extended: [0x00][LenLo][LenHi][Cmd][Args..][CRC32] CRC covers the 3 bytes header too */
+#define BL_FRAME_VERSION        0x02
+#define BL_EXT_FRAME_MARKER     0x00
+#define BL_EXT_HEADER_LEN       3U
+/* Smallest frame after the length header: command + CRC */
+#define BL_MIN_FRAME_LEN        (1U+BL_CRC_LEN)
+#define BL_MAX_FRAME_LEN        (BL_HOST_BUFFER_SIZE-1U)
+
 #define BL_ACK                  0xCD
 #define BL_NACK                 0xAB
+/* Shorter than any frame, answered with a single BL_ACK: the host repeats it from reset on to keep the bootloader */
+#define BL_WAKE_BYTE            0x01
+
+/* Commit state of the last BL_PIPE_WRITE_MEM packet, the first three are reported to the host */
+#define BL_PIPE_FAILED          0x00
+#define BL_PIPE_PASSED          0x01
+#define BL_PIPE_NONE            0x02
+#define BL_PIPE_PENDING         0x03
+
+/* Flags of BL_COMPRESSED_WRITE, START resets the decoder at the frame address, END flushes the staging buffer */
+#define BL_CWRITE_START         0x01
+#define BL_CWRITE_END           0x02
+
+/* Status of BL_READ_MEM, BL_VERIFY_CRC and BL_GET_SECTOR_CRC, the data frames [LenLo][LenHi][Data][CRC32]
+ * of BL_READ_MEM follow BL_READ_OK */
+#define BL_READ_INVALID         0x00
+#define BL_READ_OK              0x01
+#define BL_READ_PROTECTED       0x02
+/* BL_VERIFY_CRC only, a BL_WRITE_MEM sequence the host ended without its empty frame failed to program */
+#define BL_READ_WRITE_FAILED    0x03
+#define BL_READ_CHUNK_SIZE      1024U
+
+/* BL_WRITE_MEM payloads are collected per flash write buffer block, no block is being collected */
+#define BL_COALESCE_EMPTY       0xFFFFFFFFUL
+#define BL_FLASH_PROTECT_BLOCK  2048UL
+
+/* Fan out download (CAN): frame N of the broadcast carries the 8 image bytes at offset 8*N,
+ * a status reply holds the received bitmap of BL_FANOUT_STATUS_WINDOW*8 frames */
+#define BL_FANOUT_IDLE          0x00
+#define BL_FANOUT_ACTIVE        0x01
+#define BL_FANOUT_FAILED        0x02
+#define BL_FANOUT_FRAME_LEN     8U
+#define BL_FANOUT_MAX_FRAMES    (((BL_FLASH_SECTORS_NUM-BL_FLASH_BOOT_SECTORS)*FLASH_SECTOR_SIZE)/BL_FANOUT_FRAME_LEN)
+#define BL_FANOUT_STATUS_WINDOW 128U
+
+/* State of BL_GET_STATS, followed by the number of entries, the CPU clock and the
+ * requested entries [Count][Min][Max][Avg] in cycles, 32-bit little endian each */
+#define BL_STATS_DISABLED       0x00
+#define BL_STATS_OK             0x01
+#define BL_STATS_INVALID        0x02
+#define BL_STATS_RESET          0x01
+#define BL_STATS_MAX_ENTRIES    15U
 
-#define BL_UART_DEBUG           0x01
-#define BL_CAN_DUBUG            0x02
 #define BL_DEBUG_OFF            0x01
 #define BL_DUBUG_ON             0x02
-#define BL_UART_COMM            0x01
-#define BL_CAN_COMM             0x02
 #define BL_CRC_LEN              4U
 #define BL_FLASH_SECTORS_NUM    256U
+/* Most sector CRCs in one BL_GET_SECTOR_CRC reply, status + CRCs must fit the 8-bit Length to Follow */
+#define BL_SECTOR_CRC_MAX       60U
 
-#define DID_REG                 ((*((uint32_t*)(SYSCTL_BASE+4U)))>>16U)
-#define VTABLE_REG              (*((volatile unsigned int*)0xE000ED08))
-
-/**********************************************************************************************************************
- *  LOCAL FUNCTION PROTOTYPES
- *********************************************************************************************************************/
-
-/******************************************************************************
- * \Syntax          : void BL_PrintMesssage(char *Copy_Format,...)
- * \Description     : Variatic Function used to send Messages to debug port
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : Copy_Format: The Format of Sent Data
- * \Parameters (out): None
- * \Return value:   : void
- *******************************************************************************/
-static void BL_PrintMesssage(char *Copy_Format,...);
-
-/************************************************************************************************
- * \Syntax          : void BL_SendDataToHost(uint8_t* Copy_HostBuffer,uint8_t Copy_DataLen)
- * \Description     : Send Data to Host
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : Copy_HostBuffer: Buffer sent to Host
- *                    Copy_DataLen: the Length of Buffer being sent to Host
- * \Parameters (out): None
- * \Return value:   : void
- ************************************************************************************************/
-static void BL_SendDataToHost(uint8_t* Copy_HostBuffer,uint8_t Copy_DataLen);
-
-/************************************************************************************************
- * \Syntax          : void BL_ReceiveDataFromHost(uint8_t* Copy_HostBuffer,uint8_t Copy_DataLen)
- * \Description     : Send Data to Host
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : Copy_HostBuffer: Buffer Received from Host
- *                    Copy_DataLen: the Length of Buffer being Received from Host
- * \Parameters (out): None
- * \Return value:   : void
- ************************************************************************************************/
-static void BL_ReceiveDataFromHost(uint8_t* Copy_HostBuffer,uint8_t Copy_DataLen);
-
-/********************************************************************************************************
- * \Syntax          : bool BL_PerformFlashErase(uint8_t Copy_FirstSector,uint8_t Copy_NumofSectors)
- * \Description     : Erase Number of Sectors from Flash memory
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : Copy_FirstSector:  The sector start erasing from
- *                    Copy_NumofSectors: Number of Sectors to be Erased
- * \Parameters (out): None
- * \Return value:   : bool
- *                    true - false
- **********************************************************************************************************/
-static bool BL_PerformFlashErase(uint8_t Copy_FirstSector,uint8_t Copy_NumofSectors);
-
-/******************************************************************************
- * \Syntax          : uint8_t BL_RDPHelper(void)
- * \Description     : Read the Read Protection Level Helper Function
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : None
- * \Parameters (out): None
- * \Return value:   : uint8_t
- *                    The Read Protection Level
- *******************************************************************************/
-static uint8_t BL_RDPHelper(void);
-
-/************************************************************************************
- * \Syntax          : bool BL_ProgramRDPHelper(uint8_t Copy_PL)
- * \Description     : Helper function to set the protection Level of flash sector
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : Copy_PL:  Protection Level to be set
- * \Parameters (out): None
- * \Return value:   : bool
- *                    true - false
- ************************************************************************************/
-static bool BL_ProgramRDPHelper(uint8_t Copy_PL);
-
-/**************************************************************************************************************************
- * \Syntax          : bool BL_PerformFlashWrite(uint8_t* Copy_HostPayload,uint32_t Copy_StartAddress,uint8_t Copy_DataLen)
- * \Description     : Perform the write operation on flash
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : Copy_Address Address to be verified
- * \Parameters (out): None
- * \Return value:   : bool
- *                    true - false
- **************************************************************************************************************************/
-static bool BL_PerformFlashWrite(uint8_t* Copy_HostPayload,uint32_t Copy_StartAddress,uint8_t Copy_DataLen);
-
-/******************************************************************************
- * \Syntax          : uint32_t Calculate_CRC32(const uint8_t *Buffer, uint8_t Buffer_Length)
- * \Description     : Calculate the CRC for Data Sent From Host
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : Buffer:        Data to Calculate the CRC for
- *                    Buffer_Length: Data Length
- * \Parameters (out): None
- * \Return value:   : uint32_t
- *                    The Calculated CRC
- *******************************************************************************/
-static uint32_t Calculate_CRC32(const uint8_t *Buffer, uint8_t Buffer_Length);
-
-/******************************************************************************
- * \Syntax          : bool BL_CRCCheck(void)
- * \Description     : Check for CRC Sent by the Host
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : Copy_Address Address to be verified
- * \Parameters (out): None
- * \Return value:   : bool
- *                    true - false
- *******************************************************************************/
-static bool BL_CRCCheck(void);
-
-/*************************************************************************************************
- * \Syntax          : void BL_SendACK(uint8_t Copy_ReplyLen)
- * \Description     : Send ACK + Length to Follow to host in case of CRC verification Passed
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : Copy_ReplyLen : The Reply length to be followed by ACK
- * \Parameters (out): None
- * \Return value:   : void
- *************************************************************************************************/
-static void BL_SendACK(uint8_t Copy_ReplyLen);
-
-/******************************************************************************
- * \Syntax          : void BL_SendNACK(void)
- * \Description     : Send Not ACK to host in case of CRC verification failed
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : None
- * \Parameters (out): None
- * \Return value:   : void
- *******************************************************************************/
-static void BL_SendNACK(void);
-
-/******************************************************************************
- * \Syntax          : bool BL_AddressVerification(uint32_t Copy_Address)
- * \Description     : Verify the Address sent by host is in range of memory
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Reentrant
- * \Parameters (in) : Copy_Address Address to be verified
- * \Parameters (out): None
- * \Return value:   : bool
- *                    true - false
- *******************************************************************************/
-static bool BL_AddressVerification(uint32_t Copy_Address);
-
-/******************************************************************************
- * \Syntax          : void BL_JumpToUserAPP(void)
- * \Description     : Send the Bootloader version to host
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : None
- * \Parameters (out): None
- * \Return value:   : void
- *******************************************************************************/
-static void BL_JumpToUserAPP(void);
-
-/******************************************************************************
- * \Syntax          : void BL_GetVersion(void)
- * \Description     : Send the Bootloader version to host
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : None
- * \Parameters (out): None
- * \Return value:   : void
- *******************************************************************************/
-static void BL_GetVersion(void);
-
-/******************************************************************************
- * \Syntax          : void BL_GetHelp(void)
- * \Description     : Send the Commands codes to host
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : None
- * \Parameters (out): None
- * \Return value:   : void
- *******************************************************************************/
-static void BL_GetHelp(void);
-
-/******************************************************************************
- * \Syntax          : void BL_GetChipID(void)
- * \Description     : Get the chip Identification Number
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : None
- * \Parameters (out): None
- * \Return value:   : void
- *******************************************************************************/
-static void BL_GetChipID(void);
-
-/******************************************************************************
- * \Syntax          : void BL_GoToAdd(void)
- * \Description     : Go to specific Memory Address
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : None
- * \Parameters (out): None
- * \Return value:   : void
- *******************************************************************************/
-static void BL_GoToAdd(void);
-
-/******************************************************************************
- * \Syntax          : void BL_EraseFlash(void)
- * \Description     : Erase Number of blocks from flash
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : None
- * \Parameters (out): None
- * \Return value:   : void
- *******************************************************************************/
-static void BL_EraseFlash(void);
-
-/******************************************************************************
- * \Syntax          : void BL_WriteMem(void)
- * \Description     : Write Data to specific Memory Address
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : None
- * \Parameters (out): None
- * \Return value:   : void
- *******************************************************************************/
-static void BL_WriteMem(void);
-
-/******************************************************************************
- * \Syntax          : void BL_ReadProtectLevel(void)
- * \Description     : Get the Read Protect Level
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : None
- * \Parameters (out): None
- * \Return value:   : void
- *******************************************************************************/
-static void BL_ReadProtectLevel(void);
-
-/******************************************************************************
- * \Syntax          : void BL_SetProtectLevel(void)
- * \Description     : Set the Read Protect Level
- *
- * \Sync\Async      : Synchronous
- * \Reentrancy      : Non Reentrant
- * \Parameters (in) : None
- * \Parameters (out): None
- * \Return value:   : void
- *******************************************************************************/
-void BL_SetProtectLevel(void);
-
-static void BL_JUmpToUserAppCmd(void);
-
-/*TODO: : Future Work Implement this Function here and in host script*/
-void BL_SetWriteProtoect(void);
-
-/*TODO: : Future Work Implement this Function here and in host script*/
-void BL_GetWriteProtoectState(void);
-
-/*TODO: : Future Work Implement this Function here and in host script*/
-void BL_ReadOTP(void);
-
-/*TODO: : Future Work Implement this Function here and in host script*/
-static void BL_ReadMem(void);
+#define DID_REG                 (HWREG(SYSCTL_DID1)>>16U)
+#define VTABLE_REG              HWREG(NVIC_VTABLE)
 
 /**********************************************************************************************************************
  *  GLOBAL FUNCTION PROTOTYPES
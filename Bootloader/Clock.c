@@ -0,0 +1,68 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *       Author:  Mahmoud Badr
+ *         File:  Clock.c
+ *        Layer:  App
+ *       Module:  Clock
+ *      Version:  1.00
+ *
+ *  Description:  System clock profile, see Clock.h.
+ *                SysCtlClockSet waits for the PLL lock with a timeout but leaves the bypass even when the wait
+ *                timed out, the CPU would already run on an unlocked PLL when the lock bit is checked. The PLL is
+ *                started with the bypass kept instead, SysCtlClockSet only leaves it once the PLL locked.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "Clock.h"
+#include "inc/hw_types.h"
+#include "inc/hw_sysctl.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/******************************************************************************
+ * \Syntax          : void CLOCK_Init(void)
+ * \Description     : Switch the system clock to CLOCK_PROFILE, or to CLOCK_FALLBACK when its
+ *                    PLL doesn't lock
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void CLOCK_Init(void)
+{
+    uint32_t Local_Polls=CLOCK_LOCK_POLLS;
+    /*The PLL is used unless the profile bypasses it*/
+    if((CLOCK_PROFILE & SYSCTL_USE_OSC)!=SYSCTL_USE_OSC)
+    {
+        /*Start the PLL of the profile, the CPU stays on the oscillator meanwhile*/
+        SysCtlClockSet(CLOCK_PROFILE | SYSCTL_RCC_BYPASS);
+        while((Local_Polls!=0U) && ((HWREG(SYSCTL_PLLSTAT) & SYSCTL_PLLSTAT_LOCK)==0U))
+        {
+            Local_Polls--;
+        }
+        if(Local_Polls!=0U)
+        {
+            /*Locked, the same configuration doesn't restart the PLL, only the bypass is left*/
+            SysCtlClockSet(CLOCK_PROFILE);
+        }
+        else
+        {
+            SysCtlClockSet(CLOCK_FALLBACK);
+        }
+    }
+    else
+    {
+        SysCtlClockSet(CLOCK_PROFILE);
+    }
+}
+/**********************************************************************************************************************
+ *  END OF FILE: Clock.c
+ *********************************************************************************************************************/
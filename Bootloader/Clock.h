@@ -0,0 +1,77 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *       Author:  Mahmoud Badr
+ *         File:  Clock.h
+ *        Layer:  App
+ *       Module:  Clock
+ *      Version:  1.00
+ *
+ *  Description:  System clock profile of the bootloader. CLOCK_Init runs once after reset, before any interface is
+ *                opened: every rate derived from the clock (UART divisors, CAN bit timing, SysTick, the SysCtlDelay
+ *                waits, the cycle counts of BL_GET_STATS) is calculated from SysCtlClockGet when it is configured,
+ *                so it follows the profile. The flash and EEPROM controllers time their operations on their own
+ *                clock, only the CPU work around them gets faster. A PLL that doesn't lock (no crystal, wrong
+ *                CLOCK_XTAL) leaves the bootloader on CLOCK_FALLBACK instead of a stalled or unknown clock.
+ *
+ *********************************************************************************************************************/
+
+#ifndef CLOCK_H_
+#define CLOCK_H_
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib/sysctl.h"
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/* Crystal of the main oscillator, 16 MHz on the LaunchPad */
+#ifndef CLOCK_XTAL
+#define CLOCK_XTAL              SYSCTL_XTAL_16MHZ
+#endif
+
+/* Profiles, SysCtlClockSet configurations. The PLL runs at 400 MHz, the reset clock is the 16 MHz PIOSC */
+#define CLOCK_PLL_80MHZ         (SYSCTL_SYSDIV_2_5 | SYSCTL_USE_PLL | SYSCTL_OSC_MAIN | CLOCK_XTAL)
+#define CLOCK_PLL_50MHZ         (SYSCTL_SYSDIV_4 | SYSCTL_USE_PLL | SYSCTL_OSC_MAIN | CLOCK_XTAL)
+#define CLOCK_PLL_40MHZ         (SYSCTL_SYSDIV_5 | SYSCTL_USE_PLL | SYSCTL_OSC_MAIN | CLOCK_XTAL)
+#define CLOCK_MOSC_16MHZ        (SYSCTL_SYSDIV_1 | SYSCTL_USE_OSC | SYSCTL_OSC_MAIN | CLOCK_XTAL)
+#define CLOCK_PIOSC_16MHZ       (SYSCTL_SYSDIV_1 | SYSCTL_USE_OSC | SYSCTL_OSC_INT | SYSCTL_MAIN_OSC_DIS)
+
+/* Clock of the bootloader, CLOCK_PIOSC_16MHZ: keep the clock after reset */
+#ifndef CLOCK_PROFILE
+#define CLOCK_PROFILE           CLOCK_PLL_80MHZ
+#endif
+
+/* Clock when the PLL of CLOCK_PROFILE doesn't lock, it must not use the PLL */
+#ifndef CLOCK_FALLBACK
+#define CLOCK_FALLBACK          CLOCK_PIOSC_16MHZ
+#endif
+
+/* Reads of the PLL lock bit before the fallback, the PLL locks within 512 reference clocks and
+ * the poll runs on the oscillator, as long as the lock wait of SysCtlClockSet */
+#define CLOCK_LOCK_POLLS        32768UL
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+/******************************************************************************
+ * \Syntax          : void CLOCK_Init(void)
+ * \Description     : Switch the system clock to CLOCK_PROFILE, or to CLOCK_FALLBACK when its
+ *                    PLL doesn't lock
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void CLOCK_Init(void);
+
+#endif
+/**********************************************************************************************************************
+ *  END OF FILE: Clock.h
+ *********************************************************************************************************************/
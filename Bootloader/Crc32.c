@@ -0,0 +1,606 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *       Author:  Mahmoud Badr
+ *         File:  Crc32.c
+ *        Layer:  App
+ *       Module:  Crc32
+ *      Version:  1.00
+ *
+ *  Description:  Bitwise, table and sliced implementations of the bootloader CRC32.
+ *                Shifting the register 32 times after XORing a byte is a multiplication by x^32 mod P,
+ *                so the tables below hold (byte << 8k) * x^n mod P and all engines give the same result.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "Crc32.h"
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+#if CRC32_ENGINE!=CRC32_ENGINE_BITWISE
+/* b * x^32 mod P, also the byte-wise table */
+static const uint32_t CRC32_TableS0[256]=
+{
+    0x00000000UL,0x04C11DB7UL,0x09823B6EUL,0x0D4326D9UL,0x130476DCUL,0x17C56B6BUL,
+    0x1A864DB2UL,0x1E475005UL,0x2608EDB8UL,0x22C9F00FUL,0x2F8AD6D6UL,0x2B4BCB61UL,
+    0x350C9B64UL,0x31CD86D3UL,0x3C8EA00AUL,0x384FBDBDUL,0x4C11DB70UL,0x48D0C6C7UL,
+    0x4593E01EUL,0x4152FDA9UL,0x5F15ADACUL,0x5BD4B01BUL,0x569796C2UL,0x52568B75UL,
+    0x6A1936C8UL,0x6ED82B7FUL,0x639B0DA6UL,0x675A1011UL,0x791D4014UL,0x7DDC5DA3UL,
+    0x709F7B7AUL,0x745E66CDUL,0x9823B6E0UL,0x9CE2AB57UL,0x91A18D8EUL,0x95609039UL,
+    0x8B27C03CUL,0x8FE6DD8BUL,0x82A5FB52UL,0x8664E6E5UL,0xBE2B5B58UL,0xBAEA46EFUL,
+    0xB7A96036UL,0xB3687D81UL,0xAD2F2D84UL,0xA9EE3033UL,0xA4AD16EAUL,0xA06C0B5DUL,
+    0xD4326D90UL,0xD0F37027UL,0xDDB056FEUL,0xD9714B49UL,0xC7361B4CUL,0xC3F706FBUL,
+    0xCEB42022UL,0xCA753D95UL,0xF23A8028UL,0xF6FB9D9FUL,0xFBB8BB46UL,0xFF79A6F1UL,
+    0xE13EF6F4UL,0xE5FFEB43UL,0xE8BCCD9AUL,0xEC7DD02DUL,0x34867077UL,0x30476DC0UL,
+    0x3D044B19UL,0x39C556AEUL,0x278206ABUL,0x23431B1CUL,0x2E003DC5UL,0x2AC12072UL,
+    0x128E9DCFUL,0x164F8078UL,0x1B0CA6A1UL,0x1FCDBB16UL,0x018AEB13UL,0x054BF6A4UL,
+    0x0808D07DUL,0x0CC9CDCAUL,0x7897AB07UL,0x7C56B6B0UL,0x71159069UL,0x75D48DDEUL,
+    0x6B93DDDBUL,0x6F52C06CUL,0x6211E6B5UL,0x66D0FB02UL,0x5E9F46BFUL,0x5A5E5B08UL,
+    0x571D7DD1UL,0x53DC6066UL,0x4D9B3063UL,0x495A2DD4UL,0x44190B0DUL,0x40D816BAUL,
+    0xACA5C697UL,0xA864DB20UL,0xA527FDF9UL,0xA1E6E04EUL,0xBFA1B04BUL,0xBB60ADFCUL,
+    0xB6238B25UL,0xB2E29692UL,0x8AAD2B2FUL,0x8E6C3698UL,0x832F1041UL,0x87EE0DF6UL,
+    0x99A95DF3UL,0x9D684044UL,0x902B669DUL,0x94EA7B2AUL,0xE0B41DE7UL,0xE4750050UL,
+    0xE9362689UL,0xEDF73B3EUL,0xF3B06B3BUL,0xF771768CUL,0xFA325055UL,0xFEF34DE2UL,
+    0xC6BCF05FUL,0xC27DEDE8UL,0xCF3ECB31UL,0xCBFFD686UL,0xD5B88683UL,0xD1799B34UL,
+    0xDC3ABDEDUL,0xD8FBA05AUL,0x690CE0EEUL,0x6DCDFD59UL,0x608EDB80UL,0x644FC637UL,
+    0x7A089632UL,0x7EC98B85UL,0x738AAD5CUL,0x774BB0EBUL,0x4F040D56UL,0x4BC510E1UL,
+    0x46863638UL,0x42472B8FUL,0x5C007B8AUL,0x58C1663DUL,0x558240E4UL,0x51435D53UL,
+    0x251D3B9EUL,0x21DC2629UL,0x2C9F00F0UL,0x285E1D47UL,0x36194D42UL,0x32D850F5UL,
+    0x3F9B762CUL,0x3B5A6B9BUL,0x0315D626UL,0x07D4CB91UL,0x0A97ED48UL,0x0E56F0FFUL,
+    0x1011A0FAUL,0x14D0BD4DUL,0x19939B94UL,0x1D528623UL,0xF12F560EUL,0xF5EE4BB9UL,
+    0xF8AD6D60UL,0xFC6C70D7UL,0xE22B20D2UL,0xE6EA3D65UL,0xEBA91BBCUL,0xEF68060BUL,
+    0xD727BBB6UL,0xD3E6A601UL,0xDEA580D8UL,0xDA649D6FUL,0xC423CD6AUL,0xC0E2D0DDUL,
+    0xCDA1F604UL,0xC960EBB3UL,0xBD3E8D7EUL,0xB9FF90C9UL,0xB4BCB610UL,0xB07DABA7UL,
+    0xAE3AFBA2UL,0xAAFBE615UL,0xA7B8C0CCUL,0xA379DD7BUL,0x9B3660C6UL,0x9FF77D71UL,
+    0x92B45BA8UL,0x9675461FUL,0x8832161AUL,0x8CF30BADUL,0x81B02D74UL,0x857130C3UL,
+    0x5D8A9099UL,0x594B8D2EUL,0x5408ABF7UL,0x50C9B640UL,0x4E8EE645UL,0x4A4FFBF2UL,
+    0x470CDD2BUL,0x43CDC09CUL,0x7B827D21UL,0x7F436096UL,0x7200464FUL,0x76C15BF8UL,
+    0x68860BFDUL,0x6C47164AUL,0x61043093UL,0x65C52D24UL,0x119B4BE9UL,0x155A565EUL,
+    0x18197087UL,0x1CD86D30UL,0x029F3D35UL,0x065E2082UL,0x0B1D065BUL,0x0FDC1BECUL,
+    0x3793A651UL,0x3352BBE6UL,0x3E119D3FUL,0x3AD08088UL,0x2497D08DUL,0x2056CD3AUL,
+    0x2D15EBE3UL,0x29D4F654UL,0xC5A92679UL,0xC1683BCEUL,0xCC2B1D17UL,0xC8EA00A0UL,
+    0xD6AD50A5UL,0xD26C4D12UL,0xDF2F6BCBUL,0xDBEE767CUL,0xE3A1CBC1UL,0xE760D676UL,
+    0xEA23F0AFUL,0xEEE2ED18UL,0xF0A5BD1DUL,0xF464A0AAUL,0xF9278673UL,0xFDE69BC4UL,
+    0x89B8FD09UL,0x8D79E0BEUL,0x803AC667UL,0x84FBDBD0UL,0x9ABC8BD5UL,0x9E7D9662UL,
+    0x933EB0BBUL,0x97FFAD0CUL,0xAFB010B1UL,0xAB710D06UL,0xA6322BDFUL,0xA2F33668UL,
+    0xBCB4666DUL,0xB8757BDAUL,0xB5365D03UL,0xB1F740B4UL
+};
+#endif
+
+#if (CRC32_ENGINE==CRC32_ENGINE_SLICE_BY_4)
+/* (b << 8) * x^32 mod P */
+static const uint32_t CRC32_TableS1[256]=
+{
+    0x00000000UL,0xD219C1DCUL,0xA0F29E0FUL,0x72EB5FD3UL,0x452421A9UL,0x973DE075UL,
+    0xE5D6BFA6UL,0x37CF7E7AUL,0x8A484352UL,0x5851828EUL,0x2ABADD5DUL,0xF8A31C81UL,
+    0xCF6C62FBUL,0x1D75A327UL,0x6F9EFCF4UL,0xBD873D28UL,0x10519B13UL,0xC2485ACFUL,
+    0xB0A3051CUL,0x62BAC4C0UL,0x5575BABAUL,0x876C7B66UL,0xF58724B5UL,0x279EE569UL,
+    0x9A19D841UL,0x4800199DUL,0x3AEB464EUL,0xE8F28792UL,0xDF3DF9E8UL,0x0D243834UL,
+    0x7FCF67E7UL,0xADD6A63BUL,0x20A33626UL,0xF2BAF7FAUL,0x8051A829UL,0x524869F5UL,
+    0x6587178FUL,0xB79ED653UL,0xC5758980UL,0x176C485CUL,0xAAEB7574UL,0x78F2B4A8UL,
+    0x0A19EB7BUL,0xD8002AA7UL,0xEFCF54DDUL,0x3DD69501UL,0x4F3DCAD2UL,0x9D240B0EUL,
+    0x30F2AD35UL,0xE2EB6CE9UL,0x9000333AUL,0x4219F2E6UL,0x75D68C9CUL,0xA7CF4D40UL,
+    0xD5241293UL,0x073DD34FUL,0xBABAEE67UL,0x68A32FBBUL,0x1A487068UL,0xC851B1B4UL,
+    0xFF9ECFCEUL,0x2D870E12UL,0x5F6C51C1UL,0x8D75901DUL,0x41466C4CUL,0x935FAD90UL,
+    0xE1B4F243UL,0x33AD339FUL,0x04624DE5UL,0xD67B8C39UL,0xA490D3EAUL,0x76891236UL,
+    0xCB0E2F1EUL,0x1917EEC2UL,0x6BFCB111UL,0xB9E570CDUL,0x8E2A0EB7UL,0x5C33CF6BUL,
+    0x2ED890B8UL,0xFCC15164UL,0x5117F75FUL,0x830E3683UL,0xF1E56950UL,0x23FCA88CUL,
+    0x1433D6F6UL,0xC62A172AUL,0xB4C148F9UL,0x66D88925UL,0xDB5FB40DUL,0x094675D1UL,
+    0x7BAD2A02UL,0xA9B4EBDEUL,0x9E7B95A4UL,0x4C625478UL,0x3E890BABUL,0xEC90CA77UL,
+    0x61E55A6AUL,0xB3FC9BB6UL,0xC117C465UL,0x130E05B9UL,0x24C17BC3UL,0xF6D8BA1FUL,
+    0x8433E5CCUL,0x562A2410UL,0xEBAD1938UL,0x39B4D8E4UL,0x4B5F8737UL,0x994646EBUL,
+    0xAE893891UL,0x7C90F94DUL,0x0E7BA69EUL,0xDC626742UL,0x71B4C179UL,0xA3AD00A5UL,
+    0xD1465F76UL,0x035F9EAAUL,0x3490E0D0UL,0xE689210CUL,0x94627EDFUL,0x467BBF03UL,
+    0xFBFC822BUL,0x29E543F7UL,0x5B0E1C24UL,0x8917DDF8UL,0xBED8A382UL,0x6CC1625EUL,
+    0x1E2A3D8DUL,0xCC33FC51UL,0x828CD898UL,0x50951944UL,0x227E4697UL,0xF067874BUL,
+    0xC7A8F931UL,0x15B138EDUL,0x675A673EUL,0xB543A6E2UL,0x08C49BCAUL,0xDADD5A16UL,
+    0xA83605C5UL,0x7A2FC419UL,0x4DE0BA63UL,0x9FF97BBFUL,0xED12246CUL,0x3F0BE5B0UL,
+    0x92DD438BUL,0x40C48257UL,0x322FDD84UL,0xE0361C58UL,0xD7F96222UL,0x05E0A3FEUL,
+    0x770BFC2DUL,0xA5123DF1UL,0x189500D9UL,0xCA8CC105UL,0xB8679ED6UL,0x6A7E5F0AUL,
+    0x5DB12170UL,0x8FA8E0ACUL,0xFD43BF7FUL,0x2F5A7EA3UL,0xA22FEEBEUL,0x70362F62UL,
+    0x02DD70B1UL,0xD0C4B16DUL,0xE70BCF17UL,0x35120ECBUL,0x47F95118UL,0x95E090C4UL,
+    0x2867ADECUL,0xFA7E6C30UL,0x889533E3UL,0x5A8CF23FUL,0x6D438C45UL,0xBF5A4D99UL,
+    0xCDB1124AUL,0x1FA8D396UL,0xB27E75ADUL,0x6067B471UL,0x128CEBA2UL,0xC0952A7EUL,
+    0xF75A5404UL,0x254395D8UL,0x57A8CA0BUL,0x85B10BD7UL,0x383636FFUL,0xEA2FF723UL,
+    0x98C4A8F0UL,0x4ADD692CUL,0x7D121756UL,0xAF0BD68AUL,0xDDE08959UL,0x0FF94885UL,
+    0xC3CAB4D4UL,0x11D37508UL,0x63382ADBUL,0xB121EB07UL,0x86EE957DUL,0x54F754A1UL,
+    0x261C0B72UL,0xF405CAAEUL,0x4982F786UL,0x9B9B365AUL,0xE9706989UL,0x3B69A855UL,
+    0x0CA6D62FUL,0xDEBF17F3UL,0xAC544820UL,0x7E4D89FCUL,0xD39B2FC7UL,0x0182EE1BUL,
+    0x7369B1C8UL,0xA1707014UL,0x96BF0E6EUL,0x44A6CFB2UL,0x364D9061UL,0xE45451BDUL,
+    0x59D36C95UL,0x8BCAAD49UL,0xF921F29AUL,0x2B383346UL,0x1CF74D3CUL,0xCEEE8CE0UL,
+    0xBC05D333UL,0x6E1C12EFUL,0xE36982F2UL,0x3170432EUL,0x439B1CFDUL,0x9182DD21UL,
+    0xA64DA35BUL,0x74546287UL,0x06BF3D54UL,0xD4A6FC88UL,0x6921C1A0UL,0xBB38007CUL,
+    0xC9D35FAFUL,0x1BCA9E73UL,0x2C05E009UL,0xFE1C21D5UL,0x8CF77E06UL,0x5EEEBFDAUL,
+    0xF33819E1UL,0x2121D83DUL,0x53CA87EEUL,0x81D34632UL,0xB61C3848UL,0x6405F994UL,
+    0x16EEA647UL,0xC4F7679BUL,0x79705AB3UL,0xAB699B6FUL,0xD982C4BCUL,0x0B9B0560UL,
+    0x3C547B1AUL,0xEE4DBAC6UL,0x9CA6E515UL,0x4EBF24C9UL
+};
+
+/* (b << 16) * x^32 mod P */
+static const uint32_t CRC32_TableS2[256]=
+{
+    0x00000000UL,0x01D8AC87UL,0x03B1590EUL,0x0269F589UL,0x0762B21CUL,0x06BA1E9BUL,
+    0x04D3EB12UL,0x050B4795UL,0x0EC56438UL,0x0F1DC8BFUL,0x0D743D36UL,0x0CAC91B1UL,
+    0x09A7D624UL,0x087F7AA3UL,0x0A168F2AUL,0x0BCE23ADUL,0x1D8AC870UL,0x1C5264F7UL,
+    0x1E3B917EUL,0x1FE33DF9UL,0x1AE87A6CUL,0x1B30D6EBUL,0x19592362UL,0x18818FE5UL,
+    0x134FAC48UL,0x129700CFUL,0x10FEF546UL,0x112659C1UL,0x142D1E54UL,0x15F5B2D3UL,
+    0x179C475AUL,0x1644EBDDUL,0x3B1590E0UL,0x3ACD3C67UL,0x38A4C9EEUL,0x397C6569UL,
+    0x3C7722FCUL,0x3DAF8E7BUL,0x3FC67BF2UL,0x3E1ED775UL,0x35D0F4D8UL,0x3408585FUL,
+    0x3661ADD6UL,0x37B90151UL,0x32B246C4UL,0x336AEA43UL,0x31031FCAUL,0x30DBB34DUL,
+    0x269F5890UL,0x2747F417UL,0x252E019EUL,0x24F6AD19UL,0x21FDEA8CUL,0x2025460BUL,
+    0x224CB382UL,0x23941F05UL,0x285A3CA8UL,0x2982902FUL,0x2BEB65A6UL,0x2A33C921UL,
+    0x2F388EB4UL,0x2EE02233UL,0x2C89D7BAUL,0x2D517B3DUL,0x762B21C0UL,0x77F38D47UL,
+    0x759A78CEUL,0x7442D449UL,0x714993DCUL,0x70913F5BUL,0x72F8CAD2UL,0x73206655UL,
+    0x78EE45F8UL,0x7936E97FUL,0x7B5F1CF6UL,0x7A87B071UL,0x7F8CF7E4UL,0x7E545B63UL,
+    0x7C3DAEEAUL,0x7DE5026DUL,0x6BA1E9B0UL,0x6A794537UL,0x6810B0BEUL,0x69C81C39UL,
+    0x6CC35BACUL,0x6D1BF72BUL,0x6F7202A2UL,0x6EAAAE25UL,0x65648D88UL,0x64BC210FUL,
+    0x66D5D486UL,0x670D7801UL,0x62063F94UL,0x63DE9313UL,0x61B7669AUL,0x606FCA1DUL,
+    0x4D3EB120UL,0x4CE61DA7UL,0x4E8FE82EUL,0x4F5744A9UL,0x4A5C033CUL,0x4B84AFBBUL,
+    0x49ED5A32UL,0x4835F6B5UL,0x43FBD518UL,0x4223799FUL,0x404A8C16UL,0x41922091UL,
+    0x44996704UL,0x4541CB83UL,0x47283E0AUL,0x46F0928DUL,0x50B47950UL,0x516CD5D7UL,
+    0x5305205EUL,0x52DD8CD9UL,0x57D6CB4CUL,0x560E67CBUL,0x54679242UL,0x55BF3EC5UL,
+    0x5E711D68UL,0x5FA9B1EFUL,0x5DC04466UL,0x5C18E8E1UL,0x5913AF74UL,0x58CB03F3UL,
+    0x5AA2F67AUL,0x5B7A5AFDUL,0xEC564380UL,0xED8EEF07UL,0xEFE71A8EUL,0xEE3FB609UL,
+    0xEB34F19CUL,0xEAEC5D1BUL,0xE885A892UL,0xE95D0415UL,0xE29327B8UL,0xE34B8B3FUL,
+    0xE1227EB6UL,0xE0FAD231UL,0xE5F195A4UL,0xE4293923UL,0xE640CCAAUL,0xE798602DUL,
+    0xF1DC8BF0UL,0xF0042777UL,0xF26DD2FEUL,0xF3B57E79UL,0xF6BE39ECUL,0xF766956BUL,
+    0xF50F60E2UL,0xF4D7CC65UL,0xFF19EFC8UL,0xFEC1434FUL,0xFCA8B6C6UL,0xFD701A41UL,
+    0xF87B5DD4UL,0xF9A3F153UL,0xFBCA04DAUL,0xFA12A85DUL,0xD743D360UL,0xD69B7FE7UL,
+    0xD4F28A6EUL,0xD52A26E9UL,0xD021617CUL,0xD1F9CDFBUL,0xD3903872UL,0xD24894F5UL,
+    0xD986B758UL,0xD85E1BDFUL,0xDA37EE56UL,0xDBEF42D1UL,0xDEE40544UL,0xDF3CA9C3UL,
+    0xDD555C4AUL,0xDC8DF0CDUL,0xCAC91B10UL,0xCB11B797UL,0xC978421EUL,0xC8A0EE99UL,
+    0xCDABA90CUL,0xCC73058BUL,0xCE1AF002UL,0xCFC25C85UL,0xC40C7F28UL,0xC5D4D3AFUL,
+    0xC7BD2626UL,0xC6658AA1UL,0xC36ECD34UL,0xC2B661B3UL,0xC0DF943AUL,0xC10738BDUL,
+    0x9A7D6240UL,0x9BA5CEC7UL,0x99CC3B4EUL,0x981497C9UL,0x9D1FD05CUL,0x9CC77CDBUL,
+    0x9EAE8952UL,0x9F7625D5UL,0x94B80678UL,0x9560AAFFUL,0x97095F76UL,0x96D1F3F1UL,
+    0x93DAB464UL,0x920218E3UL,0x906BED6AUL,0x91B341EDUL,0x87F7AA30UL,0x862F06B7UL,
+    0x8446F33EUL,0x859E5FB9UL,0x8095182CUL,0x814DB4ABUL,0x83244122UL,0x82FCEDA5UL,
+    0x8932CE08UL,0x88EA628FUL,0x8A839706UL,0x8B5B3B81UL,0x8E507C14UL,0x8F88D093UL,
+    0x8DE1251AUL,0x8C39899DUL,0xA168F2A0UL,0xA0B05E27UL,0xA2D9ABAEUL,0xA3010729UL,
+    0xA60A40BCUL,0xA7D2EC3BUL,0xA5BB19B2UL,0xA463B535UL,0xAFAD9698UL,0xAE753A1FUL,
+    0xAC1CCF96UL,0xADC46311UL,0xA8CF2484UL,0xA9178803UL,0xAB7E7D8AUL,0xAAA6D10DUL,
+    0xBCE23AD0UL,0xBD3A9657UL,0xBF5363DEUL,0xBE8BCF59UL,0xBB8088CCUL,0xBA58244BUL,
+    0xB831D1C2UL,0xB9E97D45UL,0xB2275EE8UL,0xB3FFF26FUL,0xB19607E6UL,0xB04EAB61UL,
+    0xB545ECF4UL,0xB49D4073UL,0xB6F4B5FAUL,0xB72C197DUL
+};
+
+/* (b << 24) * x^32 mod P */
+static const uint32_t CRC32_TableS3[256]=
+{
+    0x00000000UL,0xDC6D9AB7UL,0xBC1A28D9UL,0x6077B26EUL,0x7CF54C05UL,0xA098D6B2UL,
+    0xC0EF64DCUL,0x1C82FE6BUL,0xF9EA980AUL,0x258702BDUL,0x45F0B0D3UL,0x999D2A64UL,
+    0x851FD40FUL,0x59724EB8UL,0x3905FCD6UL,0xE5686661UL,0xF7142DA3UL,0x2B79B714UL,
+    0x4B0E057AUL,0x97639FCDUL,0x8BE161A6UL,0x578CFB11UL,0x37FB497FUL,0xEB96D3C8UL,
+    0x0EFEB5A9UL,0xD2932F1EUL,0xB2E49D70UL,0x6E8907C7UL,0x720BF9ACUL,0xAE66631BUL,
+    0xCE11D175UL,0x127C4BC2UL,0xEAE946F1UL,0x3684DC46UL,0x56F36E28UL,0x8A9EF49FUL,
+    0x961C0AF4UL,0x4A719043UL,0x2A06222DUL,0xF66BB89AUL,0x1303DEFBUL,0xCF6E444CUL,
+    0xAF19F622UL,0x73746C95UL,0x6FF692FEUL,0xB39B0849UL,0xD3ECBA27UL,0x0F812090UL,
+    0x1DFD6B52UL,0xC190F1E5UL,0xA1E7438BUL,0x7D8AD93CUL,0x61082757UL,0xBD65BDE0UL,
+    0xDD120F8EUL,0x017F9539UL,0xE417F358UL,0x387A69EFUL,0x580DDB81UL,0x84604136UL,
+    0x98E2BF5DUL,0x448F25EAUL,0x24F89784UL,0xF8950D33UL,0xD1139055UL,0x0D7E0AE2UL,
+    0x6D09B88CUL,0xB164223BUL,0xADE6DC50UL,0x718B46E7UL,0x11FCF489UL,0xCD916E3EUL,
+    0x28F9085FUL,0xF49492E8UL,0x94E32086UL,0x488EBA31UL,0x540C445AUL,0x8861DEEDUL,
+    0xE8166C83UL,0x347BF634UL,0x2607BDF6UL,0xFA6A2741UL,0x9A1D952FUL,0x46700F98UL,
+    0x5AF2F1F3UL,0x869F6B44UL,0xE6E8D92AUL,0x3A85439DUL,0xDFED25FCUL,0x0380BF4BUL,
+    0x63F70D25UL,0xBF9A9792UL,0xA31869F9UL,0x7F75F34EUL,0x1F024120UL,0xC36FDB97UL,
+    0x3BFAD6A4UL,0xE7974C13UL,0x87E0FE7DUL,0x5B8D64CAUL,0x470F9AA1UL,0x9B620016UL,
+    0xFB15B278UL,0x277828CFUL,0xC2104EAEUL,0x1E7DD419UL,0x7E0A6677UL,0xA267FCC0UL,
+    0xBEE502ABUL,0x6288981CUL,0x02FF2A72UL,0xDE92B0C5UL,0xCCEEFB07UL,0x108361B0UL,
+    0x70F4D3DEUL,0xAC994969UL,0xB01BB702UL,0x6C762DB5UL,0x0C019FDBUL,0xD06C056CUL,
+    0x3504630DUL,0xE969F9BAUL,0x891E4BD4UL,0x5573D163UL,0x49F12F08UL,0x959CB5BFUL,
+    0xF5EB07D1UL,0x29869D66UL,0xA6E63D1DUL,0x7A8BA7AAUL,0x1AFC15C4UL,0xC6918F73UL,
+    0xDA137118UL,0x067EEBAFUL,0x660959C1UL,0xBA64C376UL,0x5F0CA517UL,0x83613FA0UL,
+    0xE3168DCEUL,0x3F7B1779UL,0x23F9E912UL,0xFF9473A5UL,0x9FE3C1CBUL,0x438E5B7CUL,
+    0x51F210BEUL,0x8D9F8A09UL,0xEDE83867UL,0x3185A2D0UL,0x2D075CBBUL,0xF16AC60CUL,
+    0x911D7462UL,0x4D70EED5UL,0xA81888B4UL,0x74751203UL,0x1402A06DUL,0xC86F3ADAUL,
+    0xD4EDC4B1UL,0x08805E06UL,0x68F7EC68UL,0xB49A76DFUL,0x4C0F7BECUL,0x9062E15BUL,
+    0xF0155335UL,0x2C78C982UL,0x30FA37E9UL,0xEC97AD5EUL,0x8CE01F30UL,0x508D8587UL,
+    0xB5E5E3E6UL,0x69887951UL,0x09FFCB3FUL,0xD5925188UL,0xC910AFE3UL,0x157D3554UL,
+    0x750A873AUL,0xA9671D8DUL,0xBB1B564FUL,0x6776CCF8UL,0x07017E96UL,0xDB6CE421UL,
+    0xC7EE1A4AUL,0x1B8380FDUL,0x7BF43293UL,0xA799A824UL,0x42F1CE45UL,0x9E9C54F2UL,
+    0xFEEBE69CUL,0x22867C2BUL,0x3E048240UL,0xE26918F7UL,0x821EAA99UL,0x5E73302EUL,
+    0x77F5AD48UL,0xAB9837FFUL,0xCBEF8591UL,0x17821F26UL,0x0B00E14DUL,0xD76D7BFAUL,
+    0xB71AC994UL,0x6B775323UL,0x8E1F3542UL,0x5272AFF5UL,0x32051D9BUL,0xEE68872CUL,
+    0xF2EA7947UL,0x2E87E3F0UL,0x4EF0519EUL,0x929DCB29UL,0x80E180EBUL,0x5C8C1A5CUL,
+    0x3CFBA832UL,0xE0963285UL,0xFC14CCEEUL,0x20795659UL,0x400EE437UL,0x9C637E80UL,
+    0x790B18E1UL,0xA5668256UL,0xC5113038UL,0x197CAA8FUL,0x05FE54E4UL,0xD993CE53UL,
+    0xB9E47C3DUL,0x6589E68AUL,0x9D1CEBB9UL,0x4171710EUL,0x2106C360UL,0xFD6B59D7UL,
+    0xE1E9A7BCUL,0x3D843D0BUL,0x5DF38F65UL,0x819E15D2UL,0x64F673B3UL,0xB89BE904UL,
+    0xD8EC5B6AUL,0x0481C1DDUL,0x18033FB6UL,0xC46EA501UL,0xA419176FUL,0x78748DD8UL,
+    0x6A08C61AUL,0xB6655CADUL,0xD612EEC3UL,0x0A7F7474UL,0x16FD8A1FUL,0xCA9010A8UL,
+    0xAAE7A2C6UL,0x768A3871UL,0x93E25E10UL,0x4F8FC4A7UL,0x2FF876C9UL,0xF395EC7EUL,
+    0xEF171215UL,0x337A88A2UL,0x530D3ACCUL,0x8F60A07BUL
+};
+#endif
+
+#if CRC32_ENGINE==CRC32_ENGINE_SLICE_BY_8
+/* b * x^128 mod P */
+static const uint32_t CRC32_TableQ0[256]=
+{
+    0x00000000UL,0xE8A45605UL,0xD589B1BDUL,0x3D2DE7B8UL,0xAFD27ECDUL,0x477628C8UL,
+    0x7A5BCF70UL,0x92FF9975UL,0x5B65E02DUL,0xB3C1B628UL,0x8EEC5190UL,0x66480795UL,
+    0xF4B79EE0UL,0x1C13C8E5UL,0x213E2F5DUL,0xC99A7958UL,0xB6CBC05AUL,0x5E6F965FUL,
+    0x634271E7UL,0x8BE627E2UL,0x1919BE97UL,0xF1BDE892UL,0xCC900F2AUL,0x2434592FUL,
+    0xEDAE2077UL,0x050A7672UL,0x382791CAUL,0xD083C7CFUL,0x427C5EBAUL,0xAAD808BFUL,
+    0x97F5EF07UL,0x7F51B902UL,0x69569D03UL,0x81F2CB06UL,0xBCDF2CBEUL,0x547B7ABBUL,
+    0xC684E3CEUL,0x2E20B5CBUL,0x130D5273UL,0xFBA90476UL,0x32337D2EUL,0xDA972B2BUL,
+    0xE7BACC93UL,0x0F1E9A96UL,0x9DE103E3UL,0x754555E6UL,0x4868B25EUL,0xA0CCE45BUL,
+    0xDF9D5D59UL,0x37390B5CUL,0x0A14ECE4UL,0xE2B0BAE1UL,0x704F2394UL,0x98EB7591UL,
+    0xA5C69229UL,0x4D62C42CUL,0x84F8BD74UL,0x6C5CEB71UL,0x51710CC9UL,0xB9D55ACCUL,
+    0x2B2AC3B9UL,0xC38E95BCUL,0xFEA37204UL,0x16072401UL,0xD2AD3A06UL,0x3A096C03UL,
+    0x07248BBBUL,0xEF80DDBEUL,0x7D7F44CBUL,0x95DB12CEUL,0xA8F6F576UL,0x4052A373UL,
+    0x89C8DA2BUL,0x616C8C2EUL,0x5C416B96UL,0xB4E53D93UL,0x261AA4E6UL,0xCEBEF2E3UL,
+    0xF393155BUL,0x1B37435EUL,0x6466FA5CUL,0x8CC2AC59UL,0xB1EF4BE1UL,0x594B1DE4UL,
+    0xCBB48491UL,0x2310D294UL,0x1E3D352CUL,0xF6996329UL,0x3F031A71UL,0xD7A74C74UL,
+    0xEA8AABCCUL,0x022EFDC9UL,0x90D164BCUL,0x787532B9UL,0x4558D501UL,0xADFC8304UL,
+    0xBBFBA705UL,0x535FF100UL,0x6E7216B8UL,0x86D640BDUL,0x1429D9C8UL,0xFC8D8FCDUL,
+    0xC1A06875UL,0x29043E70UL,0xE09E4728UL,0x083A112DUL,0x3517F695UL,0xDDB3A090UL,
+    0x4F4C39E5UL,0xA7E86FE0UL,0x9AC58858UL,0x7261DE5DUL,0x0D30675FUL,0xE594315AUL,
+    0xD8B9D6E2UL,0x301D80E7UL,0xA2E21992UL,0x4A464F97UL,0x776BA82FUL,0x9FCFFE2AUL,
+    0x56558772UL,0xBEF1D177UL,0x83DC36CFUL,0x6B7860CAUL,0xF987F9BFUL,0x1123AFBAUL,
+    0x2C0E4802UL,0xC4AA1E07UL,0xA19B69BBUL,0x493F3FBEUL,0x7412D806UL,0x9CB68E03UL,
+    0x0E491776UL,0xE6ED4173UL,0xDBC0A6CBUL,0x3364F0CEUL,0xFAFE8996UL,0x125ADF93UL,
+    0x2F77382BUL,0xC7D36E2EUL,0x552CF75BUL,0xBD88A15EUL,0x80A546E6UL,0x680110E3UL,
+    0x1750A9E1UL,0xFFF4FFE4UL,0xC2D9185CUL,0x2A7D4E59UL,0xB882D72CUL,0x50268129UL,
+    0x6D0B6691UL,0x85AF3094UL,0x4C3549CCUL,0xA4911FC9UL,0x99BCF871UL,0x7118AE74UL,
+    0xE3E73701UL,0x0B436104UL,0x366E86BCUL,0xDECAD0B9UL,0xC8CDF4B8UL,0x2069A2BDUL,
+    0x1D444505UL,0xF5E01300UL,0x671F8A75UL,0x8FBBDC70UL,0xB2963BC8UL,0x5A326DCDUL,
+    0x93A81495UL,0x7B0C4290UL,0x4621A528UL,0xAE85F32DUL,0x3C7A6A58UL,0xD4DE3C5DUL,
+    0xE9F3DBE5UL,0x01578DE0UL,0x7E0634E2UL,0x96A262E7UL,0xAB8F855FUL,0x432BD35AUL,
+    0xD1D44A2FUL,0x39701C2AUL,0x045DFB92UL,0xECF9AD97UL,0x2563D4CFUL,0xCDC782CAUL,
+    0xF0EA6572UL,0x184E3377UL,0x8AB1AA02UL,0x6215FC07UL,0x5F381BBFUL,0xB79C4DBAUL,
+    0x733653BDUL,0x9B9205B8UL,0xA6BFE200UL,0x4E1BB405UL,0xDCE42D70UL,0x34407B75UL,
+    0x096D9CCDUL,0xE1C9CAC8UL,0x2853B390UL,0xC0F7E595UL,0xFDDA022DUL,0x157E5428UL,
+    0x8781CD5DUL,0x6F259B58UL,0x52087CE0UL,0xBAAC2AE5UL,0xC5FD93E7UL,0x2D59C5E2UL,
+    0x1074225AUL,0xF8D0745FUL,0x6A2FED2AUL,0x828BBB2FUL,0xBFA65C97UL,0x57020A92UL,
+    0x9E9873CAUL,0x763C25CFUL,0x4B11C277UL,0xA3B59472UL,0x314A0D07UL,0xD9EE5B02UL,
+    0xE4C3BCBAUL,0x0C67EABFUL,0x1A60CEBEUL,0xF2C498BBUL,0xCFE97F03UL,0x274D2906UL,
+    0xB5B2B073UL,0x5D16E676UL,0x603B01CEUL,0x889F57CBUL,0x41052E93UL,0xA9A17896UL,
+    0x948C9F2EUL,0x7C28C92BUL,0xEED7505EUL,0x0673065BUL,0x3B5EE1E3UL,0xD3FAB7E6UL,
+    0xACAB0EE4UL,0x440F58E1UL,0x7922BF59UL,0x9186E95CUL,0x03797029UL,0xEBDD262CUL,
+    0xD6F0C194UL,0x3E549791UL,0xF7CEEEC9UL,0x1F6AB8CCUL,0x22475F74UL,0xCAE30971UL,
+    0x581C9004UL,0xB0B8C601UL,0x8D9521B9UL,0x653177BCUL
+};
+
+/* (b << 8) * x^128 mod P */
+static const uint32_t CRC32_TableQ1[256]=
+{
+    0x00000000UL,0x47F7CEC1UL,0x8FEF9D82UL,0xC8185343UL,0x1B1E26B3UL,0x5CE9E872UL,
+    0x94F1BB31UL,0xD30675F0UL,0x363C4D66UL,0x71CB83A7UL,0xB9D3D0E4UL,0xFE241E25UL,
+    0x2D226BD5UL,0x6AD5A514UL,0xA2CDF657UL,0xE53A3896UL,0x6C789ACCUL,0x2B8F540DUL,
+    0xE397074EUL,0xA460C98FUL,0x7766BC7FUL,0x309172BEUL,0xF88921FDUL,0xBF7EEF3CUL,
+    0x5A44D7AAUL,0x1DB3196BUL,0xD5AB4A28UL,0x925C84E9UL,0x415AF119UL,0x06AD3FD8UL,
+    0xCEB56C9BUL,0x8942A25AUL,0xD8F13598UL,0x9F06FB59UL,0x571EA81AUL,0x10E966DBUL,
+    0xC3EF132BUL,0x8418DDEAUL,0x4C008EA9UL,0x0BF74068UL,0xEECD78FEUL,0xA93AB63FUL,
+    0x6122E57CUL,0x26D52BBDUL,0xF5D35E4DUL,0xB224908CUL,0x7A3CC3CFUL,0x3DCB0D0EUL,
+    0xB489AF54UL,0xF37E6195UL,0x3B6632D6UL,0x7C91FC17UL,0xAF9789E7UL,0xE8604726UL,
+    0x20781465UL,0x678FDAA4UL,0x82B5E232UL,0xC5422CF3UL,0x0D5A7FB0UL,0x4AADB171UL,
+    0x99ABC481UL,0xDE5C0A40UL,0x16445903UL,0x51B397C2UL,0xB5237687UL,0xF2D4B846UL,
+    0x3ACCEB05UL,0x7D3B25C4UL,0xAE3D5034UL,0xE9CA9EF5UL,0x21D2CDB6UL,0x66250377UL,
+    0x831F3BE1UL,0xC4E8F520UL,0x0CF0A663UL,0x4B0768A2UL,0x98011D52UL,0xDFF6D393UL,
+    0x17EE80D0UL,0x50194E11UL,0xD95BEC4BUL,0x9EAC228AUL,0x56B471C9UL,0x1143BF08UL,
+    0xC245CAF8UL,0x85B20439UL,0x4DAA577AUL,0x0A5D99BBUL,0xEF67A12DUL,0xA8906FECUL,
+    0x60883CAFUL,0x277FF26EUL,0xF479879EUL,0xB38E495FUL,0x7B961A1CUL,0x3C61D4DDUL,
+    0x6DD2431FUL,0x2A258DDEUL,0xE23DDE9DUL,0xA5CA105CUL,0x76CC65ACUL,0x313BAB6DUL,
+    0xF923F82EUL,0xBED436EFUL,0x5BEE0E79UL,0x1C19C0B8UL,0xD40193FBUL,0x93F65D3AUL,
+    0x40F028CAUL,0x0707E60BUL,0xCF1FB548UL,0x88E87B89UL,0x01AAD9D3UL,0x465D1712UL,
+    0x8E454451UL,0xC9B28A90UL,0x1AB4FF60UL,0x5D4331A1UL,0x955B62E2UL,0xD2ACAC23UL,
+    0x379694B5UL,0x70615A74UL,0xB8790937UL,0xFF8EC7F6UL,0x2C88B206UL,0x6B7F7CC7UL,
+    0xA3672F84UL,0xE490E145UL,0x6E87F0B9UL,0x29703E78UL,0xE1686D3BUL,0xA69FA3FAUL,
+    0x7599D60AUL,0x326E18CBUL,0xFA764B88UL,0xBD818549UL,0x58BBBDDFUL,0x1F4C731EUL,
+    0xD754205DUL,0x90A3EE9CUL,0x43A59B6CUL,0x045255ADUL,0xCC4A06EEUL,0x8BBDC82FUL,
+    0x02FF6A75UL,0x4508A4B4UL,0x8D10F7F7UL,0xCAE73936UL,0x19E14CC6UL,0x5E168207UL,
+    0x960ED144UL,0xD1F91F85UL,0x34C32713UL,0x7334E9D2UL,0xBB2CBA91UL,0xFCDB7450UL,
+    0x2FDD01A0UL,0x682ACF61UL,0xA0329C22UL,0xE7C552E3UL,0xB676C521UL,0xF1810BE0UL,
+    0x399958A3UL,0x7E6E9662UL,0xAD68E392UL,0xEA9F2D53UL,0x22877E10UL,0x6570B0D1UL,
+    0x804A8847UL,0xC7BD4686UL,0x0FA515C5UL,0x4852DB04UL,0x9B54AEF4UL,0xDCA36035UL,
+    0x14BB3376UL,0x534CFDB7UL,0xDA0E5FEDUL,0x9DF9912CUL,0x55E1C26FUL,0x12160CAEUL,
+    0xC110795EUL,0x86E7B79FUL,0x4EFFE4DCUL,0x09082A1DUL,0xEC32128BUL,0xABC5DC4AUL,
+    0x63DD8F09UL,0x242A41C8UL,0xF72C3438UL,0xB0DBFAF9UL,0x78C3A9BAUL,0x3F34677BUL,
+    0xDBA4863EUL,0x9C5348FFUL,0x544B1BBCUL,0x13BCD57DUL,0xC0BAA08DUL,0x874D6E4CUL,
+    0x4F553D0FUL,0x08A2F3CEUL,0xED98CB58UL,0xAA6F0599UL,0x627756DAUL,0x2580981BUL,
+    0xF686EDEBUL,0xB171232AUL,0x79697069UL,0x3E9EBEA8UL,0xB7DC1CF2UL,0xF02BD233UL,
+    0x38338170UL,0x7FC44FB1UL,0xACC23A41UL,0xEB35F480UL,0x232DA7C3UL,0x64DA6902UL,
+    0x81E05194UL,0xC6179F55UL,0x0E0FCC16UL,0x49F802D7UL,0x9AFE7727UL,0xDD09B9E6UL,
+    0x1511EAA5UL,0x52E62464UL,0x0355B3A6UL,0x44A27D67UL,0x8CBA2E24UL,0xCB4DE0E5UL,
+    0x184B9515UL,0x5FBC5BD4UL,0x97A40897UL,0xD053C656UL,0x3569FEC0UL,0x729E3001UL,
+    0xBA866342UL,0xFD71AD83UL,0x2E77D873UL,0x698016B2UL,0xA19845F1UL,0xE66F8B30UL,
+    0x6F2D296AUL,0x28DAE7ABUL,0xE0C2B4E8UL,0xA7357A29UL,0x74330FD9UL,0x33C4C118UL,
+    0xFBDC925BUL,0xBC2B5C9AUL,0x5911640CUL,0x1EE6AACDUL,0xD6FEF98EUL,0x9109374FUL,
+    0x420F42BFUL,0x05F88C7EUL,0xCDE0DF3DUL,0x8A1711FCUL
+};
+
+/* (b << 16) * x^128 mod P */
+static const uint32_t CRC32_TableQ2[256]=
+{
+    0x00000000UL,0xDD0FE172UL,0xBEDEDF53UL,0x63D13E21UL,0x797CA311UL,0xA4734263UL,
+    0xC7A27C42UL,0x1AAD9D30UL,0xF2F94622UL,0x2FF6A750UL,0x4C279971UL,0x91287803UL,
+    0x8B85E533UL,0x568A0441UL,0x355B3A60UL,0xE854DB12UL,0xE13391F3UL,0x3C3C7081UL,
+    0x5FED4EA0UL,0x82E2AFD2UL,0x984F32E2UL,0x4540D390UL,0x2691EDB1UL,0xFB9E0CC3UL,
+    0x13CAD7D1UL,0xCEC536A3UL,0xAD140882UL,0x701BE9F0UL,0x6AB674C0UL,0xB7B995B2UL,
+    0xD468AB93UL,0x09674AE1UL,0xC6A63E51UL,0x1BA9DF23UL,0x7878E102UL,0xA5770070UL,
+    0xBFDA9D40UL,0x62D57C32UL,0x01044213UL,0xDC0BA361UL,0x345F7873UL,0xE9509901UL,
+    0x8A81A720UL,0x578E4652UL,0x4D23DB62UL,0x902C3A10UL,0xF3FD0431UL,0x2EF2E543UL,
+    0x2795AFA2UL,0xFA9A4ED0UL,0x994B70F1UL,0x44449183UL,0x5EE90CB3UL,0x83E6EDC1UL,
+    0xE037D3E0UL,0x3D383292UL,0xD56CE980UL,0x086308F2UL,0x6BB236D3UL,0xB6BDD7A1UL,
+    0xAC104A91UL,0x711FABE3UL,0x12CE95C2UL,0xCFC174B0UL,0x898D6115UL,0x54828067UL,
+    0x3753BE46UL,0xEA5C5F34UL,0xF0F1C204UL,0x2DFE2376UL,0x4E2F1D57UL,0x9320FC25UL,
+    0x7B742737UL,0xA67BC645UL,0xC5AAF864UL,0x18A51916UL,0x02088426UL,0xDF076554UL,
+    0xBCD65B75UL,0x61D9BA07UL,0x68BEF0E6UL,0xB5B11194UL,0xD6602FB5UL,0x0B6FCEC7UL,
+    0x11C253F7UL,0xCCCDB285UL,0xAF1C8CA4UL,0x72136DD6UL,0x9A47B6C4UL,0x474857B6UL,
+    0x24996997UL,0xF99688E5UL,0xE33B15D5UL,0x3E34F4A7UL,0x5DE5CA86UL,0x80EA2BF4UL,
+    0x4F2B5F44UL,0x9224BE36UL,0xF1F58017UL,0x2CFA6165UL,0x3657FC55UL,0xEB581D27UL,
+    0x88892306UL,0x5586C274UL,0xBDD21966UL,0x60DDF814UL,0x030CC635UL,0xDE032747UL,
+    0xC4AEBA77UL,0x19A15B05UL,0x7A706524UL,0xA77F8456UL,0xAE18CEB7UL,0x73172FC5UL,
+    0x10C611E4UL,0xCDC9F096UL,0xD7646DA6UL,0x0A6B8CD4UL,0x69BAB2F5UL,0xB4B55387UL,
+    0x5CE18895UL,0x81EE69E7UL,0xE23F57C6UL,0x3F30B6B4UL,0x259D2B84UL,0xF892CAF6UL,
+    0x9B43F4D7UL,0x464C15A5UL,0x17DBDF9DUL,0xCAD43EEFUL,0xA90500CEUL,0x740AE1BCUL,
+    0x6EA77C8CUL,0xB3A89DFEUL,0xD079A3DFUL,0x0D7642ADUL,0xE52299BFUL,0x382D78CDUL,
+    0x5BFC46ECUL,0x86F3A79EUL,0x9C5E3AAEUL,0x4151DBDCUL,0x2280E5FDUL,0xFF8F048FUL,
+    0xF6E84E6EUL,0x2BE7AF1CUL,0x4836913DUL,0x9539704FUL,0x8F94ED7FUL,0x529B0C0DUL,
+    0x314A322CUL,0xEC45D35EUL,0x0411084CUL,0xD91EE93EUL,0xBACFD71FUL,0x67C0366DUL,
+    0x7D6DAB5DUL,0xA0624A2FUL,0xC3B3740EUL,0x1EBC957CUL,0xD17DE1CCUL,0x0C7200BEUL,
+    0x6FA33E9FUL,0xB2ACDFEDUL,0xA80142DDUL,0x750EA3AFUL,0x16DF9D8EUL,0xCBD07CFCUL,
+    0x2384A7EEUL,0xFE8B469CUL,0x9D5A78BDUL,0x405599CFUL,0x5AF804FFUL,0x87F7E58DUL,
+    0xE426DBACUL,0x39293ADEUL,0x304E703FUL,0xED41914DUL,0x8E90AF6CUL,0x539F4E1EUL,
+    0x4932D32EUL,0x943D325CUL,0xF7EC0C7DUL,0x2AE3ED0FUL,0xC2B7361DUL,0x1FB8D76FUL,
+    0x7C69E94EUL,0xA166083CUL,0xBBCB950CUL,0x66C4747EUL,0x05154A5FUL,0xD81AAB2DUL,
+    0x9E56BE88UL,0x43595FFAUL,0x208861DBUL,0xFD8780A9UL,0xE72A1D99UL,0x3A25FCEBUL,
+    0x59F4C2CAUL,0x84FB23B8UL,0x6CAFF8AAUL,0xB1A019D8UL,0xD27127F9UL,0x0F7EC68BUL,
+    0x15D35BBBUL,0xC8DCBAC9UL,0xAB0D84E8UL,0x7602659AUL,0x7F652F7BUL,0xA26ACE09UL,
+    0xC1BBF028UL,0x1CB4115AUL,0x06198C6AUL,0xDB166D18UL,0xB8C75339UL,0x65C8B24BUL,
+    0x8D9C6959UL,0x5093882BUL,0x3342B60AUL,0xEE4D5778UL,0xF4E0CA48UL,0x29EF2B3AUL,
+    0x4A3E151BUL,0x9731F469UL,0x58F080D9UL,0x85FF61ABUL,0xE62E5F8AUL,0x3B21BEF8UL,
+    0x218C23C8UL,0xFC83C2BAUL,0x9F52FC9BUL,0x425D1DE9UL,0xAA09C6FBUL,0x77062789UL,
+    0x14D719A8UL,0xC9D8F8DAUL,0xD37565EAUL,0x0E7A8498UL,0x6DABBAB9UL,0xB0A45BCBUL,
+    0xB9C3112AUL,0x64CCF058UL,0x071DCE79UL,0xDA122F0BUL,0xC0BFB23BUL,0x1DB05349UL,
+    0x7E616D68UL,0xA36E8C1AUL,0x4B3A5708UL,0x9635B67AUL,0xF5E4885BUL,0x28EB6929UL,
+    0x3246F419UL,0xEF49156BUL,0x8C982B4AUL,0x5197CA38UL
+};
+
+/* (b << 24) * x^128 mod P */
+static const uint32_t CRC32_TableQ3[256]=
+{
+    0x00000000UL,0x2FB7BF3AUL,0x5F6F7E74UL,0x70D8C14EUL,0xBEDEFCE8UL,0x916943D2UL,
+    0xE1B1829CUL,0xCE063DA6UL,0x797CE467UL,0x56CB5B5DUL,0x26139A13UL,0x09A42529UL,
+    0xC7A2188FUL,0xE815A7B5UL,0x98CD66FBUL,0xB77AD9C1UL,0xF2F9C8CEUL,0xDD4E77F4UL,
+    0xAD96B6BAUL,0x82210980UL,0x4C273426UL,0x63908B1CUL,0x13484A52UL,0x3CFFF568UL,
+    0x8B852CA9UL,0xA4329393UL,0xD4EA52DDUL,0xFB5DEDE7UL,0x355BD041UL,0x1AEC6F7BUL,
+    0x6A34AE35UL,0x4583110FUL,0xE1328C2BUL,0xCE853311UL,0xBE5DF25FUL,0x91EA4D65UL,
+    0x5FEC70C3UL,0x705BCFF9UL,0x00830EB7UL,0x2F34B18DUL,0x984E684CUL,0xB7F9D776UL,
+    0xC7211638UL,0xE896A902UL,0x269094A4UL,0x09272B9EUL,0x79FFEAD0UL,0x564855EAUL,
+    0x13CB44E5UL,0x3C7CFBDFUL,0x4CA43A91UL,0x631385ABUL,0xAD15B80DUL,0x82A20737UL,
+    0xF27AC679UL,0xDDCD7943UL,0x6AB7A082UL,0x45001FB8UL,0x35D8DEF6UL,0x1A6F61CCUL,
+    0xD4695C6AUL,0xFBDEE350UL,0x8B06221EUL,0xA4B19D24UL,0xC6A405E1UL,0xE913BADBUL,
+    0x99CB7B95UL,0xB67CC4AFUL,0x787AF909UL,0x57CD4633UL,0x2715877DUL,0x08A23847UL,
+    0xBFD8E186UL,0x906F5EBCUL,0xE0B79FF2UL,0xCF0020C8UL,0x01061D6EUL,0x2EB1A254UL,
+    0x5E69631AUL,0x71DEDC20UL,0x345DCD2FUL,0x1BEA7215UL,0x6B32B35BUL,0x44850C61UL,
+    0x8A8331C7UL,0xA5348EFDUL,0xD5EC4FB3UL,0xFA5BF089UL,0x4D212948UL,0x62969672UL,
+    0x124E573CUL,0x3DF9E806UL,0xF3FFD5A0UL,0xDC486A9AUL,0xAC90ABD4UL,0x832714EEUL,
+    0x279689CAUL,0x082136F0UL,0x78F9F7BEUL,0x574E4884UL,0x99487522UL,0xB6FFCA18UL,
+    0xC6270B56UL,0xE990B46CUL,0x5EEA6DADUL,0x715DD297UL,0x018513D9UL,0x2E32ACE3UL,
+    0xE0349145UL,0xCF832E7FUL,0xBF5BEF31UL,0x90EC500BUL,0xD56F4104UL,0xFAD8FE3EUL,
+    0x8A003F70UL,0xA5B7804AUL,0x6BB1BDECUL,0x440602D6UL,0x34DEC398UL,0x1B697CA2UL,
+    0xAC13A563UL,0x83A41A59UL,0xF37CDB17UL,0xDCCB642DUL,0x12CD598BUL,0x3D7AE6B1UL,
+    0x4DA227FFUL,0x621598C5UL,0x89891675UL,0xA63EA94FUL,0xD6E66801UL,0xF951D73BUL,
+    0x3757EA9DUL,0x18E055A7UL,0x683894E9UL,0x478F2BD3UL,0xF0F5F212UL,0xDF424D28UL,
+    0xAF9A8C66UL,0x802D335CUL,0x4E2B0EFAUL,0x619CB1C0UL,0x1144708EUL,0x3EF3CFB4UL,
+    0x7B70DEBBUL,0x54C76181UL,0x241FA0CFUL,0x0BA81FF5UL,0xC5AE2253UL,0xEA199D69UL,
+    0x9AC15C27UL,0xB576E31DUL,0x020C3ADCUL,0x2DBB85E6UL,0x5D6344A8UL,0x72D4FB92UL,
+    0xBCD2C634UL,0x9365790EUL,0xE3BDB840UL,0xCC0A077AUL,0x68BB9A5EUL,0x470C2564UL,
+    0x37D4E42AUL,0x18635B10UL,0xD66566B6UL,0xF9D2D98CUL,0x890A18C2UL,0xA6BDA7F8UL,
+    0x11C77E39UL,0x3E70C103UL,0x4EA8004DUL,0x611FBF77UL,0xAF1982D1UL,0x80AE3DEBUL,
+    0xF076FCA5UL,0xDFC1439FUL,0x9A425290UL,0xB5F5EDAAUL,0xC52D2CE4UL,0xEA9A93DEUL,
+    0x249CAE78UL,0x0B2B1142UL,0x7BF3D00CUL,0x54446F36UL,0xE33EB6F7UL,0xCC8909CDUL,
+    0xBC51C883UL,0x93E677B9UL,0x5DE04A1FUL,0x7257F525UL,0x028F346BUL,0x2D388B51UL,
+    0x4F2D1394UL,0x609AACAEUL,0x10426DE0UL,0x3FF5D2DAUL,0xF1F3EF7CUL,0xDE445046UL,
+    0xAE9C9108UL,0x812B2E32UL,0x3651F7F3UL,0x19E648C9UL,0x693E8987UL,0x468936BDUL,
+    0x888F0B1BUL,0xA738B421UL,0xD7E0756FUL,0xF857CA55UL,0xBDD4DB5AUL,0x92636460UL,
+    0xE2BBA52EUL,0xCD0C1A14UL,0x030A27B2UL,0x2CBD9888UL,0x5C6559C6UL,0x73D2E6FCUL,
+    0xC4A83F3DUL,0xEB1F8007UL,0x9BC74149UL,0xB470FE73UL,0x7A76C3D5UL,0x55C17CEFUL,
+    0x2519BDA1UL,0x0AAE029BUL,0xAE1F9FBFUL,0x81A82085UL,0xF170E1CBUL,0xDEC75EF1UL,
+    0x10C16357UL,0x3F76DC6DUL,0x4FAE1D23UL,0x6019A219UL,0xD7637BD8UL,0xF8D4C4E2UL,
+    0x880C05ACUL,0xA7BBBA96UL,0x69BD8730UL,0x460A380AUL,0x36D2F944UL,0x1965467EUL,
+    0x5CE65771UL,0x7351E84BUL,0x03892905UL,0x2C3E963FUL,0xE238AB99UL,0xCD8F14A3UL,
+    0xBD57D5EDUL,0x92E06AD7UL,0x259AB316UL,0x0A2D0C2CUL,0x7AF5CD62UL,0x55427258UL,
+    0x9B444FFEUL,0xB4F3F0C4UL,0xC42B318AUL,0xEB9C8EB0UL
+};
+
+/* b * x^96 mod P */
+static const uint32_t CRC32_TableE0[256]=
+{
+    0x00000000UL,0xF200AA66UL,0xE0C0497BUL,0x12C0E31DUL,0xC5418F41UL,0x37412527UL,
+    0x2581C63AUL,0xD7816C5CUL,0x8E420335UL,0x7C42A953UL,0x6E824A4EUL,0x9C82E028UL,
+    0x4B038C74UL,0xB9032612UL,0xABC3C50FUL,0x59C36F69UL,0x18451BDDUL,0xEA45B1BBUL,
+    0xF88552A6UL,0x0A85F8C0UL,0xDD04949CUL,0x2F043EFAUL,0x3DC4DDE7UL,0xCFC47781UL,
+    0x960718E8UL,0x6407B28EUL,0x76C75193UL,0x84C7FBF5UL,0x534697A9UL,0xA1463DCFUL,
+    0xB386DED2UL,0x418674B4UL,0x308A37BAUL,0xC28A9DDCUL,0xD04A7EC1UL,0x224AD4A7UL,
+    0xF5CBB8FBUL,0x07CB129DUL,0x150BF180UL,0xE70B5BE6UL,0xBEC8348FUL,0x4CC89EE9UL,
+    0x5E087DF4UL,0xAC08D792UL,0x7B89BBCEUL,0x898911A8UL,0x9B49F2B5UL,0x694958D3UL,
+    0x28CF2C67UL,0xDACF8601UL,0xC80F651CUL,0x3A0FCF7AUL,0xED8EA326UL,0x1F8E0940UL,
+    0x0D4EEA5DUL,0xFF4E403BUL,0xA68D2F52UL,0x548D8534UL,0x464D6629UL,0xB44DCC4FUL,
+    0x63CCA013UL,0x91CC0A75UL,0x830CE968UL,0x710C430EUL,0x61146F74UL,0x9314C512UL,
+    0x81D4260FUL,0x73D48C69UL,0xA455E035UL,0x56554A53UL,0x4495A94EUL,0xB6950328UL,
+    0xEF566C41UL,0x1D56C627UL,0x0F96253AUL,0xFD968F5CUL,0x2A17E300UL,0xD8174966UL,
+    0xCAD7AA7BUL,0x38D7001DUL,0x795174A9UL,0x8B51DECFUL,0x99913DD2UL,0x6B9197B4UL,
+    0xBC10FBE8UL,0x4E10518EUL,0x5CD0B293UL,0xAED018F5UL,0xF713779CUL,0x0513DDFAUL,
+    0x17D33EE7UL,0xE5D39481UL,0x3252F8DDUL,0xC05252BBUL,0xD292B1A6UL,0x20921BC0UL,
+    0x519E58CEUL,0xA39EF2A8UL,0xB15E11B5UL,0x435EBBD3UL,0x94DFD78FUL,0x66DF7DE9UL,
+    0x741F9EF4UL,0x861F3492UL,0xDFDC5BFBUL,0x2DDCF19DUL,0x3F1C1280UL,0xCD1CB8E6UL,
+    0x1A9DD4BAUL,0xE89D7EDCUL,0xFA5D9DC1UL,0x085D37A7UL,0x49DB4313UL,0xBBDBE975UL,
+    0xA91B0A68UL,0x5B1BA00EUL,0x8C9ACC52UL,0x7E9A6634UL,0x6C5A8529UL,0x9E5A2F4FUL,
+    0xC7994026UL,0x3599EA40UL,0x2759095DUL,0xD559A33BUL,0x02D8CF67UL,0xF0D86501UL,
+    0xE218861CUL,0x10182C7AUL,0xC228DEE8UL,0x3028748EUL,0x22E89793UL,0xD0E83DF5UL,
+    0x076951A9UL,0xF569FBCFUL,0xE7A918D2UL,0x15A9B2B4UL,0x4C6ADDDDUL,0xBE6A77BBUL,
+    0xACAA94A6UL,0x5EAA3EC0UL,0x892B529CUL,0x7B2BF8FAUL,0x69EB1BE7UL,0x9BEBB181UL,
+    0xDA6DC535UL,0x286D6F53UL,0x3AAD8C4EUL,0xC8AD2628UL,0x1F2C4A74UL,0xED2CE012UL,
+    0xFFEC030FUL,0x0DECA969UL,0x542FC600UL,0xA62F6C66UL,0xB4EF8F7BUL,0x46EF251DUL,
+    0x916E4941UL,0x636EE327UL,0x71AE003AUL,0x83AEAA5CUL,0xF2A2E952UL,0x00A24334UL,
+    0x1262A029UL,0xE0620A4FUL,0x37E36613UL,0xC5E3CC75UL,0xD7232F68UL,0x2523850EUL,
+    0x7CE0EA67UL,0x8EE04001UL,0x9C20A31CUL,0x6E20097AUL,0xB9A16526UL,0x4BA1CF40UL,
+    0x59612C5DUL,0xAB61863BUL,0xEAE7F28FUL,0x18E758E9UL,0x0A27BBF4UL,0xF8271192UL,
+    0x2FA67DCEUL,0xDDA6D7A8UL,0xCF6634B5UL,0x3D669ED3UL,0x64A5F1BAUL,0x96A55BDCUL,
+    0x8465B8C1UL,0x766512A7UL,0xA1E47EFBUL,0x53E4D49DUL,0x41243780UL,0xB3249DE6UL,
+    0xA33CB19CUL,0x513C1BFAUL,0x43FCF8E7UL,0xB1FC5281UL,0x667D3EDDUL,0x947D94BBUL,
+    0x86BD77A6UL,0x74BDDDC0UL,0x2D7EB2A9UL,0xDF7E18CFUL,0xCDBEFBD2UL,0x3FBE51B4UL,
+    0xE83F3DE8UL,0x1A3F978EUL,0x08FF7493UL,0xFAFFDEF5UL,0xBB79AA41UL,0x49790027UL,
+    0x5BB9E33AUL,0xA9B9495CUL,0x7E382500UL,0x8C388F66UL,0x9EF86C7BUL,0x6CF8C61DUL,
+    0x353BA974UL,0xC73B0312UL,0xD5FBE00FUL,0x27FB4A69UL,0xF07A2635UL,0x027A8C53UL,
+    0x10BA6F4EUL,0xE2BAC528UL,0x93B68626UL,0x61B62C40UL,0x7376CF5DUL,0x8176653BUL,
+    0x56F70967UL,0xA4F7A301UL,0xB637401CUL,0x4437EA7AUL,0x1DF48513UL,0xEFF42F75UL,
+    0xFD34CC68UL,0x0F34660EUL,0xD8B50A52UL,0x2AB5A034UL,0x38754329UL,0xCA75E94FUL,
+    0x8BF39DFBUL,0x79F3379DUL,0x6B33D480UL,0x99337EE6UL,0x4EB212BAUL,0xBCB2B8DCUL,
+    0xAE725BC1UL,0x5C72F1A7UL,0x05B19ECEUL,0xF7B134A8UL,0xE571D7B5UL,0x17717DD3UL,
+    0xC0F0118FUL,0x32F0BBE9UL,0x203058F4UL,0xD230F292UL
+};
+
+/* b * x^64 mod P */
+static const uint32_t CRC32_TableD0[256]=
+{
+    0x00000000UL,0x490D678DUL,0x921ACF1AUL,0xDB17A897UL,0x20F48383UL,0x69F9E40EUL,
+    0xB2EE4C99UL,0xFBE32B14UL,0x41E90706UL,0x08E4608BUL,0xD3F3C81CUL,0x9AFEAF91UL,
+    0x611D8485UL,0x2810E308UL,0xF3074B9FUL,0xBA0A2C12UL,0x83D20E0CUL,0xCADF6981UL,
+    0x11C8C116UL,0x58C5A69BUL,0xA3268D8FUL,0xEA2BEA02UL,0x313C4295UL,0x78312518UL,
+    0xC23B090AUL,0x8B366E87UL,0x5021C610UL,0x192CA19DUL,0xE2CF8A89UL,0xABC2ED04UL,
+    0x70D54593UL,0x39D8221EUL,0x036501AFUL,0x4A686622UL,0x917FCEB5UL,0xD872A938UL,
+    0x2391822CUL,0x6A9CE5A1UL,0xB18B4D36UL,0xF8862ABBUL,0x428C06A9UL,0x0B816124UL,
+    0xD096C9B3UL,0x999BAE3EUL,0x6278852AUL,0x2B75E2A7UL,0xF0624A30UL,0xB96F2DBDUL,
+    0x80B70FA3UL,0xC9BA682EUL,0x12ADC0B9UL,0x5BA0A734UL,0xA0438C20UL,0xE94EEBADUL,
+    0x3259433AUL,0x7B5424B7UL,0xC15E08A5UL,0x88536F28UL,0x5344C7BFUL,0x1A49A032UL,
+    0xE1AA8B26UL,0xA8A7ECABUL,0x73B0443CUL,0x3ABD23B1UL,0x06CA035EUL,0x4FC764D3UL,
+    0x94D0CC44UL,0xDDDDABC9UL,0x263E80DDUL,0x6F33E750UL,0xB4244FC7UL,0xFD29284AUL,
+    0x47230458UL,0x0E2E63D5UL,0xD539CB42UL,0x9C34ACCFUL,0x67D787DBUL,0x2EDAE056UL,
+    0xF5CD48C1UL,0xBCC02F4CUL,0x85180D52UL,0xCC156ADFUL,0x1702C248UL,0x5E0FA5C5UL,
+    0xA5EC8ED1UL,0xECE1E95CUL,0x37F641CBUL,0x7EFB2646UL,0xC4F10A54UL,0x8DFC6DD9UL,
+    0x56EBC54EUL,0x1FE6A2C3UL,0xE40589D7UL,0xAD08EE5AUL,0x761F46CDUL,0x3F122140UL,
+    0x05AF02F1UL,0x4CA2657CUL,0x97B5CDEBUL,0xDEB8AA66UL,0x255B8172UL,0x6C56E6FFUL,
+    0xB7414E68UL,0xFE4C29E5UL,0x444605F7UL,0x0D4B627AUL,0xD65CCAEDUL,0x9F51AD60UL,
+    0x64B28674UL,0x2DBFE1F9UL,0xF6A8496EUL,0xBFA52EE3UL,0x867D0CFDUL,0xCF706B70UL,
+    0x1467C3E7UL,0x5D6AA46AUL,0xA6898F7EUL,0xEF84E8F3UL,0x34934064UL,0x7D9E27E9UL,
+    0xC7940BFBUL,0x8E996C76UL,0x558EC4E1UL,0x1C83A36CUL,0xE7608878UL,0xAE6DEFF5UL,
+    0x757A4762UL,0x3C7720EFUL,0x0D9406BCUL,0x44996131UL,0x9F8EC9A6UL,0xD683AE2BUL,
+    0x2D60853FUL,0x646DE2B2UL,0xBF7A4A25UL,0xF6772DA8UL,0x4C7D01BAUL,0x05706637UL,
+    0xDE67CEA0UL,0x976AA92DUL,0x6C898239UL,0x2584E5B4UL,0xFE934D23UL,0xB79E2AAEUL,
+    0x8E4608B0UL,0xC74B6F3DUL,0x1C5CC7AAUL,0x5551A027UL,0xAEB28B33UL,0xE7BFECBEUL,
+    0x3CA84429UL,0x75A523A4UL,0xCFAF0FB6UL,0x86A2683BUL,0x5DB5C0ACUL,0x14B8A721UL,
+    0xEF5B8C35UL,0xA656EBB8UL,0x7D41432FUL,0x344C24A2UL,0x0EF10713UL,0x47FC609EUL,
+    0x9CEBC809UL,0xD5E6AF84UL,0x2E058490UL,0x6708E31DUL,0xBC1F4B8AUL,0xF5122C07UL,
+    0x4F180015UL,0x06156798UL,0xDD02CF0FUL,0x940FA882UL,0x6FEC8396UL,0x26E1E41BUL,
+    0xFDF64C8CUL,0xB4FB2B01UL,0x8D23091FUL,0xC42E6E92UL,0x1F39C605UL,0x5634A188UL,
+    0xADD78A9CUL,0xE4DAED11UL,0x3FCD4586UL,0x76C0220BUL,0xCCCA0E19UL,0x85C76994UL,
+    0x5ED0C103UL,0x17DDA68EUL,0xEC3E8D9AUL,0xA533EA17UL,0x7E244280UL,0x3729250DUL,
+    0x0B5E05E2UL,0x4253626FUL,0x9944CAF8UL,0xD049AD75UL,0x2BAA8661UL,0x62A7E1ECUL,
+    0xB9B0497BUL,0xF0BD2EF6UL,0x4AB702E4UL,0x03BA6569UL,0xD8ADCDFEUL,0x91A0AA73UL,
+    0x6A438167UL,0x234EE6EAUL,0xF8594E7DUL,0xB15429F0UL,0x888C0BEEUL,0xC1816C63UL,
+    0x1A96C4F4UL,0x539BA379UL,0xA878886DUL,0xE175EFE0UL,0x3A624777UL,0x736F20FAUL,
+    0xC9650CE8UL,0x80686B65UL,0x5B7FC3F2UL,0x1272A47FUL,0xE9918F6BUL,0xA09CE8E6UL,
+    0x7B8B4071UL,0x328627FCUL,0x083B044DUL,0x413663C0UL,0x9A21CB57UL,0xD32CACDAUL,
+    0x28CF87CEUL,0x61C2E043UL,0xBAD548D4UL,0xF3D82F59UL,0x49D2034BUL,0x00DF64C6UL,
+    0xDBC8CC51UL,0x92C5ABDCUL,0x692680C8UL,0x202BE745UL,0xFB3C4FD2UL,0xB231285FUL,
+    0x8BE90A41UL,0xC2E46DCCUL,0x19F3C55BUL,0x50FEA2D6UL,0xAB1D89C2UL,0xE210EE4FUL,
+    0x390746D8UL,0x700A2155UL,0xCA000D47UL,0x830D6ACAUL,0x581AC25DUL,0x1117A5D0UL,
+    0xEAF48EC4UL,0xA3F9E949UL,0x78EE41DEUL,0x31E32653UL
+};
+#endif
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/*************************************************************************************************
+ * \Syntax          : uint32_t CRC32_Update(uint32_t Copy_CRC,const uint8_t* Copy_Buffer,uint32_t Copy_Length)
+ * \Description     : Continue a CRC calculation over a new chunk of data
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_CRC:    The CRC of the previous chunks (CRC32_INIT_VALUE for the first one)
+ *                    Copy_Buffer: Data to Calculate the CRC for
+ *                    Copy_Length: Data Length
+ * \Parameters (out): None
+ * \Return value:   : uint32_t
+ *                    The Updated CRC
+ *************************************************************************************************/
+uint32_t CRC32_Update(uint32_t Copy_CRC,const uint8_t* Copy_Buffer,uint32_t Copy_Length)
+{
+    uint32_t Local_Counter=0;
+#if CRC32_ENGINE==CRC32_ENGINE_BITWISE
+    uint8_t Local_Bit=0;
+    for( ;Local_Counter<Copy_Length;Local_Counter++)
+    {
+        Copy_CRC^=Copy_Buffer[Local_Counter];
+        for(Local_Bit=0;Local_Bit<32U;Local_Bit++)
+        {
+            if(Copy_CRC & 0x80000000UL)
+            {
+                Copy_CRC=(Copy_CRC<<1)^CRC32_POLYNOMIAL;
+            }
+            else
+            {
+                Copy_CRC=(Copy_CRC<<1);
+            }
+        }
+    }
+#elif CRC32_ENGINE==CRC32_ENGINE_TABLE
+    for( ;Local_Counter<Copy_Length;Local_Counter++)
+    {
+        Copy_CRC^=Copy_Buffer[Local_Counter];
+        /*Four byte steps are the 32 shifts of the bitwise engine*/
+        Copy_CRC=(Copy_CRC<<8)^CRC32_TableS0[Copy_CRC>>24];
+        Copy_CRC=(Copy_CRC<<8)^CRC32_TableS0[Copy_CRC>>24];
+        Copy_CRC=(Copy_CRC<<8)^CRC32_TableS0[Copy_CRC>>24];
+        Copy_CRC=(Copy_CRC<<8)^CRC32_TableS0[Copy_CRC>>24];
+    }
+#elif CRC32_ENGINE==CRC32_ENGINE_SLICE_BY_4
+    for( ;Local_Counter<Copy_Length;Local_Counter++)
+    {
+        Copy_CRC^=Copy_Buffer[Local_Counter];
+        Copy_CRC=CRC32_TableS3[Copy_CRC>>24]^CRC32_TableS2[(Copy_CRC>>16)&0xFFU]^
+                 CRC32_TableS1[(Copy_CRC>>8)&0xFFU]^CRC32_TableS0[Copy_CRC&0xFFU];
+    }
+#elif CRC32_ENGINE==CRC32_ENGINE_SLICE_BY_8
+    /*Four data bytes per step: the first one is folded into the CRC register and shifted by x^128,
+     *the other three are shifted by x^96, x^64 and x^32 respectively*/
+    for( ;(Local_Counter+4U)<=Copy_Length;Local_Counter+=4U)
+    {
+        Copy_CRC^=Copy_Buffer[Local_Counter];
+        Copy_CRC=CRC32_TableQ3[Copy_CRC>>24]^CRC32_TableQ2[(Copy_CRC>>16)&0xFFU]^
+                 CRC32_TableQ1[(Copy_CRC>>8)&0xFFU]^CRC32_TableQ0[Copy_CRC&0xFFU]^
+                 CRC32_TableE0[Copy_Buffer[Local_Counter+1U]]^CRC32_TableD0[Copy_Buffer[Local_Counter+2U]]^
+                 CRC32_TableS0[Copy_Buffer[Local_Counter+3U]];
+    }
+    /*Remaining tail bytes one at a time*/
+    for( ;Local_Counter<Copy_Length;Local_Counter++)
+    {
+        Copy_CRC^=Copy_Buffer[Local_Counter];
+        Copy_CRC=(Copy_CRC<<8)^CRC32_TableS0[Copy_CRC>>24];
+        Copy_CRC=(Copy_CRC<<8)^CRC32_TableS0[Copy_CRC>>24];
+        Copy_CRC=(Copy_CRC<<8)^CRC32_TableS0[Copy_CRC>>24];
+        Copy_CRC=(Copy_CRC<<8)^CRC32_TableS0[Copy_CRC>>24];
+    }
+#endif
+    return Copy_CRC;
+}
+
+/******************************************************************************
+ * \Syntax          : uint32_t CRC32_Calculate(const uint8_t* Copy_Buffer,uint32_t Copy_Length)
+ * \Description     : Calculate the CRC of a complete buffer
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Buffer: Data to Calculate the CRC for
+ *                    Copy_Length: Data Length
+ * \Parameters (out): None
+ * \Return value:   : uint32_t
+ *                    The Calculated CRC
+ *******************************************************************************/
+uint32_t CRC32_Calculate(const uint8_t* Copy_Buffer,uint32_t Copy_Length)
+{
+    return CRC32_Update(CRC32_INIT_VALUE,Copy_Buffer,Copy_Length);
+}
+/**********************************************************************************************************************
+ *  END OF FILE: Crc32.c
+ *********************************************************************************************************************/
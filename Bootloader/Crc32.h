@@ -0,0 +1,79 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *       Author:  Mahmoud Badr
+ *         File:  Crc32.h
+ *        Layer:  App
+ *       Module:  Crc32
+ *      Version:  1.00
+ *
+ *  Description:  CRC32 engine used to protect the packets exchanged with the host.
+ *                Polynomial 0x04C11DB7, MSB first, initial value 0xFFFFFFFF, no final XOR,
+ *                every byte is XORed into the low byte of the CRC register and then shifted 32 times.
+ *
+ *********************************************************************************************************************/
+
+#ifndef CRC32_H_
+#define CRC32_H_
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <stdint.h>
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+#define CRC32_ENGINE_BITWISE    0x01
+#define CRC32_ENGINE_TABLE      0x02
+#define CRC32_ENGINE_SLICE_BY_4 0x03
+#define CRC32_ENGINE_SLICE_BY_8 0x04
+
+/* Set the CRC32 Engine
+ * CRC32_ENGINE_BITWISE    : 32 shifts per byte, no tables
+ * CRC32_ENGINE_TABLE      : 1 KB table, 4 lookups per byte
+ * CRC32_ENGINE_SLICE_BY_4 : 4 KB tables, 4 independent lookups per byte
+ * CRC32_ENGINE_SLICE_BY_8 : 7 KB tables, 7 independent lookups per 4 bytes */
+#ifndef CRC32_ENGINE
+#define CRC32_ENGINE            CRC32_ENGINE_SLICE_BY_8
+#endif
+
+#define CRC32_INIT_VALUE        0xFFFFFFFFUL
+#define CRC32_POLYNOMIAL        0x04C11DB7UL
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+/*************************************************************************************************
+ * \Syntax          : uint32_t CRC32_Update(uint32_t Copy_CRC,const uint8_t* Copy_Buffer,uint32_t Copy_Length)
+ * \Description     : Continue a CRC calculation over a new chunk of data
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_CRC:    The CRC of the previous chunks (CRC32_INIT_VALUE for the first one)
+ *                    Copy_Buffer: Data to Calculate the CRC for
+ *                    Copy_Length: Data Length
+ * \Parameters (out): None
+ * \Return value:   : uint32_t
+ *                    The Updated CRC
+ *************************************************************************************************/
+uint32_t CRC32_Update(uint32_t Copy_CRC,const uint8_t* Copy_Buffer,uint32_t Copy_Length);
+
+/******************************************************************************
+ * \Syntax          : uint32_t CRC32_Calculate(const uint8_t* Copy_Buffer,uint32_t Copy_Length)
+ * \Description     : Calculate the CRC of a complete buffer
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Buffer: Data to Calculate the CRC for
+ *                    Copy_Length: Data Length
+ * \Parameters (out): None
+ * \Return value:   : uint32_t
+ *                    The Calculated CRC
+ *******************************************************************************/
+uint32_t CRC32_Calculate(const uint8_t* Copy_Buffer,uint32_t Copy_Length);
+
+#endif
+/**********************************************************************************************************************
+ *  END OF FILE: Crc32.h
+ *********************************************************************************************************************/
@@ -0,0 +1,246 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *       Author:  Mahmoud Badr
+ *         File:  Fls.c
+ *        Layer:  App
+ *       Module:  Fls
+ *      Version:  1.00
+ *
+ *  Description:  Non blocking flash programming engine built directly on the flash controller registers
+ *                (FMA, FWBn and FMC2.WRBUF), the same sequence FlashProgram uses but one block per call.
+ *                Erase jobs use FMC.ERASE the way FlashErase does, without waiting for the end.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "Fls.h"
+#include "inc/hw_types.h"
+#include "inc/hw_flash.h"
+
+/**********************************************************************************************************************
+ *  LOCAL MACROS CONSTANT\FUNCTION
+ *********************************************************************************************************************/
+#define FLS_BLOCK_MASK          (FLS_WRITE_BUFFER_SIZE-1U)
+#define FLS_ERROR_FLAGS         (FLASH_FCRIS_ARIS | FLASH_FCRIS_VOLTRIS | FLASH_FCRIS_INVDRIS | FLASH_FCRIS_PROGRIS)
+#define FLS_ERROR_CLEAR         (FLASH_FCMISC_AMISC | FLASH_FCMISC_VOLTMISC | FLASH_FCMISC_INVDMISC | FLASH_FCMISC_PROGMISC)
+#define FLS_ERASE_ERROR_FLAGS   (FLASH_FCRIS_ARIS | FLASH_FCRIS_VOLTRIS | FLASH_FCRIS_ERRIS)
+#define FLS_ERASE_ERROR_CLEAR   (FLASH_FCMISC_AMISC | FLASH_FCMISC_VOLTMISC | FLASH_FCMISC_ERMISC)
+
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+static const uint8_t* FLS_JobData=0;
+static uint32_t FLS_JobAddress=0U;
+static uint32_t FLS_JobRemaining=0U;
+static bool FLS_BlockActive=false;
+static bool FLS_JobErase=false;
+static FLS_Status_t FLS_JobStatus=FLS_IDLE;
+
+/**********************************************************************************************************************
+ *  LOCAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/******************************************************************************
+ * \Syntax          : void FLS_LoadBlock(void)
+ * \Description     : Fill the write buffer up to the end of the current block, with at most
+ *                    FLS_PROGRAM_BURST_WORDS words, and start it
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+static void FLS_LoadBlock(void)
+{
+    uint32_t Local_Word=0U;
+    uint8_t Local_Byte=0U;
+    uint8_t Local_Words=0U;
+    HWREG(FLASH_FMA)=FLS_JobAddress & ~FLS_BLOCK_MASK;
+    do
+    {
+        /*Assemble the word byte by byte, the payload is not necessarily aligned, pad the tail with 0xFF*/
+        Local_Word=0xFFFFFFFFUL;
+        for(Local_Byte=0U;(Local_Byte<4U) && (Local_Byte<FLS_JobRemaining);Local_Byte++)
+        {
+            Local_Word&=~(0xFFUL<<(8U*Local_Byte));
+            Local_Word|=((uint32_t)FLS_JobData[Local_Byte])<<(8U*Local_Byte);
+        }
+        HWREG(FLASH_FWBN+(FLS_JobAddress & FLS_BLOCK_MASK))=Local_Word;
+        FLS_JobData+=Local_Byte;
+        FLS_JobRemaining-=Local_Byte;
+        FLS_JobAddress+=4U;
+        Local_Words++;
+    }while((FLS_JobRemaining!=0U) && ((FLS_JobAddress & FLS_BLOCK_MASK)!=0U) && (Local_Words<FLS_PROGRAM_BURST_WORDS));
+    /*Program all the valid words of the buffer at once*/
+    HWREG(FLASH_FMC2)=FLASH_FMC2_WRKEY | FLASH_FMC2_WRBUF;
+    FLS_BlockActive=true;
+}
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/*************************************************************************************************
+ * \Syntax          : bool FLS_ProgramStart(const uint8_t* Copy_Data,uint32_t Copy_Address,uint32_t Copy_Length)
+ * \Description     : Queue a program job, the tail of a length that is not a multiple of 4 is padded with 0xFF
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Data:    Data to be programmed, must stay untouched until the job ends
+ *                    Copy_Address: Word aligned flash address
+ *                    Copy_Length:  Data Length in bytes
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false (engine busy or unaligned address)
+ *************************************************************************************************/
+bool FLS_ProgramStart(const uint8_t* Copy_Data,uint32_t Copy_Address,uint32_t Copy_Length)
+{
+    bool Local_State=false;
+    if((FLS_JobStatus!=FLS_BUSY) && ((Copy_Address & 3U)==0U))
+    {
+        FLS_JobData=Copy_Data;
+        FLS_JobAddress=Copy_Address;
+        FLS_JobRemaining=Copy_Length;
+        FLS_BlockActive=false;
+        FLS_JobErase=false;
+        /*Clear the error flags of the previous job*/
+        HWREG(FLASH_FCMISC)=FLS_ERROR_CLEAR;
+        FLS_JobStatus=FLS_BUSY;
+        Local_State=true;
+    }
+    return Local_State;
+}
+
+/*************************************************************************************************
+ * \Syntax          : bool FLS_EraseStart(uint32_t Copy_Address)
+ * \Description     : Start the erase of one flash sector as a job of the engine
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Address: Sector aligned flash address
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false (engine busy or unaligned address)
+ *************************************************************************************************/
+bool FLS_EraseStart(uint32_t Copy_Address)
+{
+    bool Local_State=false;
+    if((FLS_JobStatus!=FLS_BUSY) && ((Copy_Address & (FLS_SECTOR_SIZE-1U))==0U))
+    {
+        FLS_JobRemaining=0U;
+        FLS_BlockActive=false;
+        FLS_JobErase=true;
+        /*Clear the error flags of the previous job*/
+        HWREG(FLASH_FCMISC)=FLS_ERASE_ERROR_CLEAR;
+        HWREG(FLASH_FMA)=Copy_Address;
+        HWREG(FLASH_FMC)=FLASH_FMC_WRKEY | FLASH_FMC_ERASE;
+        FLS_JobStatus=FLS_BUSY;
+        Local_State=true;
+    }
+    return Local_State;
+}
+
+/******************************************************************************
+ * \Syntax          : FLS_Status_t FLS_Service(void)
+ * \Description     : Advance the running job by at most one write buffer block
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : FLS_Status_t
+ *                    FLS_IDLE - FLS_BUSY - FLS_DONE - FLS_ERROR
+ *******************************************************************************/
+FLS_Status_t FLS_Service(void)
+{
+    if((FLS_JobStatus==FLS_BUSY) && (FLS_JobErase==true))
+    {
+        /*The controller clears ERASE when the sector is erased*/
+        if((HWREG(FLASH_FMC) & FLASH_FMC_ERASE)==0U)
+        {
+            FLS_JobStatus=((HWREG(FLASH_FCRIS) & FLS_ERASE_ERROR_FLAGS)!=0U) ? FLS_ERROR : FLS_DONE;
+        }
+    }
+    else if(FLS_JobStatus==FLS_BUSY)
+    {
+        if(FLS_BlockActive==true)
+        {
+            /*The controller clears WRBUF when the block is programmed*/
+            if((HWREG(FLASH_FMC2) & FLASH_FMC2_WRBUF)==0U)
+            {
+                FLS_BlockActive=false;
+                if((HWREG(FLASH_FCRIS) & FLS_ERROR_FLAGS)!=0U)
+                {
+                    FLS_JobStatus=FLS_ERROR;
+                }
+            }
+        }
+        if((FLS_JobStatus==FLS_BUSY) && (FLS_BlockActive==false))
+        {
+            if(FLS_JobRemaining==0U)
+            {
+                FLS_JobStatus=FLS_DONE;
+            }
+            else
+            {
+                FLS_LoadBlock();
+            }
+        }
+    }
+    return FLS_JobStatus;
+}
+
+/******************************************************************************
+ * \Syntax          : FLS_Status_t FLS_WaitJob(void)
+ * \Description     : Service the running job until it ends and release the engine
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : FLS_Status_t
+ *                    FLS_IDLE (nothing was running) - FLS_DONE - FLS_ERROR
+ *******************************************************************************/
+FLS_Status_t FLS_WaitJob(void)
+{
+    FLS_Status_t Local_Status=FLS_IDLE;
+    while(FLS_Service()==FLS_BUSY)
+    {
+        /*Do Nothing*/
+    }
+    Local_Status=FLS_JobStatus;
+    FLS_JobStatus=FLS_IDLE;
+    return Local_Status;
+}
+/*************************************************************************************************
+ * \Syntax          : bool FLS_IsBlank(uint32_t Copy_Address,uint32_t Copy_Length)
+ * \Description     : Check that a word aligned flash range reads as erased (all 0xFF)
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Address: Word aligned flash address
+ *                    Copy_Length:  Range length in bytes, a multiple of 16
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false
+ *************************************************************************************************/
+bool FLS_IsBlank(uint32_t Copy_Address,uint32_t Copy_Length)
+{
+    const volatile uint32_t* Local_Word=(const volatile uint32_t*)FLS_MEMORY(Copy_Address);
+    const volatile uint32_t* Local_End=(const volatile uint32_t*)FLS_MEMORY(Copy_Address+Copy_Length);
+    uint32_t Local_And=0xFFFFFFFFUL;
+    /*AND four words per step and stop at the first programmed bit*/
+    while((Local_Word<Local_End) && (Local_And==0xFFFFFFFFUL))
+    {
+        Local_And=Local_Word[0] & Local_Word[1] & Local_Word[2] & Local_Word[3];
+        Local_Word+=4;
+    }
+    return (Local_And==0xFFFFFFFFUL);
+}
+/**********************************************************************************************************************
+ *  END OF FILE: Fls.c
+ *********************************************************************************************************************/
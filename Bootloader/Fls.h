@@ -0,0 +1,129 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *       Author:  Mahmoud Badr
+ *         File:  Fls.h
+ *        Layer:  App
+ *       Module:  Fls
+ *      Version:  1.00
+ *
+ *  Description:  Non blocking flash programming engine.
+ *                A job is split into the 32-word blocks of the flash write buffer, FLS_Service loads and
+ *                starts one block per call so the caller can keep receiving the next packet meanwhile.
+ *                A job may also be a single sector erase, FLS_Service then only polls for its end.
+ *
+ *********************************************************************************************************************/
+
+#ifndef FLS_H_
+#define FLS_H_
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+#define FLS_WRITE_BUFFER_WORDS  32U
+#define FLS_WRITE_BUFFER_SIZE   (FLS_WRITE_BUFFER_WORDS*4U)
+#define FLS_SECTOR_SIZE         1024U
+/* Words programmed by one write buffer operation. The CPU runs from flash and stalls until the
+ * operation ends, no ISR drains the UART RX FIFO meanwhile while a pipelined write receives the
+ * next packet: 4 words fit the free FIFO space up to 921600 baud, 2 words up to 2 Mbaud */
+#ifndef FLS_PROGRAM_BURST_WORDS
+#define FLS_PROGRAM_BURST_WORDS 4U
+#endif
+/* CPU view of a flash address, a host build (Sim/) keeps its flash image away from address 0 */
+#ifndef FLS_MEMORY_BASE
+#define FLS_MEMORY_BASE         0UL
+#endif
+#define FLS_MEMORY(Address)     ((const uint8_t*)(FLS_MEMORY_BASE+(Address)))
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+typedef enum
+{
+    FLS_IDLE=0,
+    FLS_BUSY,
+    FLS_DONE,
+    FLS_ERROR
+}FLS_Status_t;
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+/*************************************************************************************************
+ * \Syntax          : bool FLS_ProgramStart(const uint8_t* Copy_Data,uint32_t Copy_Address,uint32_t Copy_Length)
+ * \Description     : Queue a program job, the tail of a length that is not a multiple of 4 is padded with 0xFF
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Data:    Data to be programmed, must stay untouched until the job ends
+ *                    Copy_Address: Word aligned flash address
+ *                    Copy_Length:  Data Length in bytes
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false (engine busy or unaligned address)
+ *************************************************************************************************/
+bool FLS_ProgramStart(const uint8_t* Copy_Data,uint32_t Copy_Address,uint32_t Copy_Length);
+
+/*************************************************************************************************
+ * \Syntax          : bool FLS_EraseStart(uint32_t Copy_Address)
+ * \Description     : Start the erase of one flash sector as a job of the engine
+ *
+ * \Sync\Async      : Asynchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Address: Sector aligned flash address
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false (engine busy or unaligned address)
+ *************************************************************************************************/
+bool FLS_EraseStart(uint32_t Copy_Address);
+
+/******************************************************************************
+ * \Syntax          : FLS_Status_t FLS_Service(void)
+ * \Description     : Advance the running job by at most one write buffer block
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : FLS_Status_t
+ *                    FLS_IDLE - FLS_BUSY - FLS_DONE - FLS_ERROR
+ *******************************************************************************/
+FLS_Status_t FLS_Service(void);
+
+/******************************************************************************
+ * \Syntax          : FLS_Status_t FLS_WaitJob(void)
+ * \Description     : Service the running job until it ends and release the engine
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : FLS_Status_t
+ *                    FLS_IDLE (nothing was running) - FLS_DONE - FLS_ERROR
+ *******************************************************************************/
+FLS_Status_t FLS_WaitJob(void);
+
+/*************************************************************************************************
+ * \Syntax          : bool FLS_IsBlank(uint32_t Copy_Address,uint32_t Copy_Length)
+ * \Description     : Check that a word aligned flash range reads as erased (all 0xFF)
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Address: Word aligned flash address
+ *                    Copy_Length:  Range length in bytes, a multiple of 16
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false
+ *************************************************************************************************/
+bool FLS_IsBlank(uint32_t Copy_Address,uint32_t Copy_Length);
+
+#endif
+/**********************************************************************************************************************
+ *  END OF FILE: Fls.h
+ *********************************************************************************************************************/
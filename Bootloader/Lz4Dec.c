@@ -0,0 +1,237 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *       Author:  Mahmoud Badr
+ *         File:  Lz4Dec.c
+ *        Layer:  App
+ *       Module:  Lz4Dec
+ *      Version:  1.00
+ *
+ *  Description:  Streaming decoder of LZ4 block sequences, see Lz4Dec.h for the format.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include "Lz4Dec.h"
+
+/**********************************************************************************************************************
+ *  LOCAL MACROS CONSTANT\FUNCTION
+ *********************************************************************************************************************/
+#define LZ4DEC_TOKEN            0x00
+#define LZ4DEC_LITERAL_LEN      0x01
+#define LZ4DEC_LITERALS         0x02
+#define LZ4DEC_OFFSET_LOW       0x03
+#define LZ4DEC_OFFSET_HIGH      0x04
+#define LZ4DEC_MATCH_LEN        0x05
+#define LZ4DEC_MATCH            0x06
+#define LZ4DEC_FAILED           0x07
+
+#define LZ4DEC_WINDOW_MASK      (LZ4DEC_WINDOW_SIZE-1U)
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/******************************************************************************
+ * \Syntax          : void LZ4DEC_Init(LZ4DEC_t* Copy_Decoder)
+ * \Description     : Start decoding a new stream
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Decoder: Decoder to be reset
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void LZ4DEC_Init(LZ4DEC_t* Copy_Decoder)
+{
+    Copy_Decoder->State=LZ4DEC_TOKEN;
+    Copy_Decoder->Count=0U;
+    Copy_Decoder->MatchLen=0U;
+    Copy_Decoder->Offset=0U;
+    Copy_Decoder->Total=0U;
+}
+
+/*************************************************************************************************
+ * \Syntax          : LZ4DEC_Status_t LZ4DEC_Decode(LZ4DEC_t* Copy_Decoder,const uint8_t* Copy_Input,uint32_t Copy_InputLen,
+ *                                                 uint32_t* Copy_Consumed,uint8_t* Copy_Output,uint32_t Copy_OutputSize,
+ *                                                 uint32_t* Copy_Produced)
+ * \Description     : Decode until the input is used up or the output is full
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Decoder:    Decoder state
+ *                    Copy_Input:      Next chunk of the compressed stream
+ *                    Copy_InputLen:   Chunk length
+ *                    Copy_Output:     Where the decoded bytes go
+ *                    Copy_OutputSize: Space in Copy_Output
+ * \Parameters (out): Copy_Consumed:   Input bytes used
+ *                    Copy_Produced:   Output bytes written
+ * \Return value:   : LZ4DEC_Status_t
+ *                    LZ4DEC_NEED_INPUT - LZ4DEC_OUTPUT_FULL - LZ4DEC_ERROR (offset outside the history)
+ *************************************************************************************************/
+LZ4DEC_Status_t LZ4DEC_Decode(LZ4DEC_t* Copy_Decoder,const uint8_t* Copy_Input,uint32_t Copy_InputLen,
+                              uint32_t* Copy_Consumed,uint8_t* Copy_Output,uint32_t Copy_OutputSize,
+                              uint32_t* Copy_Produced)
+{
+    LZ4DEC_Status_t Local_Status=LZ4DEC_NEED_INPUT;
+    uint32_t Local_In=0U;
+    uint32_t Local_Out=0U;
+    uint32_t Local_Run=0U;
+    uint32_t Local_Total=Copy_Decoder->Total;
+    uint8_t Local_Data=0U;
+    while(Copy_Decoder->State!=LZ4DEC_FAILED)
+    {
+        if(Copy_Decoder->State==LZ4DEC_MATCH)
+        {
+            if(Local_Out==Copy_OutputSize)
+            {
+                Local_Status=LZ4DEC_OUTPUT_FULL;
+                break;
+            }
+            /*Byte by byte, the match may overlap the bytes it produces*/
+            Local_Run=Copy_OutputSize-Local_Out;
+            if(Local_Run>Copy_Decoder->Count)
+            {
+                Local_Run=Copy_Decoder->Count;
+            }
+            Copy_Decoder->Count-=Local_Run;
+            for( ;Local_Run>0U;Local_Run--)
+            {
+                Local_Data=Copy_Decoder->Window[(Local_Total-Copy_Decoder->Offset) & LZ4DEC_WINDOW_MASK];
+                Copy_Decoder->Window[Local_Total & LZ4DEC_WINDOW_MASK]=Local_Data;
+                Copy_Output[Local_Out]=Local_Data;
+                Local_Out++;
+                Local_Total++;
+            }
+            if(Copy_Decoder->Count==0U)
+            {
+                Copy_Decoder->State=LZ4DEC_TOKEN;
+            }
+            continue;
+        }
+        if((Copy_Decoder->State==LZ4DEC_LITERALS) && (Local_Out==Copy_OutputSize))
+        {
+            Local_Status=LZ4DEC_OUTPUT_FULL;
+            break;
+        }
+        if(Local_In==Copy_InputLen)
+        {
+            break;
+        }
+        switch(Copy_Decoder->State)
+        {
+        case LZ4DEC_TOKEN:
+            Local_Data=Copy_Input[Local_In++];
+            Copy_Decoder->Count=Local_Data>>4;
+            Copy_Decoder->MatchLen=(Local_Data & 0x0FU)+LZ4DEC_MIN_MATCH;
+            if(Copy_Decoder->Count==15U)
+            {
+                Copy_Decoder->State=LZ4DEC_LITERAL_LEN;
+            }
+            else if(Copy_Decoder->Count!=0U)
+            {
+                Copy_Decoder->State=LZ4DEC_LITERALS;
+            }
+            else
+            {
+                Copy_Decoder->State=LZ4DEC_OFFSET_LOW;
+            }
+            break;
+        case LZ4DEC_LITERAL_LEN:
+            Local_Data=Copy_Input[Local_In++];
+            Copy_Decoder->Count+=Local_Data;
+            if(Local_Data!=255U)
+            {
+                Copy_Decoder->State=LZ4DEC_LITERALS;
+            }
+            break;
+        case LZ4DEC_LITERALS:
+            Local_Run=Copy_InputLen-Local_In;
+            if(Local_Run>(Copy_OutputSize-Local_Out))
+            {
+                Local_Run=Copy_OutputSize-Local_Out;
+            }
+            if(Local_Run>Copy_Decoder->Count)
+            {
+                Local_Run=Copy_Decoder->Count;
+            }
+            Copy_Decoder->Count-=Local_Run;
+            for( ;Local_Run>0U;Local_Run--)
+            {
+                Local_Data=Copy_Input[Local_In++];
+                Copy_Decoder->Window[Local_Total & LZ4DEC_WINDOW_MASK]=Local_Data;
+                Copy_Output[Local_Out]=Local_Data;
+                Local_Out++;
+                Local_Total++;
+            }
+            if(Copy_Decoder->Count==0U)
+            {
+                Copy_Decoder->State=LZ4DEC_OFFSET_LOW;
+            }
+            break;
+        case LZ4DEC_OFFSET_LOW:
+            Copy_Decoder->Offset=Copy_Input[Local_In++];
+            Copy_Decoder->State=LZ4DEC_OFFSET_HIGH;
+            break;
+        case LZ4DEC_OFFSET_HIGH:
+            Copy_Decoder->Offset|=(uint16_t)Copy_Input[Local_In++]<<8;
+            /*The match must start inside what was already decoded and is still in the window*/
+            if((Copy_Decoder->Offset==0U) || (Copy_Decoder->Offset>LZ4DEC_WINDOW_SIZE) || (Copy_Decoder->Offset>Local_Total))
+            {
+                Copy_Decoder->State=LZ4DEC_FAILED;
+            }
+            else if(Copy_Decoder->MatchLen==(15U+LZ4DEC_MIN_MATCH))
+            {
+                Copy_Decoder->State=LZ4DEC_MATCH_LEN;
+            }
+            else
+            {
+                Copy_Decoder->Count=Copy_Decoder->MatchLen;
+                Copy_Decoder->State=LZ4DEC_MATCH;
+            }
+            break;
+        case LZ4DEC_MATCH_LEN:
+            Local_Data=Copy_Input[Local_In++];
+            Copy_Decoder->MatchLen+=Local_Data;
+            if(Local_Data!=255U)
+            {
+                Copy_Decoder->Count=Copy_Decoder->MatchLen;
+                Copy_Decoder->State=LZ4DEC_MATCH;
+            }
+            break;
+        default:
+            Copy_Decoder->State=LZ4DEC_FAILED;
+            break;
+        }
+    }
+    if(Copy_Decoder->State==LZ4DEC_FAILED)
+    {
+        Local_Status=LZ4DEC_ERROR;
+    }
+    Copy_Decoder->Total=Local_Total;
+    *Copy_Consumed=Local_In;
+    *Copy_Produced=Local_Out;
+    return Local_Status;
+}
+
+/******************************************************************************
+ * \Syntax          : bool LZ4DEC_IsComplete(const LZ4DEC_t* Copy_Decoder)
+ * \Description     : Check that the stream didn't end in the middle of a sequence
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Decoder: Decoder state
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false
+ *******************************************************************************/
+bool LZ4DEC_IsComplete(const LZ4DEC_t* Copy_Decoder)
+{
+    /*The last sequence ends right after its literals*/
+    return ((Copy_Decoder->State==LZ4DEC_TOKEN) || (Copy_Decoder->State==LZ4DEC_OFFSET_LOW));
+}
+/**********************************************************************************************************************
+ *  END OF FILE: Lz4Dec.c
+ *********************************************************************************************************************/
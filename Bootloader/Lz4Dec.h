@@ -0,0 +1,108 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *       Author:  Mahmoud Badr
+ *         File:  Lz4Dec.h
+ *        Layer:  App
+ *       Module:  Lz4Dec
+ *      Version:  1.00
+ *
+ *  Description:  Streaming decoder of LZ4 block sequences used by BL_COMPRESSED_WRITE.
+ *                A sequence is [Token][Literal Length+..][Literals][Offset LE16][Match Length+..], the high
+ *                nibble of the token is the literal length, the low one the match length - 4, a nibble of 15
+ *                is continued by bytes up to the first one below 255. The last sequence has no match.
+ *                Input and output may be cut anywhere, the history needed by the matches is kept in a
+ *                LZ4DEC_WINDOW_SIZE ring so the RAM use doesn't depend on the image size.
+ *
+ *********************************************************************************************************************/
+
+#ifndef LZ4DEC_H_
+#define LZ4DEC_H_
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+/* History kept for the matches, must be a power of two, the host compressor must not use larger offsets */
+#define LZ4DEC_WINDOW_SIZE      2048U
+#define LZ4DEC_MIN_MATCH        4U
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+typedef enum
+{
+    LZ4DEC_NEED_INPUT=0,
+    LZ4DEC_OUTPUT_FULL,
+    LZ4DEC_ERROR
+}LZ4DEC_Status_t;
+
+typedef struct
+{
+    uint8_t State;
+    uint32_t Count;
+    uint32_t MatchLen;
+    uint16_t Offset;
+    uint32_t Total;
+    uint8_t Window[LZ4DEC_WINDOW_SIZE];
+}LZ4DEC_t;
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+
+/******************************************************************************
+ * \Syntax          : void LZ4DEC_Init(LZ4DEC_t* Copy_Decoder)
+ * \Description     : Start decoding a new stream
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Decoder: Decoder to be reset
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void LZ4DEC_Init(LZ4DEC_t* Copy_Decoder);
+
+/*************************************************************************************************
+ * \Syntax          : LZ4DEC_Status_t LZ4DEC_Decode(LZ4DEC_t* Copy_Decoder,const uint8_t* Copy_Input,uint32_t Copy_InputLen,
+ *                                                 uint32_t* Copy_Consumed,uint8_t* Copy_Output,uint32_t Copy_OutputSize,
+ *                                                 uint32_t* Copy_Produced)
+ * \Description     : Decode until the input is used up or the output is full
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Decoder:    Decoder state
+ *                    Copy_Input:      Next chunk of the compressed stream
+ *                    Copy_InputLen:   Chunk length
+ *                    Copy_Output:     Where the decoded bytes go
+ *                    Copy_OutputSize: Space in Copy_Output
+ * \Parameters (out): Copy_Consumed:   Input bytes used
+ *                    Copy_Produced:   Output bytes written
+ * \Return value:   : LZ4DEC_Status_t
+ *                    LZ4DEC_NEED_INPUT - LZ4DEC_OUTPUT_FULL - LZ4DEC_ERROR (offset outside the history)
+ *************************************************************************************************/
+LZ4DEC_Status_t LZ4DEC_Decode(LZ4DEC_t* Copy_Decoder,const uint8_t* Copy_Input,uint32_t Copy_InputLen,
+                              uint32_t* Copy_Consumed,uint8_t* Copy_Output,uint32_t Copy_OutputSize,
+                              uint32_t* Copy_Produced);
+
+/******************************************************************************
+ * \Syntax          : bool LZ4DEC_IsComplete(const LZ4DEC_t* Copy_Decoder)
+ * \Description     : Check that the stream didn't end in the middle of a sequence
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Decoder: Decoder state
+ * \Parameters (out): None
+ * \Return value:   : bool
+ *                    true - false
+ *******************************************************************************/
+bool LZ4DEC_IsComplete(const LZ4DEC_t* Copy_Decoder);
+
+#endif
+/**********************************************************************************************************************
+ *  END OF FILE: Lz4Dec.h
+ *********************************************************************************************************************/
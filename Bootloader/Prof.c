@@ -0,0 +1,156 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *       Author:  Mahmoud Badr
+ *         File:  Prof.c
+ *        Layer:  App
+ *       Module:  Prof
+ *      Version:  1.00
+ *
+ *  Description:  Cycle counts of the measured sections, see Prof.h.
+ *                CYCCNT wraps every 2^32 cycles, the unsigned difference stays right for sections shorter than that.
+ *
+ *********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <stddef.h>
+#include "Prof.h"
+#include "inc/hw_types.h"
+
+#if PROF_STATUS==PROF_ON
+/**********************************************************************************************************************
+ *  LOCAL DATA
+ *********************************************************************************************************************/
+static PROF_Entry_t PROF_Table[PROF_ENTRIES_NUM];
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTIONS
+ *********************************************************************************************************************/
+
+/******************************************************************************
+ * \Syntax          : void PROF_Init(void)
+ * \Description     : Start the DWT cycle counter and clear the table
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void PROF_Init(void)
+{
+    /*The DWT is powered by the trace enable of the core debug block*/
+    HWREG(PROF_DEMCR)|=PROF_DEMCR_TRCENA;
+    HWREG(PROF_DWT_CTRL)|=PROF_DWT_CTRL_CYCCNTENA;
+    PROF_Reset();
+}
+
+/******************************************************************************
+ * \Syntax          : void PROF_Start(uint8_t Copy_Id)
+ * \Description     : Mark the start of a measured section
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Id: Table entry of the section
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void PROF_Start(uint8_t Copy_Id)
+{
+    if(Copy_Id<PROF_ENTRIES_NUM)
+    {
+        PROF_Table[Copy_Id].Start=HWREG(PROF_DWT_CYCCNT);
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : void PROF_Stop(uint8_t Copy_Id)
+ * \Description     : Add the cycles since PROF_Start to the entry of a section
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Id: Table entry of the section
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void PROF_Stop(uint8_t Copy_Id)
+{
+    uint32_t Local_Cycles=HWREG(PROF_DWT_CYCCNT);
+    PROF_Entry_t* Local_Entry=NULL;
+    if(Copy_Id<PROF_ENTRIES_NUM)
+    {
+        Local_Entry=&PROF_Table[Copy_Id];
+        Local_Cycles-=Local_Entry->Start;
+        if((Local_Entry->Count==0U) || (Local_Cycles<Local_Entry->Min))
+        {
+            Local_Entry->Min=Local_Cycles;
+        }
+        if(Local_Cycles>Local_Entry->Max)
+        {
+            Local_Entry->Max=Local_Cycles;
+        }
+        Local_Entry->Total+=Local_Cycles;
+        Local_Entry->Count++;
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+}
+
+/******************************************************************************
+ * \Syntax          : const PROF_Entry_t* PROF_GetEntry(uint8_t Copy_Id)
+ * \Description     : Get an entry of the table
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Id: Table entry
+ * \Parameters (out): None
+ * \Return value:   : const PROF_Entry_t*
+ *                    The entry, NULL out of the table
+ *******************************************************************************/
+const PROF_Entry_t* PROF_GetEntry(uint8_t Copy_Id)
+{
+    const PROF_Entry_t* Local_Entry=NULL;
+    if(Copy_Id<PROF_ENTRIES_NUM)
+    {
+        Local_Entry=&PROF_Table[Copy_Id];
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    return Local_Entry;
+}
+
+/******************************************************************************
+ * \Syntax          : void PROF_Reset(void)
+ * \Description     : Clear the counters of every entry
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void PROF_Reset(void)
+{
+    uint8_t Local_Counter=0U;
+    for(Local_Counter=0U;Local_Counter<PROF_ENTRIES_NUM;Local_Counter++)
+    {
+        PROF_Table[Local_Counter].Count=0U;
+        PROF_Table[Local_Counter].Min=0U;
+        PROF_Table[Local_Counter].Max=0U;
+        PROF_Table[Local_Counter].Total=0U;
+    }
+}
+#endif
+/**********************************************************************************************************************
+ *  END OF FILE: Prof.c
+ *********************************************************************************************************************/
@@ -0,0 +1,146 @@
+/**********************************************************************************************************************
+ *  FILE DESCRIPTION
+ *  -------------------------------------------------------------------------------------------------------------------
+ *       Author:  Mahmoud Badr
+ *         File:  Prof.h
+ *        Layer:  App
+ *       Module:  Prof
+ *      Version:  1.00
+ *
+ *  Description:  Cycle profiling of the bootloader hot paths on the DWT cycle counter (CYCCNT) of the Cortex-M4.
+ *                Every measured phase and every host command owns an entry of a fixed RAM table holding
+ *                count / min / max / total cycles. PROF_START / PROF_STOP expand to nothing when PROF_STATUS
+ *                is PROF_OFF, the table and the code are then left out of the build.
+ *
+ *********************************************************************************************************************/
+
+#ifndef PROF_H_
+#define PROF_H_
+/**********************************************************************************************************************
+ *  INCLUDES
+ *********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/**********************************************************************************************************************
+ *  GLOBAL CONSTANT MACROS
+ *********************************************************************************************************************/
+#define PROF_OFF                0x00
+#define PROF_ON                 0x01
+
+/* Set the Profiling State
+ * PROF_OFF : production build, no table, no code
+ * PROF_ON  : about 0.7 KB of RAM and a few cycles per measured section */
+#ifndef PROF_STATUS
+#define PROF_STATUS             PROF_OFF
+#endif
+
+/* Measured phases, the host commands follow them (PROF_ID_COMMAND + command - BL_GET_VER) */
+#define PROF_ID_RECEIVE         0U      /* Frame body reception, from the length header to the CRC */
+#define PROF_ID_FRAME_CRC       1U      /* CRC32 check of a frame */
+#define PROF_ID_FLASH_ERASE     2U      /* BL_PerformFlashErase */
+#define PROF_ID_FLASH_WRITE     3U      /* BL_PerformFlashWrite */
+#define PROF_ID_FLASH_BURST     4U      /* Program of one 32-word write buffer block */
+#define PROF_ID_COMMAND         5U
+#define PROF_COMMAND_NUM        32U
+#define PROF_ENTRIES_NUM        (PROF_ID_COMMAND+PROF_COMMAND_NUM)
+
+/* Core debug and DWT registers (ARMv7-M), not in the TivaWare headers */
+#define PROF_DEMCR              0xE000EDFCUL
+#define PROF_DEMCR_TRCENA       0x01000000UL
+#define PROF_DWT_CTRL           0xE0001000UL
+#define PROF_DWT_CTRL_CYCCNTENA 0x00000001UL
+#define PROF_DWT_CYCCNT         0xE0001004UL
+
+#if PROF_STATUS==PROF_ON
+#define PROF_INIT()             PROF_Init()
+#define PROF_START(Id)          PROF_Start(Id)
+#define PROF_STOP(Id)           PROF_Stop(Id)
+#else
+#define PROF_INIT()
+#define PROF_START(Id)
+#define PROF_STOP(Id)
+#endif
+
+/**********************************************************************************************************************
+ *  GLOBAL DATA TYPES AND STRUCTURES
+ *********************************************************************************************************************/
+typedef struct
+{
+    uint32_t Count;
+    uint32_t Min;
+    uint32_t Max;
+    uint64_t Total;
+    uint32_t Start;             /* CYCCNT at PROF_Start, the sections of one entry don't nest */
+}PROF_Entry_t;
+
+/**********************************************************************************************************************
+ *  GLOBAL FUNCTION PROTOTYPES
+ *********************************************************************************************************************/
+#if PROF_STATUS==PROF_ON
+/******************************************************************************
+ * \Syntax          : void PROF_Init(void)
+ * \Description     : Start the DWT cycle counter and clear the table
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void PROF_Init(void);
+
+/******************************************************************************
+ * \Syntax          : void PROF_Start(uint8_t Copy_Id)
+ * \Description     : Mark the start of a measured section
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Id: Table entry of the section
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void PROF_Start(uint8_t Copy_Id);
+
+/******************************************************************************
+ * \Syntax          : void PROF_Stop(uint8_t Copy_Id)
+ * \Description     : Add the cycles since PROF_Start to the entry of a section
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : Copy_Id: Table entry of the section
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void PROF_Stop(uint8_t Copy_Id);
+
+/******************************************************************************
+ * \Syntax          : const PROF_Entry_t* PROF_GetEntry(uint8_t Copy_Id)
+ * \Description     : Get an entry of the table
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Reentrant
+ * \Parameters (in) : Copy_Id: Table entry
+ * \Parameters (out): None
+ * \Return value:   : const PROF_Entry_t*
+ *                    The entry, NULL out of the table
+ *******************************************************************************/
+const PROF_Entry_t* PROF_GetEntry(uint8_t Copy_Id);
+
+/******************************************************************************
+ * \Syntax          : void PROF_Reset(void)
+ * \Description     : Clear the counters of every entry
+ *
+ * \Sync\Async      : Synchronous
+ * \Reentrancy      : Non Reentrant
+ * \Parameters (in) : None
+ * \Parameters (out): None
+ * \Return value:   : void
+ *******************************************************************************/
+void PROF_Reset(void);
+#endif
+
+#endif
+/**********************************************************************************************************************
+ *  END OF FILE: Prof.h
+ *********************************************************************************************************************/
@@ -0,0 +1,263 @@
+/*
+ * Can.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ */
+#include "Can.h"
+
+static uint8_t CAN_RxStorage[CAN_RX_BUFFER_SIZE];
+static uint8_t CAN_FrameStorage[CAN_FRAME_BUFFER_SIZE];
+static uint8_t CAN_BcastStorage[CAN_BCAST_BUFFER_SIZE];
+/*Reassembled host bytes, written by the IsoTp link*/
+static RingBuffer_t CAN_RxRing;
+/*Raw frames as [Length][8 data bytes], written by the CAN0 ISR*/
+static RingBuffer_t CAN_FrameRing;
+/*Fan out frames as [Sequence low][Sequence high][8 data bytes], written by the CAN0 ISR*/
+static RingBuffer_t CAN_BcastRing;
+static ISOTP_Link_t CAN_Link;
+static volatile bool CAN_TxBusy=false;
+static volatile uint32_t CAN_Ticks=0U;
+static uint32_t CAN_TicksSeen=0U;
+static uint32_t CAN_LastTxTick=0U;
+
+/*State of the pending CAN_StartReceive request*/
+static uint8_t* CAN_RxDest=0;
+static uint16_t CAN_RxRemaining=0;
+
+/*IsoTp transmit callback, the single transmit mailbox is free again on its TX interrupt*/
+static bool CAN_TransmitFrame(void* Copy_Context,const uint8_t* Copy_Frame)
+{
+    bool Local_State=false;
+    tCANMsgObject Local_Message;
+    if(CAN_TxBusy==false)
+    {
+        CAN_TxBusy=true;
+        Local_Message.ui32MsgID=CAN_TX_ID;
+        Local_Message.ui32MsgIDMask=0U;
+        Local_Message.ui32Flags=MSG_OBJ_TX_INT_ENABLE;
+        Local_Message.ui32MsgLen=ISOTP_FRAME_LEN;
+        Local_Message.pui8MsgData=(uint8_t*)Copy_Frame;
+        /*The data is copied to the mailbox registers before returning*/
+        CANMessageSet(CAN0_BASE, CAN_TX_OBJECT, &Local_Message, MSG_OBJ_TYPE_TX);
+        CAN_LastTxTick=CAN_Ticks;
+        Local_State=true;
+    }
+    return Local_State;
+}
+
+/*Run the IsoTp link: queued frames first, then the elapsed ticks, then whatever frame is due*/
+static ISOTP_TxState_t CAN_Service(void)
+{
+    uint8_t Local_Frame[CAN_QUEUED_FRAME_LEN];
+    while(RingBuffer_Count(&CAN_FrameRing)>=CAN_QUEUED_FRAME_LEN)
+    {
+        RingBuffer_Read(&CAN_FrameRing, Local_Frame, CAN_QUEUED_FRAME_LEN);
+        ISOTP_OnFrame(&CAN_Link, &Local_Frame[1], Local_Frame[0]);
+    }
+    while(CAN_TicksSeen!=CAN_Ticks)
+    {
+        CAN_TicksSeen++;
+        ISOTP_OnTick(&CAN_Link);
+    }
+    return ISOTP_Poll(&CAN_Link);
+}
+
+void CAN_Init(CAN_t Copy_CanNum)
+{
+    tCANMsgObject Local_Message;
+    uint8_t Local_Object=0U;
+    RingBuffer_Init(&CAN_RxRing, CAN_RxStorage, CAN_RX_BUFFER_SIZE);
+    RingBuffer_Init(&CAN_FrameRing, CAN_FrameStorage, CAN_FRAME_BUFFER_SIZE);
+    RingBuffer_Init(&CAN_BcastRing, CAN_BcastStorage, CAN_BCAST_BUFFER_SIZE);
+    ISOTP_Init(&CAN_Link, CAN_TransmitFrame, 0, &CAN_RxRing, CAN_BLOCK_SIZE, CAN_STMIN);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_CAN0);
+    /*PB4/PB5, PE4/PE5 are left to UART5*/
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOB);
+    GPIOPinConfigure(GPIO_PB4_CAN0RX);
+    GPIOPinConfigure(GPIO_PB5_CAN0TX);
+    GPIOPinTypeCAN(GPIO_PORTB_BASE, GPIO_PIN_4 | GPIO_PIN_5);
+    CANInit(CAN0_BASE);
+    CANBitRateSet(CAN0_BASE, SysCtlClockGet(), CAN_BITRATE);
+    /*Every receive mailbox but the last one chains to the next*/
+    Local_Message.ui32MsgID=CAN_RX_ID;
+    Local_Message.ui32MsgIDMask=0x7FFU;
+    Local_Message.ui32MsgLen=ISOTP_FRAME_LEN;
+    Local_Message.pui8MsgData=0;
+    for(Local_Object=1U;Local_Object<=CAN_RX_FIFO_DEPTH;Local_Object++)
+    {
+        Local_Message.ui32Flags=MSG_OBJ_RX_INT_ENABLE | MSG_OBJ_USE_ID_FILTER | ((Local_Object<CAN_RX_FIFO_DEPTH) ? MSG_OBJ_FIFO : 0U);
+        CANMessageSet(CAN0_BASE, Local_Object, &Local_Message, MSG_OBJ_TYPE_RX);
+    }
+    /*Fan out FIFO, any frame number of the broadcast identifier*/
+    Local_Message.ui32MsgID=CAN_BCAST_ID;
+    Local_Message.ui32MsgIDMask=CAN_BCAST_MASK;
+    for(Local_Object=CAN_BCAST_FIRST_OBJECT;Local_Object<=CAN_BCAST_LAST_OBJECT;Local_Object++)
+    {
+        Local_Message.ui32Flags=MSG_OBJ_RX_INT_ENABLE | MSG_OBJ_USE_ID_FILTER | MSG_OBJ_EXTENDED_ID | MSG_OBJ_USE_EXT_FILTER |
+                                ((Local_Object<CAN_BCAST_LAST_OBJECT) ? MSG_OBJ_FIFO : 0U);
+        CANMessageSet(CAN0_BASE, Local_Object, &Local_Message, MSG_OBJ_TYPE_RX);
+    }
+    CANIntEnable(CAN0_BASE, CAN_INT_MASTER | CAN_INT_ERROR | CAN_INT_STATUS);
+    IntEnable(INT_CAN0);
+    /*1 ms tick of the IsoTp timers*/
+    SysTickPeriodSet(SysCtlClockGet()/1000U);
+    SysTickIntEnable();
+    SysTickEnable();
+    IntMasterEnable();
+    CANEnable(CAN0_BASE);
+}
+
+void CAN_SendBytes(CAN_t Copy_CanNum,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    uint16_t Local_Sent=0U;
+    uint16_t Local_Chunk=0U;
+    ISOTP_TxState_t Local_State=ISOTP_TX_IDLE;
+    while(Local_Sent<Copy_DataLength)
+    {
+        Local_Chunk=(uint16_t)(Copy_DataLength-Local_Sent);
+        if(Local_Chunk>ISOTP_MAX_MESSAGE)
+        {
+            Local_Chunk=ISOTP_MAX_MESSAGE;
+        }
+        ISOTP_Send(&CAN_Link, &Copy_Data[Local_Sent], Local_Chunk);
+        CAN_LastTxTick=CAN_Ticks;
+        do
+        {
+            Local_State=CAN_Service();
+            /*Nobody acknowledges the frames (host unplugged), the flow control timeout covers the rest*/
+            if((Local_State!=ISOTP_TX_WAIT_FC) && ((CAN_Ticks-CAN_LastTxTick)>ISOTP_TIMEOUT_TICKS))
+            {
+                ISOTP_AbortSend(&CAN_Link);
+            }
+        }while((Local_State!=ISOTP_TX_DONE) && (Local_State!=ISOTP_TX_ERROR));
+        Local_Sent+=Local_Chunk;
+    }
+}
+
+uint16_t CAN_ReadBytes(CAN_t Copy_CanNum,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    CAN_Service();
+    return RingBuffer_Read(&CAN_RxRing, Copy_Data, Copy_DataLength);
+}
+
+void CAN_StartReceive(CAN_t Copy_CanNum,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    CAN_RxDest=Copy_Data;
+    CAN_RxRemaining=Copy_DataLength;
+}
+
+bool CAN_IsReceiveComplete(CAN_t Copy_CanNum)
+{
+    uint16_t Local_Received=0;
+    if(CAN_RxRemaining!=0U)
+    {
+        Local_Received=CAN_ReadBytes(Copy_CanNum, CAN_RxDest, CAN_RxRemaining);
+        CAN_RxDest+=Local_Received;
+        CAN_RxRemaining-=Local_Received;
+    }
+    return (CAN_RxRemaining==0U);
+}
+
+bool CAN_IsHostActive(CAN_t Copy_CanNum)
+{
+    /*Only frames of our own receive identifier count, a fan out alone doesn't make us the host link*/
+    return (RingBuffer_Count(&CAN_FrameRing)!=0U);
+}
+
+bool CAN_ReadBroadcast(CAN_t Copy_CanNum,uint16_t* Copy_Sequence,uint8_t* Copy_Data)
+{
+    bool Local_State=false;
+    uint8_t Local_Frame[CAN_BCAST_FRAME_LEN];
+    uint8_t Local_Counter=0U;
+    if(RingBuffer_Count(&CAN_BcastRing)>=CAN_BCAST_FRAME_LEN)
+    {
+        RingBuffer_Read(&CAN_BcastRing, Local_Frame, CAN_BCAST_FRAME_LEN);
+        *Copy_Sequence=(uint16_t)Local_Frame[0] | ((uint16_t)Local_Frame[1]<<8);
+        for(Local_Counter=0U;Local_Counter<ISOTP_FRAME_LEN;Local_Counter++)
+        {
+            Copy_Data[Local_Counter]=Local_Frame[2U+Local_Counter];
+        }
+        Local_State=true;
+    }
+    return Local_State;
+}
+
+void CAN_Close(CAN_t Copy_CanNum)
+{
+    uint32_t Local_Start=CAN_Ticks;
+    /*The last frame leaves the mailbox once a node acknowledges it, nobody may be left on the bus*/
+    while((CAN_TxBusy==true) && ((CAN_Ticks-Local_Start)<=ISOTP_TIMEOUT_TICKS))
+    {
+        /*Freed by the TX interrupt*/
+    }
+    CANDisable(CAN0_BASE);
+    IntDisable(INT_CAN0);
+    CAN_TxBusy=false;
+    SysCtlPeripheralReset(SYSCTL_PERIPH_CAN0);
+    SysCtlPeripheralDisable(SYSCTL_PERIPH_CAN0);
+    SysCtlPeripheralReset(SYSCTL_PERIPH_GPIOB);
+    SysCtlPeripheralDisable(SYSCTL_PERIPH_GPIOB);
+}
+
+void CAN0_IntHandler(void)
+{
+    uint8_t Local_Frame[CAN_QUEUED_FRAME_LEN];
+    uint8_t Local_Bcast[CAN_BCAST_FRAME_LEN];
+    uint8_t Local_Index=0U;
+    tCANMsgObject Local_Message;
+    uint32_t Local_Cause=CANIntStatus(CAN0_BASE, CAN_INT_STS_CAUSE);
+    while(Local_Cause!=0U)
+    {
+        if(Local_Cause==CAN_INT_INTID_STATUS)
+        {
+            /*Reading the status clears it, a bus off controller is restarted*/
+            if((CANStatusGet(CAN0_BASE, CAN_STS_CONTROL) & CAN_STATUS_BUS_OFF)!=0U)
+            {
+                CAN_TxBusy=false;
+                CANEnable(CAN0_BASE);
+            }
+        }
+        else if(Local_Cause<=CAN_RX_FIFO_DEPTH)
+        {
+            Local_Message.pui8MsgData=&Local_Frame[1];
+            CANMessageGet(CAN0_BASE, Local_Cause, &Local_Message, true);
+            Local_Frame[0]=(uint8_t)Local_Message.ui32MsgLen;
+            /*Frames are dropped if the main loop let the ring overflow, IsoTp sees the sequence gap*/
+            if(RingBuffer_Free(&CAN_FrameRing)>=CAN_QUEUED_FRAME_LEN)
+            {
+                RingBuffer_Write(&CAN_FrameRing, Local_Frame, CAN_QUEUED_FRAME_LEN);
+            }
+        }
+        else if((Local_Cause>=CAN_BCAST_FIRST_OBJECT) && (Local_Cause<=CAN_BCAST_LAST_OBJECT))
+        {
+            Local_Message.pui8MsgData=&Local_Bcast[2];
+            CANMessageGet(CAN0_BASE, Local_Cause, &Local_Message, true);
+            Local_Bcast[0]=(uint8_t)Local_Message.ui32MsgID;
+            Local_Bcast[1]=(uint8_t)(Local_Message.ui32MsgID>>8);
+            /*Short frames are padded with the erased flash value*/
+            for(Local_Index=(uint8_t)Local_Message.ui32MsgLen;Local_Index<ISOTP_FRAME_LEN;Local_Index++)
+            {
+                Local_Bcast[2U+Local_Index]=0xFFU;
+            }
+            if(RingBuffer_Free(&CAN_BcastRing)>=CAN_BCAST_FRAME_LEN)
+            {
+                RingBuffer_Write(&CAN_BcastRing, Local_Bcast, CAN_BCAST_FRAME_LEN);
+            }
+        }
+        else
+        {
+            CANIntClear(CAN0_BASE, Local_Cause);
+            if(Local_Cause==CAN_TX_OBJECT)
+            {
+                CAN_TxBusy=false;
+            }
+        }
+        Local_Cause=CANIntStatus(CAN0_BASE, CAN_INT_STS_CAUSE);
+    }
+}
+
+void CAN_SysTickHandler(void)
+{
+    CAN_Ticks++;
+}
@@ -0,0 +1,100 @@
+/*
+ * Can.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Host link over CAN0: the host byte stream is carried in IsoTp messages.
+ *  The receive mailboxes form a hardware FIFO drained by the CAN0 interrupt into a frame
+ *  ring, the IsoTp link itself only runs from the CAN_ calls of the main loop, and SysTick
+ *  gives it the 1 ms tick of its STmin and timeout timers.
+ *  Every node of a rack has its own pair of identifiers, a fan out download reaches all of them
+ *  at once with plain broadcast frames (no IsoTp, no flow control) numbered in their identifier.
+ */
+
+#ifndef CAN_H_
+#define CAN_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/gpio.h"
+#include "driverlib/pin_map.h"
+#include "driverlib/can.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/systick.h"
+#include "RingBuffer.h"
+#include "IsoTp.h"
+
+#define CAN_BITRATE             500000U
+
+/* Node number of this board on the bus, set per board from the build flags */
+#ifndef CAN_NODE_ID
+#define CAN_NODE_ID             0U
+#endif
+
+/* Host to bootloader and bootloader to host identifiers (11-bit) */
+#define CAN_RX_ID               (0x600U+CAN_NODE_ID)
+#define CAN_TX_ID               (0x680U+CAN_NODE_ID)
+
+/* Fan out frames (29-bit), the low 16 bits of the identifier are the frame number */
+#define CAN_BCAST_ID            0x1BF00000UL
+#define CAN_BCAST_MASK          0x1FFF0000UL
+
+/* Receive mailboxes chained as a hardware FIFO, they hold the frames arriving while
+ * the CPU is stalled by a flash erase, the flow control block size must not exceed it */
+#define CAN_RX_FIFO_DEPTH       8U
+#define CAN_TX_OBJECT           (CAN_RX_FIFO_DEPTH+1U)
+/* Second FIFO for the fan out frames, nobody paces them to our flash stalls so a frame
+ * lost to an overrun is asked for again by the host */
+#define CAN_BCAST_FIFO_DEPTH    8U
+#define CAN_BCAST_FIRST_OBJECT  (CAN_TX_OBJECT+1U)
+#define CAN_BCAST_LAST_OBJECT   (CAN_TX_OBJECT+CAN_BCAST_FIFO_DEPTH)
+
+/* Flow control sent to the host: block size and STmin (ms) */
+#define CAN_BLOCK_SIZE          CAN_RX_FIFO_DEPTH
+#define CAN_STMIN               0U
+
+/* Rings, must be powers of two, a queued frame takes CAN_QUEUED_FRAME_LEN bytes */
+#define CAN_RX_BUFFER_SIZE      2048U
+#define CAN_FRAME_BUFFER_SIZE   512U
+#define CAN_QUEUED_FRAME_LEN    (1U+ISOTP_FRAME_LEN)
+#define CAN_BCAST_BUFFER_SIZE   1024U
+#define CAN_BCAST_FRAME_LEN     (2U+ISOTP_FRAME_LEN)
+
+typedef enum
+{
+    CAN_0=0,
+    CAN_1
+}CAN_t;
+
+void CAN_Init(CAN_t Copy_CanNum);
+
+/* Send Copy_Data as IsoTp messages, returns once the last frame is on the bus or the host stopped answering */
+void CAN_SendBytes(CAN_t Copy_CanNum,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+/* Non blocking, returns the number of reassembled bytes copied */
+uint16_t CAN_ReadBytes(CAN_t Copy_CanNum,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+/* Asynchronous receive of exactly Copy_DataLength bytes, poll CAN_IsReceiveComplete until it returns true */
+void CAN_StartReceive(CAN_t Copy_CanNum,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+bool CAN_IsReceiveComplete(CAN_t Copy_CanNum);
+
+/* True once a frame of the host arrived on our receive identifier */
+bool CAN_IsHostActive(CAN_t Copy_CanNum);
+
+/* Take the oldest fan out frame, its 8 data bytes and frame number, returns false if none is queued */
+bool CAN_ReadBroadcast(CAN_t Copy_CanNum,uint16_t* Copy_Sequence,uint8_t* Copy_Data);
+
+/* Wait for the last frame, then reset and gate CAN0 and its pin port, SysTick is left to the caller */
+void CAN_Close(CAN_t Copy_CanNum);
+
+void CAN0_IntHandler(void);
+
+void CAN_SysTickHandler(void);
+
+#endif /* CAN_H_ */
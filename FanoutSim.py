@@ -0,0 +1,158 @@
+''' Fan out download over a simulated CAN bus: every node is an emulated bootloader that loses
+    a share of the broadcast frames (FIFO overruns while its CPU is stalled by the flash),
+    the host side is Fanout_Write of Host.py unchanged.
+    The bus time is counted from the nominal frame lengths (no stuff bits) at BL_CAN_BITRATE.
+    Usage: python3 FanoutSim.py [image KB] [max nodes] [frame loss] '''
+import sys
+import io
+import struct
+import random
+import threading
+import queue
+import contextlib
+import Host
+
+CAN_STD_FRAME_OVERHEAD       = 47
+CAN_EXT_FRAME_OVERHEAD       = 67
+SIM_FLASH_SIZE               = 256 * 1024
+SIM_IMAGE_ADDRESS            = 0x8000
+
+class Virtual_Bus:
+    ''' Every frame sent reaches all the other endpoints whose filter takes it '''
+    def __init__(self):
+        self.Endpoints = []
+        self.Lock = threading.Lock()
+        self.Frames = 0
+        self.Bits = 0
+
+    def Open(self, Rx_Filter):
+        Endpoint = Virtual_Endpoint(self, Rx_Filter)
+        self.Endpoints.append(Endpoint)
+        return Endpoint
+
+    def Deliver(self, Sender, Id, Data, Extended):
+        with self.Lock:
+            self.Frames = self.Frames + 1
+            self.Bits = self.Bits + (CAN_EXT_FRAME_OVERHEAD if Extended else CAN_STD_FRAME_OVERHEAD) + 8 * len(Data)
+            for Endpoint in self.Endpoints:
+                if((Endpoint is not Sender) and Endpoint.Rx_Filter(Id, Extended)):
+                    Endpoint.Rx_Queue.put((Id, Data))
+
+class Virtual_Endpoint:
+    ''' Same Send / Receive as Host.Can_Bus '''
+    def __init__(self, Bus, Rx_Filter):
+        self.Bus = Bus
+        self.Rx_Filter = Rx_Filter
+        self.Rx_Queue = queue.Queue()
+
+    def Send(self, Id, Data, Extended = False):
+        self.Bus.Deliver(self, Id, bytes(Data), Extended)
+
+    def Receive(self, Timeout):
+        try:
+            return self.Rx_Queue.get(timeout = Timeout)
+        except queue.Empty:
+            return None
+
+class Emulated_Node(threading.Thread):
+    ''' The fan out part of the bootloader command set, enough for Fanout_Write '''
+    def __init__(self, Bus, Node, Loss):
+        threading.Thread.__init__(self, daemon = True)
+        Rx_Id = Host.BL_CAN_RX_BASE + Node
+        self.Port = Host.IsoTp_Port(Bus.Open(lambda Id, Extended: (not Extended) and (Id == Rx_Id)),
+                                    Host.BL_CAN_TX_BASE + Node, Rx_Id, 0.005)
+        self.Bcast = Bus.Open(lambda Id, Extended: Extended and ((Id & 0x1FFF0000) == Host.BL_CAN_BCAST_ID))
+        self.Random = random.Random(Node)
+        self.Loss = Loss
+        self.Flash = bytearray(b'\xff' * SIM_FLASH_SIZE)
+        self.Address = 0
+        self.Length = 0
+        self.Received = []
+        self.Stop = threading.Event()
+
+    def run(self):
+        while(not self.Stop.is_set()):
+            self.Drain_Broadcast()
+            Header = self.Port.read(1)
+            if(len(Header)):
+                self.Port.timeout = 1.0
+                self.Execute(Header + self.Port.read(Header[0]))
+                self.Port.timeout = 0.005
+
+    def Drain_Broadcast(self):
+        while True:
+            Frame = self.Bcast.Receive(0)
+            if(Frame is None):
+                return
+            Sequence = Frame[0] & 0xFFFF
+            if((self.Random.random() >= self.Loss) and (Sequence < len(self.Received)) and (not self.Received[Sequence])):
+                Offset = Sequence * Host.BL_FANOUT_FRAME_LEN
+                Data = Frame[1][0 : min(Host.BL_FANOUT_FRAME_LEN, self.Length - Offset)]
+                self.Flash[self.Address + Offset : self.Address + Offset + len(Data)] = Data
+                self.Received[Sequence] = True
+
+    def Reply(self, Data):
+        self.Port.write(bytes([0xCD, len(Data)]))
+        self.Port.write(bytes(Data))
+
+    def Execute(self, Packet):
+        Command = Packet[1]
+        if(Command == Host.BL_ERASE_AHEAD_CMD):
+            self.Reply([Host.SUCCESSFUL_ERASE])
+        elif(Command == Host.BL_FANOUT_START_CMD):
+            self.Address, self.Length = struct.unpack('<II', Packet[2 : 10])
+            self.Received = [False] * ((self.Length + Host.BL_FANOUT_FRAME_LEN - 1) // Host.BL_FANOUT_FRAME_LEN)
+            self.Reply([Host.BL_FANOUT_ACTIVE])
+        elif(Command == Host.BL_FANOUT_STATUS_CMD):
+            First_Frame = struct.unpack('<H', Packet[2 : 4])[0]
+            self.Drain_Broadcast()
+            Bitmap = bytearray(Host.BL_FANOUT_STATUS_WINDOW)
+            for Frame in range(First_Frame, min(len(self.Received), First_Frame + Host.BL_FANOUT_STATUS_WINDOW * 8)):
+                if(self.Received[Frame]):
+                    Bitmap[(Frame - First_Frame) >> 3] |= 1 << (Frame & 7)
+            self.Reply(bytes([Host.BL_FANOUT_ACTIVE]) + struct.pack('<H', sum(self.Received)) + Bitmap)
+        elif(Command == Host.BL_VERIFY_CRC_CMD):
+            Address, Length = struct.unpack('<II', Packet[2 : 10])
+            CRC32_Value = Host.Calculate_CRC32(self.Flash[Address : Address + Length], Length)
+            self.Reply(bytes([Host.BL_READ_OK]) + struct.pack('<I', CRC32_Value))
+        else:
+            self.Port.write(bytes([0xAB]))
+
+def Run_Fanout(Node_Count, Image, Loss):
+    ''' Returns (failed nodes, rounds, frames on the bus, bus time in seconds) '''
+    Bus = Virtual_Bus()
+    Nodes = [Emulated_Node(Bus, Node, Loss) for Node in range(Node_Count)]
+    Node_Ports = {}
+    for Node in range(Node_Count):
+        Tx_Id = Host.BL_CAN_TX_BASE + Node
+        Node_Ports[Node] = Host.IsoTp_Port(Bus.Open(lambda Id, Extended, Tx_Id = Tx_Id: (not Extended) and (Id == Tx_Id)),
+                                           Host.BL_CAN_RX_BASE + Node, Tx_Id, 2)
+    Bcast_Bus = Bus.Open(lambda Id, Extended: False)
+    for Node in Nodes:
+        Node.start()
+    with contextlib.redirect_stdout(io.StringIO()):
+        Failed, Rounds = Host.Fanout_Write(Node_Ports, Bcast_Bus, Image, SIM_IMAGE_ADDRESS)
+    for Node in Nodes:
+        Node.Stop.set()
+        Node.join()
+    return (Failed, Rounds, Bus.Frames, Bus.Bits / Host.BL_CAN_BITRATE)
+
+if(__name__ == "__main__"):
+    Image_Size = int(sys.argv[1]) * 1024 if (len(sys.argv) > 1) else 32 * 1024
+    Max_Nodes = int(sys.argv[2]) if (len(sys.argv) > 2) else 8
+    Loss = float(sys.argv[3]) if (len(sys.argv) > 3) else 0.01
+    Host.Serial_Port_Obj = None
+    Host.verbose_mode = 0
+    Image = bytes(random.Random(0).getrandbits(8) for Counter in range(Image_Size))
+    print("Image", Image_Size, "bytes, frame loss", Loss, "per node\n")
+    print("Nodes  Rounds  Frames  Bus time (s)  Aggregate (KB/s)  Speed up")
+    Node_Count = 1
+    Single_Time = None
+    while(Node_Count <= Max_Nodes):
+        Failed, Rounds, Frames, Bus_Time = Run_Fanout(Node_Count, Image, Loss)
+        if(Single_Time is None):
+            Single_Time = Bus_Time
+        print("%5d  %6d  %6d  %12.3f  %16.1f  %8.2f%s" % (Node_Count, Rounds, Frames, Bus_Time,
+              Node_Count * Image_Size / 1024 / Bus_Time, Node_Count * Single_Time / Bus_Time,
+              ("  failed " + str(Failed)) if Failed else ""))
+        Node_Count = Node_Count * 2
@@ -0,0 +1,193 @@
+''' Flashing throughput benchmark: erases and writes an image through the BL_FLASH_ERASE_CMD /
+    BL_MEM_WRITE_CMD flow of Host.py against the simulator of Sim/ (make -C Sim first), and splits
+    the time into phases. --mode pipelined writes with BL_PIPE_WRITE_CMD instead, the target programs
+    a packet while the next one is on the line, --mode both runs the two on the same image and
+    prints the speedup:
+      erase_s          erase command round trips, erase_flash_s of it is the flash erase time
+      host_build_s     framing and CRC32 of the write packets on the host
+      host_write_s     handing the packets to the serial port
+      wire_s           packets and replies on the line at the UART rate
+      target_s         rest of the write round trips: target_flash_s of flash programming,
+                       target_other_s of CRC check, command handling and reply turnaround
+      host_sleep_s     pause between two packets, Host.py waits 0.1 s after every write
+      baud_switch_s    BL_SET_BAUD negotiation when --baud isn't the default rate
+    The simulator runs the bootloader natively, so target_other_s is a host figure: compare it
+    between two builds, not with the board. --json prints one line per run for a regression log.
+    Usage: python3 FlashBench.py [--mode serial|pipelined|both] [--image-kb N] [--packet N] [--baud N] [--sleep S] [--json] '''
+import sys
+import os
+import re
+import json
+import random
+import signal
+import argparse
+import tempfile
+import subprocess
+from time import sleep, monotonic
+import serial
+import Host
+
+SIM_PATH                     = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'Sim', 'build', 'blsim')
+SIM_IMAGE_ADDRESS            = 0x8000
+''' Start, 8 data and stop bits '''
+UART_FRAME_BITS              = 10
+''' BL_MEM_WRITE_CMD packet around the payload: length, command, address, payload length and CRC32 '''
+MEM_WRITE_OVERHEAD           = 11
+MEM_WRITE_REPLY_LEN          = 3
+''' BL_PIPE_WRITE_CMD adds the sequence number, its reply holds the sequence and commit status of the previous packet '''
+PIPE_WRITE_OVERHEAD          = 12
+PIPE_WRITE_REPLY_LEN         = 4
+
+def Build_Frame(Packet):
+    ''' Same framing as Send_Packet_To_Serial_Port, Packet holds the length byte and the command onwards '''
+    if(len(Packet) + 4 - 1 > Host.BL_LEGACY_MAX_FRAME_LEN):
+        Frame = bytes([Host.BL_EXT_FRAME_MARKER]) + (len(Packet) + 4 - 1).to_bytes(2, 'little') + bytes(Packet[1:])
+    else:
+        Frame = bytes(Packet)
+    return Frame + (Host.Calculate_CRC32(Frame, len(Frame)) & 0xFFFFFFFF).to_bytes(4, 'little')
+
+def Read_Reply():
+    ''' Returns the status bytes after the ACK, None on Not-Acknowledgement '''
+    BL_ACK = bytearray(Host.Read_Serial_Port(1))
+    if(BL_ACK[0] != 0xCD):
+        return None
+    Length_To_Follow = bytearray(Host.Read_Serial_Port(1))[0]
+    return bytearray(Host.Read_Serial_Port(Length_To_Follow))
+
+def Start_Simulator(Flash_File, Erase_Us, Program_Us):
+    Simulator = subprocess.Popen([SIM_PATH, '-f', Flash_File, '-e', str(Erase_Us), '-p', str(Program_Us)],
+                                 stdout = subprocess.PIPE, text = True)
+    Banner = Simulator.stdout.readline()
+    Match = re.search(r'on (\S+)', Banner)
+    if(Match is None):
+        Simulator.kill()
+        raise EnvironmentError("Error !! The simulator didn't start: " + Banner)
+    return Simulator, Match.group(1)
+
+def Stop_Simulator(Simulator):
+    ''' Returns the key=value statistics the simulator prints on exit '''
+    Simulator.send_signal(signal.SIGINT)
+    Stats = {}
+    for Line in Simulator.stdout.read().splitlines():
+        for Key, Value in re.findall(r'(\w+)=([0-9.]+)', Line):
+            Stats[Key] = float(Value)
+    Simulator.wait()
+    return Stats
+
+def Build_Write_Packet(Mode, Sequence, Address, Payload):
+    if(Mode == 'pipelined'):
+        Packet = [len(Payload) + PIPE_WRITE_OVERHEAD - 1, Host.BL_PIPE_WRITE_CMD, Sequence & 0xFF]
+    else:
+        Packet = [len(Payload) + MEM_WRITE_OVERHEAD - 1, Host.BL_MEM_WRITE_CMD]
+    return Packet + list(Address.to_bytes(4, 'little')) + [len(Payload) & 0xFF] + list(Payload)
+
+def Run_Benchmark(Image, Packet_Len, Baud, Host_Sleep, Erase_Us, Program_Us, Mode = 'serial'):
+    Phases = dict.fromkeys(['erase_s', 'erase_flash_s', 'host_build_s', 'host_write_s', 'wire_s', 'target_s',
+                            'target_flash_s', 'target_other_s', 'host_sleep_s', 'baud_switch_s'], 0.0)
+    First_Sector = SIM_IMAGE_ADDRESS // Host.FLASH_SECTOR_SIZE
+    Number_Of_Sectors = (len(Image) + Host.FLASH_SECTOR_SIZE - 1) // Host.FLASH_SECTOR_SIZE
+    with tempfile.TemporaryDirectory() as Directory:
+        ''' A used device: the image sectors hold an older image, the erase isn't skipped as blank '''
+        Flash_File = os.path.join(Directory, 'flash.bin')
+        with open(Flash_File, 'wb') as File:
+            File.write(b'\xff' * SIM_IMAGE_ADDRESS + b'\x00' * (Number_Of_Sectors * Host.FLASH_SECTOR_SIZE))
+        Simulator, Port = Start_Simulator(Flash_File, Erase_Us, Program_Us)
+        Host.Serial_Port_Obj = serial.Serial(Port, Host.BL_DEFAULT_BAUD, timeout = 2)
+        Host.verbose_mode = 0
+        BL_Host_Buffer = [0] * Host.BL_HOST_BUFFER_LEN
+        Failed_Packets = 0
+        Start_Time = monotonic()
+        if(Baud != Host.BL_DEFAULT_BAUD):
+            if(not Host.Negotiate_Baud_Rate(BL_Host_Buffer, Baud)):
+                Stop_Simulator(Simulator)
+                raise EnvironmentError("Error !! The bootloader refused " + str(Baud) + " baud")
+            Phases['baud_switch_s'] = monotonic() - Start_Time
+        Phase_Start = monotonic()
+        for Sector in range(First_Sector, First_Sector + Number_Of_Sectors, 255):
+            Host.Send_Erase_Packet(BL_Host_Buffer, Sector, min(255, First_Sector + Number_Of_Sectors - Sector))
+        Phases['erase_s'] = monotonic() - Phase_Start
+        Reply_Len = PIPE_WRITE_REPLY_LEN if (Mode == 'pipelined') else MEM_WRITE_REPLY_LEN
+        ''' Both writes end with an empty packet, its reply holds the status of the last packet (pipelined)
+            or of the block the last packet left in the coalescing buffer (serial) '''
+        Offsets = list(range(0, len(Image), Packet_Len)) + [len(Image)]
+        for Sequence, Offset in enumerate(Offsets):
+            Payload = Image[Offset : Offset + Packet_Len]
+            Phase_Start = monotonic()
+            Frame = Build_Frame(Build_Write_Packet(Mode, Sequence, SIM_IMAGE_ADDRESS + Offset, Payload))
+            Write_Start = monotonic()
+            Host.Serial_Port_Obj.write(Frame)
+            Reply_Start = monotonic()
+            Reply = Read_Reply()
+            Reply_End = monotonic()
+            if(Mode == 'pipelined'):
+                ''' The first reply reports no previous packet '''
+                if((Reply is None) or ((Sequence != 0) and (Reply[1] != Host.FLASH_PAYLOAD_WRITE_PASSED))):
+                    Failed_Packets = Failed_Packets + 1
+            elif((Reply is None) or (Reply[0] != Host.FLASH_PAYLOAD_WRITE_PASSED)):
+                Failed_Packets = Failed_Packets + 1
+            Wire_Time = (len(Frame) + Reply_Len) * UART_FRAME_BITS / Baud
+            Phases['host_build_s'] += Write_Start - Phase_Start
+            Phases['host_write_s'] += Reply_Start - Write_Start
+            Phases['wire_s'] += Wire_Time
+            Phases['target_s'] += max(0.0, Reply_End - Reply_Start - Wire_Time)
+            if(Host_Sleep):
+                sleep(Host_Sleep)
+                Phases['host_sleep_s'] += monotonic() - Reply_End
+        Total_Time = monotonic() - Start_Time
+        Host.Serial_Port_Obj.close()
+        Stats = Stop_Simulator(Simulator)
+        with open(Flash_File, 'rb') as File:
+            File.seek(SIM_IMAGE_ADDRESS)
+            Verified = (File.read(len(Image)) == Image)
+    Phases['erase_flash_s'] = Stats.get('erase_s', 0.0)
+    Phases['target_flash_s'] = Stats.get('program_s', 0.0)
+    Phases['target_other_s'] = max(0.0, Phases['target_s'] - Phases['target_flash_s'])
+    return {'mode': Mode, 'image_bytes': len(Image), 'packet_bytes': Packet_Len, 'baud': Baud, 'host_sleep_s': Host_Sleep,
+            'erase_us': Erase_Us, 'program_us': Program_Us, 'total_s': round(Total_Time, 6),
+            'throughput_Bps': round(len(Image) / Total_Time, 1),
+            'phases': {Key: round(Value, 6) for Key, Value in Phases.items()},
+            'packets': (len(Image) + Packet_Len - 1) // Packet_Len, 'failed_packets': Failed_Packets,
+            'uart_overruns': int(Stats.get('overruns', 0)), 'verified': Verified}
+
+def Print_Result(Result):
+    print("%s write, image %d bytes, %d byte packets, %d baud, %.3f s between packets" %
+          (Result['mode'].capitalize(), Result['image_bytes'], Result['packet_bytes'], Result['baud'], Result['host_sleep_s']))
+    print("Total %.3f s, %.1f bytes/s, %d packets, %d failed, %d UART overruns, image %s\n" %
+          (Result['total_s'], Result['throughput_Bps'], Result['packets'], Result['failed_packets'],
+           Result['uart_overruns'], "verified" if Result['verified'] else "MISMATCH"))
+    print("Phase              Time (s)  Share")
+    for Key, Value in Result['phases'].items():
+        ''' The flash parts are already counted in erase_s and target_s '''
+        Share = "" if Key in ('erase_flash_s', 'target_flash_s', 'target_other_s') else "%5.1f%%" % (100 * Value / Result['total_s'])
+        print("%-16s  %9.3f  %s" % (Key, Value, Share))
+
+if(__name__ == "__main__"):
+    Parser = argparse.ArgumentParser(description = "BL_FLASH_ERASE_CMD / BL_MEM_WRITE_CMD throughput against Sim/")
+    Parser.add_argument('--mode', choices = ['serial', 'pipelined', 'both'], default = 'serial',
+                        help = "BL_MEM_WRITE_CMD, BL_PIPE_WRITE_CMD or both one after the other (default serial)")
+    Parser.add_argument('--image-kb', type = int, default = 16, help = "image size in KB (default 16)")
+    Parser.add_argument('--packet', type = int, default = 128, help = "payload bytes per BL_MEM_WRITE_CMD (default 128, as Host.py), extended frames above 244")
+    Parser.add_argument('--baud', type = int, default = Host.BL_DEFAULT_BAUD, help = "UART rate, switched with BL_SET_BAUD")
+    Parser.add_argument('--sleep', type = float, default = 0.1, help = "pause after every write reply (default 0.1, as Host.py)")
+    Parser.add_argument('--erase-us', type = int, default = 12000, help = "sector erase time of the simulated flash")
+    Parser.add_argument('--program-us', type = int, default = 15, help = "word program time of the simulated flash")
+    Parser.add_argument('--seed', type = int, default = 0, help = "seed of the random image")
+    Parser.add_argument('--json', action = 'store_true', help = "print the result as one JSON line")
+    Arguments = Parser.parse_args()
+    if(not os.path.exists(SIM_PATH)):
+        sys.exit("Error !! " + SIM_PATH + " is missing, run make -C Sim")
+    if((Arguments.packet < 1) or (Arguments.packet > Host.BL_EXT_WRITE_PAYLOAD_LEN)):
+        sys.exit("Error !! The payload goes from 1 to " + str(Host.BL_EXT_WRITE_PAYLOAD_LEN) + " bytes, above 244 in extended frames")
+    Image = bytes(random.Random(Arguments.seed).getrandbits(8) for Counter in range(Arguments.image_kb * 1024))
+    Modes = ['serial', 'pipelined'] if (Arguments.mode == 'both') else [Arguments.mode]
+    Results = [Run_Benchmark(Image, Arguments.packet, Arguments.baud, Arguments.sleep, Arguments.erase_us, Arguments.program_us, Mode)
+               for Mode in Modes]
+    for Result in Results:
+        if(Arguments.json):
+            print(json.dumps(Result))
+        else:
+            Print_Result(Result)
+            print("")
+    if((len(Results) == 2) and (not Arguments.json)):
+        print("Pipelined over serial: %.2fx the throughput, %.3f s saved" %
+              (Results[1]['throughput_Bps'] / Results[0]['throughput_Bps'], Results[0]['total_s'] - Results[1]['total_s']))
@@ -3,7 +3,7 @@ import struct
 import os
 import sys
 import glob
-from time import sleep
+from time import sleep, monotonic
 
 ''' Bootloader Commands '''
 BL_GET_VER_CMD              = 0x10
@@ -19,22 +19,118 @@ BL_READ_SECTOR_STATUS_CMD   = 0x19
 BL_OTP_READ_CMD             = 0x1A
 BL_CHANGE_ROP_Level_CMD     = 0x1B
 BL_JUMP_TO_USER_APP         = 0x1C
+BL_PIPE_WRITE_CMD           = 0x1D
+BL_STREAM_WRITE_CMD         = 0x1E
+BL_SET_BAUD_CMD             = 0x1F
+BL_GET_SECTOR_CRC_CMD       = 0x20
+BL_COMPRESSED_WRITE_CMD     = 0x21
+BL_VERIFY_CRC_CMD           = 0x22
+BL_ERASE_AHEAD_CMD          = 0x23
+BL_FANOUT_START_CMD         = 0x24
+BL_FANOUT_STATUS_CMD        = 0x25
+BL_GET_STATS_CMD            = 0x26
 
 INVALID_SECTOR_NUMBER        = 0x00
 VALID_SECTOR_NUMBER          = 0x01
 UNSUCCESSFUL_ERASE           = 0x00
 SUCCESSFUL_ERASE             = 0x01
+''' Per sector erase results, packed 4 per byte after the overall erase status '''
+BL_SECTOR_ERASED             = 0x00
+BL_SECTOR_BLANK              = 0x01
+BL_SECTOR_FAILED             = 0x02
+BL_SECTOR_PROTECTED          = 0x03
+BL_FLASH_SECTORS_NUM         = 256
+BL_FLASH_BOOT_SECTORS        = 32
 
 FLASH_PAYLOAD_WRITE_FAILED   = 0x00
 FLASH_PAYLOAD_WRITE_PASSED   = 0x01
+FLASH_PAYLOAD_WRITE_NONE     = 0x02
+
+BL_PIPE_WRITE_PAYLOAD_LEN    = 128
+''' Extended frames ([0x00][LenLo][LenHi][Cmd]...) carry a whole flash sector when the bootloader supports them '''
+BL_EXT_FRAME_MARKER          = 0x00
+BL_FRAME_VERSION_EXTENDED    = 0x02
+BL_LEGACY_MAX_FRAME_LEN      = 255
+BL_EXT_WRITE_PAYLOAD_LEN     = 1024
+BL_HOST_BUFFER_LEN           = 1100
+''' Frames sent ahead of the oldest unacknowledged one, must not exceed BL_STREAM_WINDOW of the bootloader '''
+BL_STREAM_WINDOW             = 4
+
+''' Baud rate negotiation, the ping is sent at the new rate and answered with the pong '''
+BL_DEFAULT_BAUD              = 115200
+BL_BAUD_PING                 = 0xA5
+BL_BAUD_PONG                 = 0x5A
+BL_BAUD_PING_RETRIES         = 5
+BL_BAUD_PING_TIMEOUT         = 0.1
+
+''' CAN link ("can:<channel>[:<node>]" port names, python-can socketcan, a vcan interface works too),
+    node N listens on BL_CAN_RX_BASE + N and answers on BL_CAN_TX_BASE + N '''
+BL_CAN_RX_BASE               = 0x600
+BL_CAN_TX_BASE               = 0x680
+BL_CAN_BITRATE               = 500000
+ISOTP_MAX_MESSAGE            = 4095
+ISOTP_PADDING                = 0xCC
+ISOTP_TIMEOUT                = 1.0
+
+''' Fan out download: frame N on BL_CAN_BCAST_ID + N carries the image bytes at 8 * N '''
+BL_CAN_BCAST_ID              = 0x1BF00000
+BL_FANOUT_IDLE               = 0x00
+BL_FANOUT_ACTIVE             = 0x01
+BL_FANOUT_FAILED             = 0x02
+BL_FANOUT_FRAME_LEN          = 8
+BL_FANOUT_STATUS_WINDOW      = 128
+BL_FANOUT_MAX_ROUNDS         = 20
+
+''' Delta flashing compares the image against the sector CRCs of the target '''
+FLASH_SECTOR_SIZE            = 1024
+BL_SECTOR_CRC_MAX            = 60
+
+''' Compressed write, LZ4 block sequences decoded on target with a LZ4DEC_WINDOW_SIZE history '''
+BL_LZ4_WINDOW                = 2048
+BL_CWRITE_START              = 0x01
+BL_CWRITE_END                = 0x02
+
+''' Memory read back, answered by frames of [LenLo][LenHi][Data][CRC32] '''
+BL_READ_INVALID              = 0x00
+BL_READ_OK                   = 0x01
+BL_READ_PROTECTED            = 0x02
+BL_READ_WRITE_FAILED         = 0x03
+BL_READ_CHUNK_SIZE           = 1024
+
+''' Cycle profiling table, the measured phases come first then one entry per command from BL_GET_VER_CMD '''
+BL_STATS_DISABLED            = 0x00
+BL_STATS_OK                  = 0x01
+BL_STATS_INVALID             = 0x02
+BL_STATS_RESET               = 0x01
+BL_STATS_MAX_ENTRIES         = 15
+BL_STATS_PHASES              = ['frame receive', 'frame CRC32', 'flash erase', 'flash write', 'flash burst']
+
+''' Image header stamped in front of Application.bin: one flash sector, the vector table follows it,
+    [Magic][Load address][Length][CRC32][Version][Header CRC32] little endian words '''
+BL_IMAGE_HEADER_SIZE         = 0x400
+BL_IMAGE_HEADER_MAGIC        = 0x48494C42
+BL_IMAGE_HEADER_WORDS        = 6
+
+''' Sent over and over from before the reset, a bootloader with a valid application then stays for the host '''
+BL_WAKE_BYTE                 = 0x01
+BL_WAKE_PERIOD               = 0.002
+BL_WAKE_TIMEOUT              = 10.0
 
 verbose_mode = 1
+BL_Max_Frame_Len = BL_LEGACY_MAX_FRAME_LEN
 Memory_Write_Active = 0
+Erase_First_Sector = 0
+Erase_Sector_Count = 0
 
 def Check_Serial_Ports():
     Serial_Ports = []
     if sys.platform.startswith('win'):
         Ports = ['COM%s' % (i + 1) for i in range(256)]
+    elif sys.platform.startswith('linux') or sys.platform.startswith('cygwin'):
+        ''' The pty of the simulator (Sim/) is a /dev/pts entry '''
+        Ports = glob.glob('/dev/tty[A-Za-z]*') + glob.glob('/dev/pts/[0-9]*')
+    elif sys.platform.startswith('darwin'):
+        Ports = glob.glob('/dev/tty.*')
     else:
         raise EnvironmentError("Error !! Unsupported Platform \n")
     
@@ -48,10 +144,138 @@ def Check_Serial_Ports():
     
     return Serial_Ports
 
+class Can_Bus:
+    ''' python-can socketcan channel, Rx_Id limits the received frames to one standard identifier '''
+    def __init__(self, Channel, Rx_Id = None):
+        import can
+        self.can = can
+        Filters = None
+        if(Rx_Id is not None):
+            Filters = [{"can_id": Rx_Id, "can_mask": 0x7FF, "extended": False}]
+        self.Bus = can.interface.Bus(channel = Channel, interface = 'socketcan', can_filters = Filters)
+
+    def Send(self, Id, Data, Extended = False):
+        self.Bus.send(self.can.Message(arbitration_id = Id, data = bytes(Data), is_extended_id = Extended))
+
+    def Receive(self, Timeout):
+        ''' Returns (identifier, data) or None '''
+        Message = self.Bus.recv(Timeout)
+        if(Message is None):
+            return None
+        return (Message.arbitration_id, bytes(Message.data))
+
+class IsoTp_Port:
+    ''' Serial like port carrying the host byte stream in ISO-TP messages, every write is one message
+        and the received messages are joined back into one stream, the same way the bootloader does '''
+    def __init__(self, Bus, Tx_Id, Rx_Id, Timeout):
+        self.Bus = Bus
+        self.Tx_Id = Tx_Id
+        self.Rx_Id = Rx_Id
+        self.timeout = Timeout
+        self.baudrate = BL_CAN_BITRATE
+        self.is_open = True
+        self.Rx_Data = bytearray()
+        self.Rx_Remaining = 0
+        self.Rx_SN = 0
+
+    def Send_Frame(self, Data):
+        self.Bus.Send(self.Tx_Id, bytes(Data) + bytes([ISOTP_PADDING] * (8 - len(Data))))
+
+    def Receive_Frame(self, Timeout):
+        Message = self.Bus.Receive(Timeout)
+        if((Message is None) or (Message[0] != self.Rx_Id)):
+            return None
+        return Message[1]
+
+    def Handle_Data_Frame(self, Frame):
+        Pci = Frame[0] & 0xF0
+        if(Pci == 0x00):
+            self.Rx_Data += Frame[1 : 1 + (Frame[0] & 0x0F)]
+        elif(Pci == 0x10):
+            Length = ((Frame[0] & 0x0F) << 8) | Frame[1]
+            self.Rx_Data += Frame[2 : 8]
+            self.Rx_Remaining = Length - 6
+            self.Rx_SN = 1
+            ''' No block limit and no gap, the host keeps up with the bus '''
+            self.Send_Frame([0x30, 0, 0])
+        elif((Pci == 0x20) and self.Rx_Remaining):
+            if((Frame[0] & 0x0F) != self.Rx_SN):
+                ''' Lost frame, the reply CRC or the command timeout makes the caller retry '''
+                self.Rx_Remaining = 0
+            else:
+                Length = min(7, self.Rx_Remaining)
+                self.Rx_Data += Frame[1 : 1 + Length]
+                self.Rx_Remaining -= Length
+                self.Rx_SN = (self.Rx_SN + 1) & 0x0F
+
+    def Wait_Flow_Control(self):
+        ''' Returns (block size, STmin in seconds) or None when the bootloader refused or went silent '''
+        while True:
+            Frame = self.Receive_Frame(ISOTP_TIMEOUT)
+            if(Frame is None):
+                return None
+            if((Frame[0] & 0xF0) != 0x30):
+                self.Handle_Data_Frame(Frame)
+            elif((Frame[0] & 0x0F) == 0x00):
+                STmin = Frame[2] / 1000.0 if (Frame[2] <= 0x7F) else 0.001
+                return (Frame[1], STmin)
+            elif((Frame[0] & 0x0F) != 0x01):
+                return None
+
+    def Send_Message(self, Data):
+        if(len(Data) <= 7):
+            self.Send_Frame([len(Data)] + list(Data))
+            return
+        self.Send_Frame([0x10 | (len(Data) >> 8), len(Data) & 0xFF] + list(Data[0 : 6]))
+        Offset = 6
+        SN = 1
+        while(Offset < len(Data)):
+            Flow_Control = self.Wait_Flow_Control()
+            if(Flow_Control is None):
+                return
+            Block = 0
+            while((Offset < len(Data)) and ((Flow_Control[0] == 0) or (Block < Flow_Control[0]))):
+                self.Send_Frame([0x20 | SN] + list(Data[Offset : Offset + 7]))
+                Offset = Offset + 7
+                SN = (SN + 1) & 0x0F
+                Block = Block + 1
+                if(Flow_Control[1]):
+                    sleep(Flow_Control[1])
+
+    def write(self, Data):
+        Data = bytes(Data)
+        for Offset in range(0, len(Data), ISOTP_MAX_MESSAGE):
+            self.Send_Message(Data[Offset : Offset + ISOTP_MAX_MESSAGE])
+
+    def read(self, Length):
+        Deadline = monotonic() + self.timeout
+        while((len(self.Rx_Data) < Length) and (monotonic() < Deadline)):
+            Frame = self.Receive_Frame(max(0, Deadline - monotonic()))
+            if(Frame is not None):
+                self.Handle_Data_Frame(Frame)
+        Data = bytes(self.Rx_Data[0 : Length])
+        del self.Rx_Data[0 : Length]
+        return Data
+
+    def flush(self):
+        pass
+
+    def reset_input_buffer(self):
+        self.Rx_Data.clear()
+
+def Open_Node_Port(Channel, Node):
+    return IsoTp_Port(Can_Bus(Channel, BL_CAN_TX_BASE + Node), BL_CAN_RX_BASE + Node, BL_CAN_TX_BASE + Node, 2)
+
 def Serial_Port_Configuration(Port_Number):
     global Serial_Port_Obj
+    global Can_Channel
     try:
-        Serial_Port_Obj = serial.Serial(Port_Number, 115200, timeout = 2)
+        if(Port_Number.startswith("can:")):
+            Port_Fields = Port_Number.split(":")
+            Can_Channel = Port_Fields[1]
+            Serial_Port_Obj = Open_Node_Port(Can_Channel, int(Port_Fields[2]) if (len(Port_Fields) > 2) else 0)
+        else:
+            Serial_Port_Obj = serial.Serial(Port_Number, BL_DEFAULT_BAUD, timeout = 2)
     except:
         print("\nError !! That was not a valid port")
     
@@ -130,6 +354,32 @@ def Process_BL_GET_VER_CMD(Data_Len):
     _value_ = bytearray(Serial_Data)
     print("\n   Bootloader Vendor ID : ", _value_[0])
     print("   Bootloader Version   : ", _value_[1], ".", _value_[2], ".", _value_[3])
+    Update_Frame_Capabilities(_value_)
+    print("   Maximum Frame Length : ", BL_Max_Frame_Len)
+
+def Update_Frame_Capabilities(Version_Info):
+    ''' Bootloaders older than the extended frames only send the 4 version bytes '''
+    global BL_Max_Frame_Len
+    if((len(Version_Info) >= 7) and (Version_Info[4] >= BL_FRAME_VERSION_EXTENDED)):
+        BL_Max_Frame_Len = Version_Info[5] | (Version_Info[6] << 8)
+    else:
+        BL_Max_Frame_Len = BL_LEGACY_MAX_FRAME_LEN
+
+def Query_Frame_Capabilities(BL_Host_Buffer):
+    ''' Silent BL_GET_VER used to pick the payload size before a write '''
+    BL_Host_Buffer[0] = 5
+    BL_Host_Buffer[1] = BL_GET_VER_CMD
+    Send_Packet_To_Serial_Port(BL_Host_Buffer, 6)
+    BL_ACK = bytearray(Read_Serial_Port(1))
+    if(BL_ACK[0] == 0xCD):
+        Length_To_Follow = bytearray(Read_Serial_Port(1))[0]
+        Update_Frame_Capabilities(bytearray(Read_Serial_Port(Length_To_Follow)))
+
+def Write_Payload_Len(Header_Len):
+    ''' Largest payload of a write frame with Header_Len bytes between the command and the payload '''
+    if(BL_Max_Frame_Len > BL_LEGACY_MAX_FRAME_LEN):
+        return min(BL_EXT_WRITE_PAYLOAD_LEN, BL_Max_Frame_Len - Header_Len - 4)
+    return BL_PIPE_WRITE_PAYLOAD_LEN
 
 def Process_BL_GET_HELP_CMD(Data_Len):
     Serial_Data = Read_Serial_Port(Data_Len)
@@ -163,6 +413,26 @@ def Process_BL_GET_HELP_CMD(Data_Len):
             print("   BL_CHANGE_ROP_Level_CMD     -->", end = ' ')
         elif command==BL_JUMP_TO_USER_APP:
             print("   BL_JUMP_TO_USER_APP         -->", end = ' ')
+        elif command==BL_PIPE_WRITE_CMD:
+            print("   BL_PIPE_WRITE_CMD           -->", end = ' ')
+        elif command==BL_STREAM_WRITE_CMD:
+            print("   BL_STREAM_WRITE_CMD         -->", end = ' ')
+        elif command==BL_SET_BAUD_CMD:
+            print("   BL_SET_BAUD_CMD             -->", end = ' ')
+        elif command==BL_GET_SECTOR_CRC_CMD:
+            print("   BL_GET_SECTOR_CRC_CMD       -->", end = ' ')
+        elif command==BL_COMPRESSED_WRITE_CMD:
+            print("   BL_COMPRESSED_WRITE_CMD     -->", end = ' ')
+        elif command==BL_VERIFY_CRC_CMD:
+            print("   BL_VERIFY_CRC_CMD           -->", end = ' ')
+        elif command==BL_ERASE_AHEAD_CMD:
+            print("   BL_ERASE_AHEAD_CMD          -->", end = ' ')
+        elif command==BL_FANOUT_START_CMD:
+            print("   BL_FANOUT_START_CMD         -->", end = ' ')
+        elif command==BL_FANOUT_STATUS_CMD:
+            print("   BL_FANOUT_STATUS_CMD        -->", end = ' ')
+        elif command==BL_GET_STATS_CMD:
+            print("   BL_GET_STATS_CMD            -->", end = ' ')
         print(hex(command))
 
 def Process_BL_GET_CID_CMD(Data_Len):
@@ -203,9 +473,29 @@ def Process_BL_FLASH_ERASE_CMD(Data_Len):
             print("\n   Erase Status -> successful Erase ")
         else:
             print("\n   Erase Status -> Unknown Error")
+        Print_Erase_Sector_Results(BL_Erase_Status[1:])
     else:
         print("Timeout !!, Bootloader is not responding")
 
+def Print_Erase_Sector_Results(Packed_Results):
+    ''' The bootloader sends no sector results for a rejected range '''
+    Sector_Counts = [0, 0, 0, 0]
+    Failed_Sectors = []
+    Protected_Sectors = []
+    for Sector_Index in range(min(Erase_Sector_Count, len(Packed_Results) * 4)):
+        Sector_Result = (Packed_Results[Sector_Index >> 2] >> ((Sector_Index & 3) * 2)) & 0x03
+        Sector_Counts[Sector_Result] += 1
+        if(Sector_Result == BL_SECTOR_FAILED):
+            Failed_Sectors.append(Erase_First_Sector + Sector_Index)
+        elif(Sector_Result == BL_SECTOR_PROTECTED):
+            Protected_Sectors.append(Erase_First_Sector + Sector_Index)
+    if(len(Packed_Results)):
+        print("   Erased", Sector_Counts[BL_SECTOR_ERASED], "sectors, skipped", Sector_Counts[BL_SECTOR_BLANK], "blank sectors")
+        if(len(Failed_Sectors)):
+            print("   Failed sectors    :", Failed_Sectors)
+        if(len(Protected_Sectors)):
+            print("   Protected sectors :", Protected_Sectors)
+
 def Process_BL_MEM_WRITE_CMD(Data_Len):
     global Memory_Write_All
     BL_Write_Status = 0
@@ -239,17 +529,498 @@ def Process_BL_Jump_To_User_App(Data_Len):
     elif(_value_[0] == 0x00):
         print("\n   There is No Application Burned Yet !!")
         
-def Calculate_CRC32(Buffer, Buffer_Length):
-    CRC_Value = 0xFFFFFFFF
-    for DataElem in Buffer[0:Buffer_Length]:
+def CRC32_Shift(CRC_Value, Shift_Count):
+    for Shift in range(Shift_Count):
+        if(CRC_Value & 0x80000000):
+            CRC_Value = ((CRC_Value << 1) ^ 0x04C11DB7) & 0xFFFFFFFF
+        else:
+            CRC_Value = (CRC_Value << 1) & 0xFFFFFFFF
+    return CRC_Value
+
+def CRC32_Build_Table(Byte_Position, Shift_Count):
+    return [CRC32_Shift(Byte << (8 * Byte_Position), Shift_Count) for Byte in range(256)]
+
+''' CRC tables : (Byte << 8k) * x^n mod P, the same tables as the slice-by-8 engine in Bootloader/Crc32.c '''
+CRC32_TableS0 = CRC32_Build_Table(0, 32)
+CRC32_TableD0 = CRC32_Build_Table(0, 64)
+CRC32_TableE0 = CRC32_Build_Table(0, 96)
+CRC32_TableQ0 = CRC32_Build_Table(0, 128)
+CRC32_TableQ1 = CRC32_Build_Table(1, 128)
+CRC32_TableQ2 = CRC32_Build_Table(2, 128)
+CRC32_TableQ3 = CRC32_Build_Table(3, 128)
+
+def Calculate_CRC32(Buffer, Buffer_Length, CRC_Value = 0xFFFFFFFF):
+    Data = bytes(Buffer[0:Buffer_Length])
+    S0 = CRC32_TableS0
+    Word_End = len(Data) - (len(Data) % 4)
+    ''' Four bytes per step, same folding as CRC32_ENGINE_SLICE_BY_8 '''
+    for Index in range(0, Word_End, 4):
+        CRC_Value = CRC_Value ^ Data[Index]
+        CRC_Value = (CRC32_TableQ3[CRC_Value >> 24] ^ CRC32_TableQ2[(CRC_Value >> 16) & 0xFF] ^
+                     CRC32_TableQ1[(CRC_Value >> 8) & 0xFF] ^ CRC32_TableQ0[CRC_Value & 0xFF] ^
+                     CRC32_TableE0[Data[Index + 1]] ^ CRC32_TableD0[Data[Index + 2]] ^ S0[Data[Index + 3]])
+    for DataElem in Data[Word_End:]:
         CRC_Value = CRC_Value ^ DataElem
-        for DataElemBitLen in range(32):
-            if(CRC_Value & 0x80000000):
-                CRC_Value = (CRC_Value << 1) ^ 0x04C11DB7
-            else:
-                CRC_Value = (CRC_Value << 1)
+        CRC_Value = ((CRC_Value << 8) & 0xFFFFFFFF) ^ S0[CRC_Value >> 24]
+        CRC_Value = ((CRC_Value << 8) & 0xFFFFFFFF) ^ S0[CRC_Value >> 24]
+        CRC_Value = ((CRC_Value << 8) & 0xFFFFFFFF) ^ S0[CRC_Value >> 24]
+        CRC_Value = ((CRC_Value << 8) & 0xFFFFFFFF) ^ S0[CRC_Value >> 24]
     return CRC_Value
     
+def Send_Packet_To_Serial_Port(BL_Host_Buffer, Packet_Len):
+    ''' Append the CRC32 and send the whole packet with a single write,
+        packets longer than the 8-bit length field go out as extended frames '''
+    if(Packet_Len - 1 > BL_LEGACY_MAX_FRAME_LEN):
+        Frame = [BL_EXT_FRAME_MARKER] + list(struct.pack('<H', Packet_Len - 1)) + BL_Host_Buffer[1 : Packet_Len - 4]
+    else:
+        Frame = BL_Host_Buffer[0 : Packet_Len - 4]
+    CRC32_Value = Calculate_CRC32(Frame, len(Frame)) & 0xFFFFFFFF
+    Serial_Port_Obj.write(bytes(Frame) + struct.pack('<I', CRC32_Value))
+
+def Read_Pipe_Write_Reply():
+    ''' Returns (sequence, commit status) of the previous packet, or None on Not-Acknowledgement '''
+    BL_ACK = bytearray(Read_Serial_Port(1))
+    if(BL_ACK[0] != 0xCD):
+        return None
+    Length_To_Follow = bytearray(Read_Serial_Port(1))[0]
+    Serial_Data = bytearray(Read_Serial_Port(Length_To_Follow))
+    return (Serial_Data[0], Serial_Data[1])
+
+def Send_Pipe_Write_Packet(BL_Host_Buffer, Sequence, Address, Payload):
+    Packet_Len = 8 + len(Payload) + 4
+    BL_Host_Buffer[0] = (Packet_Len - 1) & 0xFF
+    BL_Host_Buffer[1] = BL_PIPE_WRITE_CMD
+    BL_Host_Buffer[2] = Sequence
+    BL_Host_Buffer[3 : 7] = list(struct.pack('<I', Address))
+    BL_Host_Buffer[7] = len(Payload) & 0xFF
+    BL_Host_Buffer[8 : 8 + len(Payload)] = list(Payload)
+    ''' Resend the same packet as long as the bootloader reports a CRC failure '''
+    while True:
+        Send_Packet_To_Serial_Port(BL_Host_Buffer, Packet_Len)
+        Reply = Read_Pipe_Write_Reply()
+        if(Reply is not None):
+            return Reply
+        print("\n   Packet", Sequence, "rejected by the bootloader, resending")
+
+def Read_Stream_Reply():
+    ''' Returns ('ACK', next expected sequence, status), ('NACK', missing sequence, 0) or None on timeout '''
+    BL_Reply = Serial_Port_Obj.read(1)
+    if(len(BL_Reply) == 0):
+        return None
+    if(BL_Reply[0] == 0xCD):
+        Length_To_Follow = bytearray(Read_Serial_Port(1))[0]
+        Serial_Data = bytearray(Read_Serial_Port(Length_To_Follow))
+        return ('ACK', Serial_Data[0] | (Serial_Data[1] << 8), Serial_Data[2])
+    Serial_Data = Serial_Port_Obj.read(2)
+    if(len(Serial_Data) != 2):
+        return None
+    return ('NACK', Serial_Data[0] | (Serial_Data[1] << 8), 0)
+
+def Send_Stream_Frame(BL_Host_Buffer, Sequence, Address, Payload):
+    Packet_Len = 9 + len(Payload) + 4
+    BL_Host_Buffer[0] = (Packet_Len - 1) & 0xFF
+    BL_Host_Buffer[1] = BL_STREAM_WRITE_CMD
+    BL_Host_Buffer[2 : 4] = list(struct.pack('<H', Sequence))
+    BL_Host_Buffer[4 : 8] = list(struct.pack('<I', Address))
+    BL_Host_Buffer[8] = len(Payload) & 0xFF
+    BL_Host_Buffer[9 : 9 + len(Payload)] = list(Payload)
+    Send_Packet_To_Serial_Port(BL_Host_Buffer, Packet_Len)
+
+def Negotiate_Baud_Rate(BL_Host_Buffer, New_Baud):
+    ''' Returns True when both sides run at New_Baud, False when both are back at the old rate '''
+    Old_Baud = Serial_Port_Obj.baudrate
+    BL_Host_Buffer[0] = 9
+    BL_Host_Buffer[1] = BL_SET_BAUD_CMD
+    BL_Host_Buffer[2 : 6] = list(struct.pack('<I', New_Baud))
+    Send_Packet_To_Serial_Port(BL_Host_Buffer, 10)
+    BL_ACK = bytearray(Read_Serial_Port(1))
+    if(BL_ACK[0] != 0xCD):
+        print("\n   Received Not-Acknowledgement from Bootloader")
+        return False
+    Length_To_Follow = bytearray(Read_Serial_Port(1))[0]
+    Serial_Data = bytearray(Read_Serial_Port(Length_To_Follow))
+    if(Serial_Data[0] == 0):
+        print("\n   The bootloader clock can't generate", New_Baud, "baud")
+        return False
+    ''' The bootloader switches as soon as the status byte is out '''
+    Serial_Port_Obj.flush()
+    sleep(0.02)
+    Old_Timeout = Serial_Port_Obj.timeout
+    Serial_Port_Obj.baudrate = New_Baud
+    Serial_Port_Obj.timeout = BL_BAUD_PING_TIMEOUT
+    Serial_Port_Obj.reset_input_buffer()
+    Confirmed = False
+    for Retry in range(BL_BAUD_PING_RETRIES):
+        Serial_Port_Obj.write(bytes([BL_BAUD_PING]))
+        if(BL_BAUD_PONG in bytearray(Serial_Port_Obj.read(1))):
+            Confirmed = True
+            break
+    if(not Confirmed):
+        ''' The bootloader falls back on its own once its ping timeout expires '''
+        Serial_Port_Obj.baudrate = Old_Baud
+        sleep(1.0)
+        Serial_Port_Obj.reset_input_buffer()
+    Serial_Port_Obj.timeout = Old_Timeout
+    return Confirmed
+
+def Read_Sector_CRCs(BL_Host_Buffer, First_Sector, Number_Of_Sectors):
+    ''' Returns the CRC32 of every sector of the range, or None if the bootloader refused it,
+        the sectors of execute only blocks have no CRC (None) and always count as changed '''
+    Sector_CRCs = []
+    while(len(Sector_CRCs) < Number_Of_Sectors):
+        Count = min(BL_SECTOR_CRC_MAX, Number_Of_Sectors - len(Sector_CRCs))
+        BL_Host_Buffer[0] = 7
+        BL_Host_Buffer[1] = BL_GET_SECTOR_CRC_CMD
+        BL_Host_Buffer[2] = First_Sector + len(Sector_CRCs)
+        BL_Host_Buffer[3] = Count
+        Send_Packet_To_Serial_Port(BL_Host_Buffer, 8)
+        BL_ACK = bytearray(Read_Serial_Port(1))
+        if(BL_ACK[0] != 0xCD):
+            continue
+        Length_To_Follow = bytearray(Read_Serial_Port(1))[0]
+        Serial_Data = bytearray(Read_Serial_Port(Length_To_Follow))
+        if(Serial_Data[0] == BL_READ_INVALID):
+            return None
+        if(Serial_Data[0] == BL_READ_PROTECTED):
+            Sector_CRCs += [None] * Count
+            continue
+        Sector_CRCs += list(struct.unpack('<' + 'I' * Count, bytes(Serial_Data[1 : 1 + 4 * Count])))
+    return Sector_CRCs
+
+def Send_Erase_Packet(BL_Host_Buffer, First_Sector, Number_Of_Sectors):
+    ''' Returns the erase status reported by the bootloader '''
+    while True:
+        BL_Host_Buffer[0] = 7
+        BL_Host_Buffer[1] = BL_FLASH_ERASE_CMD
+        BL_Host_Buffer[2] = First_Sector
+        BL_Host_Buffer[3] = Number_Of_Sectors
+        Send_Packet_To_Serial_Port(BL_Host_Buffer, 8)
+        BL_ACK = bytearray(Read_Serial_Port(1))
+        if(BL_ACK[0] == 0xCD):
+            Length_To_Follow = bytearray(Read_Serial_Port(1))[0]
+            return bytearray(Read_Serial_Port(Length_To_Follow))[0]
+
+def Set_Erase_Ahead(BL_Host_Buffer, First_Sector, Number_Of_Sectors):
+    ''' Opens the erase ahead window of the bootloader, an empty window closes it '''
+    while True:
+        BL_Host_Buffer[0] = 7
+        BL_Host_Buffer[1] = BL_ERASE_AHEAD_CMD
+        BL_Host_Buffer[2] = First_Sector
+        BL_Host_Buffer[3] = Number_Of_Sectors
+        Send_Packet_To_Serial_Port(BL_Host_Buffer, 8)
+        BL_ACK = bytearray(Read_Serial_Port(1))
+        if(BL_ACK[0] == 0xCD):
+            Length_To_Follow = bytearray(Read_Serial_Port(1))[0]
+            return bytearray(Read_Serial_Port(Length_To_Follow))[0]
+
+def Open_Erase_Ahead_Window(BL_Host_Buffer, Address, Length):
+    ''' The bootloader erases each sector of the image just before it is written,
+        so no erase command has to be sent and waited for up front '''
+    First_Sector = Address // FLASH_SECTOR_SIZE
+    Number_Of_Sectors = (Address + Length + FLASH_SECTOR_SIZE - 1) // FLASH_SECTOR_SIZE - First_Sector
+    if(input("\n   Erase the image sectors while writing (y/n) : ") != 'y'):
+        return 0
+    if(Set_Erase_Ahead(BL_Host_Buffer, First_Sector, Number_Of_Sectors) != SUCCESSFUL_ERASE):
+        print("\n   Erase ahead rejected, erase the image sectors first")
+        return 0
+    return 1
+
+def Fanout_Start(BL_Host_Buffer, Address, Length):
+    ''' Opens the fan out session of the node behind Serial_Port_Obj, returns its state '''
+    while True:
+        BL_Host_Buffer[0] = 13
+        BL_Host_Buffer[1] = BL_FANOUT_START_CMD
+        BL_Host_Buffer[2 : 6] = list(struct.pack('<I', Address))
+        BL_Host_Buffer[6 : 10] = list(struct.pack('<I', Length))
+        Send_Packet_To_Serial_Port(BL_Host_Buffer, 14)
+        BL_ACK = bytearray(Read_Serial_Port(1))
+        if(BL_ACK[0] == 0xCD):
+            Length_To_Follow = bytearray(Read_Serial_Port(1))[0]
+            return bytearray(Read_Serial_Port(Length_To_Follow))[0]
+
+def Fanout_Missing_Frames(BL_Host_Buffer, Frame_Count):
+    ''' Returns (state, missing frame numbers) of the node behind Serial_Port_Obj '''
+    Missing = []
+    State = BL_FANOUT_IDLE
+    for First_Frame in range(0, Frame_Count, BL_FANOUT_STATUS_WINDOW * 8):
+        while True:
+            BL_Host_Buffer[0] = 7
+            BL_Host_Buffer[1] = BL_FANOUT_STATUS_CMD
+            BL_Host_Buffer[2 : 4] = list(struct.pack('<H', First_Frame))
+            Send_Packet_To_Serial_Port(BL_Host_Buffer, 8)
+            BL_ACK = bytearray(Read_Serial_Port(1))
+            if(BL_ACK[0] == 0xCD):
+                break
+        Length_To_Follow = bytearray(Read_Serial_Port(1))[0]
+        Serial_Data = bytearray(Read_Serial_Port(Length_To_Follow))
+        State = Serial_Data[0]
+        if(State != BL_FANOUT_ACTIVE):
+            break
+        for Frame in range(First_Frame, min(Frame_Count, First_Frame + BL_FANOUT_STATUS_WINDOW * 8)):
+            if(not (Serial_Data[3 + ((Frame - First_Frame) >> 3)] & (1 << (Frame & 7)))):
+                Missing.append(Frame)
+    return (State, Missing)
+
+def Fanout_Send_Frames(Bus, Image, Frames, Frame_Gap):
+    for Frame in Frames:
+        Data = Image[Frame * BL_FANOUT_FRAME_LEN : (Frame + 1) * BL_FANOUT_FRAME_LEN]
+        Bus.Send(BL_CAN_BCAST_ID + Frame, Data, True)
+        if(Frame_Gap):
+            sleep(Frame_Gap)
+
+def Fanout_Write(Node_Ports, Bcast_Bus, Image, Address, Frame_Gap = 0):
+    ''' Programs Image at Address on every node of Node_Ports {node: port} with one broadcast,
+        each round resends the frames at least one node is missing, returns (failed nodes, rounds) '''
+    global Serial_Port_Obj
+    Saved_Port = Serial_Port_Obj
+    BL_Host_Buffer = [0] * BL_HOST_BUFFER_LEN
+    Frame_Count = (len(Image) + BL_FANOUT_FRAME_LEN - 1) // BL_FANOUT_FRAME_LEN
+    First_Sector = Address // FLASH_SECTOR_SIZE
+    Number_Of_Sectors = (Address + len(Image) + FLASH_SECTOR_SIZE - 1) // FLASH_SECTOR_SIZE - First_Sector
+    Failed = []
+    Active = []
+    for Node in Node_Ports:
+        Serial_Port_Obj = Node_Ports[Node]
+        ''' Every node erases its sectors in the background while the frames arrive '''
+        if(Set_Erase_Ahead(BL_Host_Buffer, First_Sector, Number_Of_Sectors) != SUCCESSFUL_ERASE):
+            Send_Erase_Packet(BL_Host_Buffer, First_Sector, Number_Of_Sectors)
+        if(Fanout_Start(BL_Host_Buffer, Address, len(Image)) == BL_FANOUT_ACTIVE):
+            Active.append(Node)
+        else:
+            Failed.append(Node)
+    Missing = list(range(Frame_Count))
+    Rounds = 0
+    while(Missing and Active and (Rounds < BL_FANOUT_MAX_ROUNDS)):
+        Fanout_Send_Frames(Bcast_Bus, Image, Missing, Frame_Gap)
+        Rounds = Rounds + 1
+        Missing_Union = set()
+        for Node in list(Active):
+            Serial_Port_Obj = Node_Ports[Node]
+            State, Node_Missing = Fanout_Missing_Frames(BL_Host_Buffer, Frame_Count)
+            if(State != BL_FANOUT_ACTIVE):
+                Active.remove(Node)
+                Failed.append(Node)
+            else:
+                Missing_Union.update(Node_Missing)
+        Missing = sorted(Missing_Union)
+        if(verbose_mode and Missing):
+            print("\n   Round", Rounds, ":", len(Missing), "frames to resend")
+    for Node in Active:
+        Serial_Port_Obj = Node_Ports[Node]
+        if(Missing or (not Verify_Memory_Range(BL_Host_Buffer, Address, Image))):
+            Failed.append(Node)
+        Set_Erase_Ahead(BL_Host_Buffer, 0, 0)
+    Serial_Port_Obj = Saved_Port
+    return (sorted(Failed), Rounds)
+
+def LZ4_Emit_Length(Stream, Length):
+    while(Length >= 255):
+        Stream.append(255)
+        Length = Length - 255
+    Stream.append(Length)
+
+def LZ4_Compress(Data, Window = BL_LZ4_WINDOW):
+    ''' Greedy LZ4 block sequences, offsets stay below the window of the bootloader decoder '''
+    Stream = bytearray()
+    Last_Position = {}
+    Data_Len = len(Data)
+    Anchor = 0
+    Position = 0
+    while(Position + 4 <= Data_Len):
+        Key = bytes(Data[Position : Position + 4])
+        Candidate = Last_Position.get(Key)
+        Last_Position[Key] = Position
+        if((Candidate is None) or (Position - Candidate >= Window)):
+            Position = Position + 1
+            continue
+        Match_Len = 4
+        while((Position + Match_Len < Data_Len) and (Data[Candidate + Match_Len] == Data[Position + Match_Len])):
+            Match_Len = Match_Len + 1
+        Literal_Len = Position - Anchor
+        Stream.append((min(Literal_Len, 15) << 4) | min(Match_Len - 4, 15))
+        if(Literal_Len >= 15):
+            LZ4_Emit_Length(Stream, Literal_Len - 15)
+        Stream += Data[Anchor : Position]
+        Stream += struct.pack('<H', Position - Candidate)
+        if(Match_Len - 4 >= 15):
+            LZ4_Emit_Length(Stream, Match_Len - 4 - 15)
+        ''' Index the start of the match too, the rest is skipped for speed '''
+        for Index in range(Position + 1, min(Position + Match_Len, Data_Len - 3), max(1, Match_Len // 8)):
+            Last_Position[bytes(Data[Index : Index + 4])] = Index
+        Position = Position + Match_Len
+        Anchor = Position
+    Literal_Len = Data_Len - Anchor
+    Stream.append(min(Literal_Len, 15) << 4)
+    if(Literal_Len >= 15):
+        LZ4_Emit_Length(Stream, Literal_Len - 15)
+    Stream += Data[Anchor : Data_Len]
+    return bytes(Stream)
+
+def Send_Compressed_Frame(BL_Host_Buffer, Flags, Address, Chunk):
+    ''' Returns the write status of the stream so far, the frame is resent on Not-Acknowledgement '''
+    Packet_Len = 7 + len(Chunk) + 4
+    BL_Host_Buffer[0] = (Packet_Len - 1) & 0xFF
+    BL_Host_Buffer[1] = BL_COMPRESSED_WRITE_CMD
+    BL_Host_Buffer[2] = Flags
+    BL_Host_Buffer[3 : 7] = list(struct.pack('<I', Address))
+    BL_Host_Buffer[7 : 7 + len(Chunk)] = list(Chunk)
+    while True:
+        Send_Packet_To_Serial_Port(BL_Host_Buffer, Packet_Len)
+        BL_ACK = bytearray(Read_Serial_Port(1))
+        if(BL_ACK[0] == 0xCD):
+            Length_To_Follow = bytearray(Read_Serial_Port(1))[0]
+            return bytearray(Read_Serial_Port(Length_To_Follow))[0]
+
+def Send_Read_Memory_Packet(BL_Host_Buffer, Address, Length):
+    ''' Returns the read state of the bootloader, the data frames follow BL_READ_OK '''
+    while True:
+        BL_Host_Buffer[0] = 13
+        BL_Host_Buffer[1] = BL_MEM_READ_CMD
+        BL_Host_Buffer[2 : 6] = list(struct.pack('<I', Address))
+        BL_Host_Buffer[6 : 10] = list(struct.pack('<I', Length))
+        Send_Packet_To_Serial_Port(BL_Host_Buffer, 14)
+        BL_ACK = bytearray(Read_Serial_Port(1))
+        if(BL_ACK[0] == 0xCD):
+            Length_To_Follow = bytearray(Read_Serial_Port(1))[0]
+            return bytearray(Read_Serial_Port(Length_To_Follow))[0]
+
+def Read_Memory_Chunk():
+    ''' Returns the data of one frame, or None if its CRC doesn't match '''
+    Chunk_Header = bytearray(Read_Serial_Port(2))
+    Chunk_Len = Chunk_Header[0] | (Chunk_Header[1] << 8)
+    Chunk = bytearray()
+    while(len(Chunk) < Chunk_Len):
+        Chunk += Read_Serial_Port(Chunk_Len - len(Chunk))
+    Chunk_CRC = struct.unpack('<I', bytes(Read_Serial_Port(4)))[0]
+    if(Calculate_CRC32(Chunk_Header + Chunk, Chunk_Len + 2) != Chunk_CRC):
+        return None
+    return Chunk
+
+def Read_Memory_Range(BL_Host_Buffer, Address, Length):
+    ''' Returns the memory content or the read state when the bootloader refuses the range '''
+    Read_State = Send_Read_Memory_Packet(BL_Host_Buffer, Address, Length)
+    if(Read_State != BL_READ_OK):
+        return Read_State
+    Chunks = []
+    Offset = 0
+    while(Offset < Length):
+        Chunks.append((Offset, Read_Memory_Chunk()))
+        Offset = Offset + min(BL_READ_CHUNK_SIZE, Length - Offset)
+        print("\r   Bytes read from the bootloader :{0}".format(Offset), end = '')
+    ''' The stream isn't interrupted by a corrupted frame, only that chunk is read again '''
+    for Index in range(len(Chunks)):
+        while(Chunks[Index][1] is None):
+            Chunk_Offset = Chunks[Index][0]
+            if(Send_Read_Memory_Packet(BL_Host_Buffer, Address + Chunk_Offset, min(BL_READ_CHUNK_SIZE, Length - Chunk_Offset)) == BL_READ_OK):
+                Chunks[Index] = (Chunk_Offset, Read_Memory_Chunk())
+    return b''.join(bytes(Chunk[1]) for Chunk in Chunks)
+
+def Verify_Memory_Range(BL_Host_Buffer, Address, Image):
+    ''' Compares the CRC32 computed by the bootloader over the range with the one of the image '''
+    while True:
+        BL_Host_Buffer[0] = 13
+        BL_Host_Buffer[1] = BL_VERIFY_CRC_CMD
+        BL_Host_Buffer[2 : 6] = list(struct.pack('<I', Address))
+        BL_Host_Buffer[6 : 10] = list(struct.pack('<I', len(Image)))
+        Send_Packet_To_Serial_Port(BL_Host_Buffer, 14)
+        BL_ACK = bytearray(Read_Serial_Port(1))
+        if(BL_ACK[0] == 0xCD):
+            break
+    Length_To_Follow = bytearray(Read_Serial_Port(1))[0]
+    Serial_Data = bytearray(Read_Serial_Port(Length_To_Follow))
+    if(Serial_Data[0] == BL_READ_PROTECTED):
+        print("\n   Verify Status -> The range is read protected")
+        return False
+    if(Serial_Data[0] == BL_READ_WRITE_FAILED):
+        print("\n   Verify Status -> A write failed to program since the last erase")
+        return False
+    if(Serial_Data[0] != BL_READ_OK):
+        print("\n   Verify Status -> Invalid Address or Length")
+        return False
+    Target_CRC = struct.unpack('<I', bytes(Serial_Data[1 : 5]))[0]
+    Image_CRC = Calculate_CRC32(Image, len(Image))
+    if(Target_CRC != Image_CRC):
+        print("\n   Verify Status -> Mismatch, target", hex(Target_CRC), "image", hex(Image_CRC))
+        return False
+    print("\n   Verify Status -> Image matches, CRC32", hex(Image_CRC))
+    return True
+
+def Read_Profile_Stats(BL_Host_Buffer, Reset):
+    ''' Returns the CPU clock and the [Count, Min, Max, Avg] cycles of every entry, None when the profiling is compiled out '''
+    Entries = []
+    Entries_Number = None
+    Clock = 0
+    while((Entries_Number is None) or (len(Entries) < Entries_Number)):
+        ''' The first request asks for no entry, its reply gives the table size '''
+        Count = 0 if (Entries_Number is None) else min(BL_STATS_MAX_ENTRIES, Entries_Number - len(Entries))
+        Last_Page = (Entries_Number is not None) and (len(Entries) + Count == Entries_Number)
+        BL_Host_Buffer[0] = 8
+        BL_Host_Buffer[1] = BL_GET_STATS_CMD
+        BL_Host_Buffer[2] = len(Entries)
+        BL_Host_Buffer[3] = Count
+        BL_Host_Buffer[4] = BL_STATS_RESET if (Reset and Last_Page) else 0
+        Send_Packet_To_Serial_Port(BL_Host_Buffer, 9)
+        BL_ACK = bytearray(Read_Serial_Port(1))
+        if(BL_ACK[0] != 0xCD):
+            continue
+        Length_To_Follow = bytearray(Read_Serial_Port(1))[0]
+        Serial_Data = bytearray(Read_Serial_Port(Length_To_Follow))
+        if(Serial_Data[0] != BL_STATS_OK):
+            return None
+        Entries_Number = Serial_Data[1]
+        Clock = struct.unpack('<I', bytes(Serial_Data[2 : 6]))[0]
+        for Index in range(Count):
+            Entries.append(list(struct.unpack('<IIII', bytes(Serial_Data[6 + 16 * Index : 22 + 16 * Index]))))
+    return Clock, Entries
+
+def Print_Profile_Stats(Clock, Entries):
+    print("\n   CPU clock :", Clock, "Hz")
+    print("   Entry                  Count     Min cycles     Avg cycles     Max cycles    Avg us")
+    for Index in range(len(Entries)):
+        Count, Min, Max, Avg = Entries[Index]
+        if(Count == 0):
+            continue
+        if(Index < len(BL_STATS_PHASES)):
+            Name = BL_STATS_PHASES[Index]
+        else:
+            Name = "command " + hex(BL_GET_VER_CMD + Index - len(BL_STATS_PHASES))
+        print("   %-18s %9d  %13d  %13d  %13d  %8.1f" % (Name, Count, Min, Avg, Max, Avg * 1e6 / Clock))
+
+def Read_Image_Header(Image):
+    ''' Returns the header words of a stamped image, None for a raw one '''
+    if(len(Image) < BL_IMAGE_HEADER_SIZE):
+        return None
+    Header = list(struct.unpack('<' + 'I' * BL_IMAGE_HEADER_WORDS, Image[0 : 4 * BL_IMAGE_HEADER_WORDS]))
+    if((Header[0] != BL_IMAGE_HEADER_MAGIC) or (Calculate_CRC32(Image, 4 * (BL_IMAGE_HEADER_WORDS - 1)) & 0xFFFFFFFF != Header[5])):
+        return None
+    return Header
+
+def Stamp_Image_Header(Image, Load_Address, Version):
+    ''' Returns the header sector followed by the image, an image stamped before gets its header replaced.
+        The image has to be linked at Load_Address and written at Load_Address - BL_IMAGE_HEADER_SIZE '''
+    if(Read_Image_Header(Image) is not None):
+        Image = Image[BL_IMAGE_HEADER_SIZE:]
+    Header = struct.pack('<IIIII', BL_IMAGE_HEADER_MAGIC, Load_Address, len(Image),
+                         Calculate_CRC32(Image, len(Image)) & 0xFFFFFFFF, Version)
+    Header = Header + struct.pack('<I', Calculate_CRC32(Header, len(Header)) & 0xFFFFFFFF)
+    return Header + b'\xff' * (BL_IMAGE_HEADER_SIZE - len(Header)) + Image
+
+def Wake_Bootloader(Timeout = BL_WAKE_TIMEOUT):
+    ''' Returns True once the bootloader answered a wake byte, reset the board while it runs '''
+    Old_Timeout = Serial_Port_Obj.timeout
+    Serial_Port_Obj.timeout = BL_WAKE_PERIOD
+    Serial_Port_Obj.reset_input_buffer()
+    Deadline = monotonic() + Timeout
+    Awake = False
+    while((not Awake) and (monotonic() < Deadline)):
+        Serial_Port_Obj.write(bytes([BL_WAKE_BYTE]))
+        Awake = 0xCD in bytearray(Serial_Port_Obj.read(1))
+    ''' Let the answers of the wake bytes still on the way come in and drop them '''
+    sleep(0.05)
+    Serial_Port_Obj.reset_input_buffer()
+    Serial_Port_Obj.timeout = Old_Timeout
+    return Awake
+
 def Word_Value_To_Byte_Value(Word_Value, Byte_Index, Byte_Lower_First):
     Byte_Value = (Word_Value >> (8 * (Byte_Index - 1)) & 0x000000FF)
     return Byte_Value
@@ -267,7 +1038,7 @@ def Decode_BL_Command(Command):
     BL_Return_Value = 0
     
     ''' Clear the bootloader host buffer '''
-    for counter in range(255):
+    for counter in range(BL_HOST_BUFFER_LEN):
         BL_Host_Buffer.append(0)
     
     if(Command == 1):
@@ -359,10 +1130,18 @@ def Decode_BL_Command(Command):
         NumberOfSectors = 0
         BL_Host_Buffer[0] = BL_FLASH_ERASE_CMD_Len - 1
         BL_Host_Buffer[1] = BL_FLASH_ERASE_CMD
+        global Erase_First_Sector
+        global Erase_Sector_Count
         SectorNumber = input("\n   Please enter start sector number(0-255)          : ")
         SectorNumber = int(SectorNumber, 16)
         if(SectorNumber != 0xFF):
             NumberOfSectors = int(input("\n   Please enter number of sectors to erase (255 Max): "), 16)
+            Erase_First_Sector = SectorNumber
+            Erase_Sector_Count = NumberOfSectors
+        else:
+            ''' A mass erase keeps the bootloader sectors '''
+            Erase_First_Sector = BL_FLASH_BOOT_SECTORS
+            Erase_Sector_Count = BL_FLASH_SECTORS_NUM - BL_FLASH_BOOT_SECTORS
         BL_Host_Buffer[2] = SectorNumber
         BL_Host_Buffer[3] = NumberOfSectors
         CRC32_Value = Calculate_CRC32(BL_Host_Buffer, BL_FLASH_ERASE_CMD_Len - 4) 
@@ -396,6 +1175,7 @@ def Decode_BL_Command(Command):
         ''' Get the start address to write the payload '''
         BaseMemoryAddress = input("\n   Enter the start address : ")
         BaseMemoryAddress = int(BaseMemoryAddress, 16)
+        Image_Start_Address = BaseMemoryAddress
         ''' Keep sending the write packet till the last payload byte '''
         while(BinFileRemainingBytes):
             ''' Memory write is active '''
@@ -456,10 +1236,21 @@ def Decode_BL_Command(Command):
             ''' Read the response from the bootloader '''
             BL_Return_Value = Read_Data_From_Serial_Port(BL_MEM_WRITE_CMD)
             sleep(0.1)
+        ''' An empty packet programs the block the last packet left in the coalescing buffer and returns its status '''
+        BL_Host_Buffer[0] = 10
+        BL_Host_Buffer[1] = BL_MEM_WRITE_CMD
+        BL_Host_Buffer[2 : 6] = list(struct.pack('<I', BaseMemoryAddress))
+        BL_Host_Buffer[6] = 0
+        Send_Packet_To_Serial_Port(BL_Host_Buffer, 11)
+        BL_Return_Value = Read_Data_From_Serial_Port(BL_MEM_WRITE_CMD)
         ''' Memory write is inactive '''
         Memory_Write_Is_Active = 0
+        BinFile.close()
         if(Memory_Write_All == 1):
             print("\n\n Payload Written Successfully")
+            OpenBinFile()
+            Verify_Memory_Range(BL_Host_Buffer, Image_Start_Address, BinFile.read())
+            BinFile.close()
     elif (Command == 12):
         print("Change read protection level of the user flash command")
         Protection_level = input("\n   Please Enter one of these Protection levels : 0,1,2 : ")
@@ -487,6 +1278,244 @@ def Decode_BL_Command(Command):
             Read_Data_From_Serial_Port(BL_CHANGE_ROP_Level_CMD)
         else:
             print("\n   Protection level (", Protection_level, ") not supported !!")
+    elif Command==14:
+        print("Pipelined write of the binary file into the MCU flash")
+        Memory_Write_All = 1
+        Sequence = 0
+        File_Total_Len = CalulateBinFileLength()
+        print("   Preparing writing a binary file with length (", File_Total_Len, ") Bytes")
+        OpenBinFile()
+        BaseMemoryAddress = int(input("\n   Enter the start address : "), 16)
+        BinFileSentBytes = 0
+        Query_Frame_Capabilities(BL_Host_Buffer)
+        Payload_Len = Write_Payload_Len(7)
+        Erase_Ahead = Open_Erase_Ahead_Window(BL_Host_Buffer, BaseMemoryAddress, File_Total_Len)
+        ''' Every reply carries the commit status of the packet sent before it, so there is no need to wait '''
+        while(BinFileSentBytes < File_Total_Len):
+            Payload = BinFile.read(Payload_Len)
+            Reply = Send_Pipe_Write_Packet(BL_Host_Buffer, Sequence, BaseMemoryAddress, Payload)
+            if(Reply[1] == FLASH_PAYLOAD_WRITE_FAILED):
+                print("\n   Write Status -> Packet", Reply[0], "Write Failed or Invalid Address ")
+                Memory_Write_All = 0
+            BaseMemoryAddress = BaseMemoryAddress + len(Payload)
+            BinFileSentBytes = BinFileSentBytes + len(Payload)
+            Sequence = (Sequence + 1) & 0xFF
+            print("\r   Bytes sent to the bootloader :{0}".format(BinFileSentBytes), end = '')
+        ''' An empty packet flushes the pipeline and returns the status of the last packet '''
+        Reply = Send_Pipe_Write_Packet(BL_Host_Buffer, Sequence, 0, b'')
+        if(Reply[1] == FLASH_PAYLOAD_WRITE_FAILED):
+            print("\n   Write Status -> Packet", Reply[0], "Write Failed or Invalid Address ")
+            Memory_Write_All = 0
+        BinFile.close()
+        if(Erase_Ahead):
+            Set_Erase_Ahead(BL_Host_Buffer, 0, 0)
+        if(Memory_Write_All == 1):
+            print("\n\n Payload Written Successfully")
+    elif Command==15:
+        print("Streaming write of the binary file into the MCU flash")
+        File_Total_Len = CalulateBinFileLength()
+        print("   Preparing writing a binary file with length (", File_Total_Len, ") Bytes")
+        OpenBinFile()
+        BaseMemoryAddress = int(input("\n   Enter the start address : "), 16)
+        Query_Frame_Capabilities(BL_Host_Buffer)
+        Payload_Len = Write_Payload_Len(8)
+        Erase_Ahead = Open_Erase_Ahead_Window(BL_Host_Buffer, BaseMemoryAddress, File_Total_Len)
+        Frames = []
+        while True:
+            Payload = BinFile.read(Payload_Len)
+            if(len(Payload) == 0):
+                break
+            Frames.append((BaseMemoryAddress, Payload))
+            BaseMemoryAddress = BaseMemoryAddress + len(Payload)
+        BinFile.close()
+        Window_Base = 0
+        Next_Frame = 0
+        Stream_Status = FLASH_PAYLOAD_WRITE_PASSED
+        ''' Keep the window full, slide it on cumulative ACKs and resend only the NACKed frames '''
+        while(Window_Base < len(Frames)):
+            while((Next_Frame < len(Frames)) and (Next_Frame - Window_Base < BL_STREAM_WINDOW)):
+                Send_Stream_Frame(BL_Host_Buffer, Next_Frame, Frames[Next_Frame][0], Frames[Next_Frame][1])
+                Next_Frame = Next_Frame + 1
+            Reply = Read_Stream_Reply()
+            if(Reply is None):
+                ''' Nothing heard, the oldest frame or its reply is lost '''
+                Send_Stream_Frame(BL_Host_Buffer, Window_Base, Frames[Window_Base][0], Frames[Window_Base][1])
+            elif(Reply[0] == 'ACK'):
+                Window_Base = max(Window_Base, Reply[1])
+                Stream_Status = Reply[2]
+            elif(Reply[1] < len(Frames)):
+                Send_Stream_Frame(BL_Host_Buffer, Reply[1], Frames[Reply[1]][0], Frames[Reply[1]][1])
+            print("\r   Frames acknowledged by the bootloader :{0}/{1}".format(Window_Base, len(Frames)), end = '')
+        ''' Drain the replies of frames still in flight, then close the stream with an empty frame '''
+        while(Read_Stream_Reply() is not None):
+            pass
+        Reply = None
+        while((Reply is None) or (Reply[0] != 'ACK')):
+            Send_Stream_Frame(BL_Host_Buffer, len(Frames), 0, b'')
+            Reply = Read_Stream_Reply()
+        if(Erase_Ahead):
+            Set_Erase_Ahead(BL_Host_Buffer, 0, 0)
+        if(Reply[2] == FLASH_PAYLOAD_WRITE_PASSED):
+            print("\n\n Payload Written Successfully")
+        else:
+            print("\n\n Write Failed or Invalid Address")
+    elif Command==16:
+        print("Switch the link to another baud rate")
+        New_Baud = input("\n   Enter the new baud rate (Ex: 921600) : ")
+        if(not New_Baud.isdigit()):
+            print("   Error !!, Please enter a valid baud rate !! \n")
+        elif(Negotiate_Baud_Rate(BL_Host_Buffer, int(New_Baud))):
+            print("\n   Link running at", Serial_Port_Obj.baudrate, "baud")
+        else:
+            print("\n   Kept the link at", Serial_Port_Obj.baudrate, "baud")
+    elif Command==17:
+        print("Delta write, only the sectors that differ from the binary file are erased and programmed")
+        File_Total_Len = CalulateBinFileLength()
+        OpenBinFile()
+        Image = BinFile.read()
+        BinFile.close()
+        BaseMemoryAddress = int(input("\n   Enter the start address (sector aligned) : "), 16)
+        if(BaseMemoryAddress % FLASH_SECTOR_SIZE):
+            print("\n   Error !! The start address must be a multiple of", FLASH_SECTOR_SIZE)
+            return
+        ''' Erased flash reads 0xFF, pad the last sector the same way '''
+        Number_Of_Sectors = (File_Total_Len + FLASH_SECTOR_SIZE - 1) // FLASH_SECTOR_SIZE
+        Image = Image + b'\xFF' * (Number_Of_Sectors * FLASH_SECTOR_SIZE - File_Total_Len)
+        First_Sector = BaseMemoryAddress // FLASH_SECTOR_SIZE
+        Target_CRCs = Read_Sector_CRCs(BL_Host_Buffer, First_Sector, Number_Of_Sectors)
+        if(Target_CRCs is None):
+            print("\n   Error !! The image doesn't fit the flash")
+            return
+        Changed = [Sector for Sector in range(Number_Of_Sectors)
+                   if Calculate_CRC32(Image[Sector * FLASH_SECTOR_SIZE : (Sector + 1) * FLASH_SECTOR_SIZE], FLASH_SECTOR_SIZE) != Target_CRCs[Sector]]
+        ''' The first write after erasing the application base sets the jump address, so that sector always goes first '''
+        if((len(Changed) == 0) or (Changed[0] != 0)):
+            Changed.insert(0, 0)
+        print("   Sectors changed :", len(Changed), "of", Number_Of_Sectors)
+        Query_Frame_Capabilities(BL_Host_Buffer)
+        Payload_Len = Write_Payload_Len(7)
+        Memory_Write_All = 1
+        Sequence = 0
+        Run_Start = 0
+        ''' Erase and program every run of contiguous changed sectors '''
+        while(Run_Start < len(Changed)):
+            Run_End = Run_Start + 1
+            while((Run_End < len(Changed)) and (Changed[Run_End] == Changed[Run_End - 1] + 1)):
+                Run_End = Run_End + 1
+            Run_Sector = Changed[Run_Start]
+            Run_Len = Run_End - Run_Start
+            if(Send_Erase_Packet(BL_Host_Buffer, First_Sector + Run_Sector, Run_Len) != SUCCESSFUL_ERASE):
+                print("\n   Erase Status -> Unsuccessful Erase of sector", First_Sector + Run_Sector)
+                Memory_Write_All = 0
+            Offset = Run_Sector * FLASH_SECTOR_SIZE
+            while(Offset < (Run_Sector + Run_Len) * FLASH_SECTOR_SIZE):
+                Payload = Image[Offset : min(Offset + Payload_Len, (Run_Sector + Run_Len) * FLASH_SECTOR_SIZE)]
+                Reply = Send_Pipe_Write_Packet(BL_Host_Buffer, Sequence, BaseMemoryAddress + Offset, Payload)
+                if(Reply[1] == FLASH_PAYLOAD_WRITE_FAILED):
+                    print("\n   Write Status -> Packet", Reply[0], "Write Failed or Invalid Address ")
+                    Memory_Write_All = 0
+                Offset = Offset + len(Payload)
+                Sequence = (Sequence + 1) & 0xFF
+            print("\r   Sectors programmed :{0}/{1}".format(Run_End, len(Changed)), end = '')
+            Run_Start = Run_End
+        Reply = Send_Pipe_Write_Packet(BL_Host_Buffer, Sequence, 0, b'')
+        if(Reply[1] == FLASH_PAYLOAD_WRITE_FAILED):
+            print("\n   Write Status -> Packet", Reply[0], "Write Failed or Invalid Address ")
+            Memory_Write_All = 0
+        if(Memory_Write_All == 1):
+            print("\n\n Payload Written Successfully")
+    elif Command==18:
+        print("Compressed write of the binary file into the MCU flash")
+        OpenBinFile()
+        Image = BinFile.read()
+        BinFile.close()
+        BaseMemoryAddress = int(input("\n   Enter the start address : "), 16)
+        Compressed = LZ4_Compress(Image)
+        print("   Binary file (", len(Image), ") Bytes compressed to (", len(Compressed), ") Bytes")
+        Query_Frame_Capabilities(BL_Host_Buffer)
+        Payload_Len = Write_Payload_Len(6)
+        Offset = 0
+        Flags = BL_CWRITE_START
+        Write_Status = FLASH_PAYLOAD_WRITE_PASSED
+        while(Write_Status == FLASH_PAYLOAD_WRITE_PASSED):
+            Chunk = Compressed[Offset : Offset + Payload_Len]
+            Offset = Offset + len(Chunk)
+            if(Offset == len(Compressed)):
+                Flags = Flags | BL_CWRITE_END
+            Write_Status = Send_Compressed_Frame(BL_Host_Buffer, Flags, BaseMemoryAddress, Chunk)
+            Flags = 0
+            print("\r   Compressed bytes sent to the bootloader :{0}".format(Offset), end = '')
+            if(Offset == len(Compressed)):
+                break
+        if(Write_Status == FLASH_PAYLOAD_WRITE_PASSED):
+            print("\n\n Payload Written Successfully")
+        else:
+            print("\n\n Write Failed, Invalid Address or Corrupted Stream")
+    elif Command==9:
+        print("Read a memory range of the MCU into a file")
+        BaseMemoryAddress = int(input("\n   Enter the start address : "), 16)
+        Read_Length = int(input("\n   Enter the number of bytes to read : "), 0)
+        File_Name = input("\n   Enter the output file name : ")
+        Memory_Data = Read_Memory_Range(BL_Host_Buffer, BaseMemoryAddress, Read_Length)
+        if(Memory_Data == BL_READ_PROTECTED):
+            print("\n   Read Status -> The range is read protected")
+        elif(Memory_Data == BL_READ_INVALID):
+            print("\n   Read Status -> Invalid Address or Length")
+        else:
+            with open(File_Name, 'wb') as Dump_File:
+                Dump_File.write(Memory_Data)
+            print("\n\n   (", len(Memory_Data), ") Bytes written to", File_Name)
+    elif Command==19:
+        print("Verify the binary file against the MCU memory")
+        OpenBinFile()
+        Image = BinFile.read()
+        BinFile.close()
+        BaseMemoryAddress = int(input("\n   Enter the start address : "), 16)
+        Verify_Memory_Range(BL_Host_Buffer, BaseMemoryAddress, Image)
+    elif Command==20:
+        print("Fan out write of the binary file to several CAN nodes")
+        if(not isinstance(Serial_Port_Obj, IsoTp_Port)):
+            print("\n   Fan out needs a CAN port (can:<channel>)")
+            return
+        Nodes = [int(Node) for Node in input("\n   Enter the node numbers (Ex: 0,1,2) : ").split(",")]
+        BaseMemoryAddress = int(input("\n   Enter the start address : "), 16)
+        OpenBinFile()
+        Image = BinFile.read()
+        BinFile.close()
+        Node_Ports = {Node: Open_Node_Port(Can_Channel, Node) for Node in Nodes}
+        Failed, Rounds = Fanout_Write(Node_Ports, Can_Bus(Can_Channel), Image, BaseMemoryAddress)
+        print("\n   Fan out done in", Rounds, "rounds, failed nodes :", Failed if Failed else "none")
+    elif Command==21:
+        print("Read the cycle profiling counters of the bootloader")
+        Reset = input("\n   Clear the counters after reading (y/n) : ").strip().lower() == 'y'
+        Stats = Read_Profile_Stats(BL_Host_Buffer, Reset)
+        if(Stats is None):
+            print("\n   The bootloader is built without profiling (PROF_STATUS)")
+        else:
+            Print_Profile_Stats(Stats[0], Stats[1])
+    elif Command==22:
+        print("Hold the bootloader after the next reset")
+        print("\n   Reset the board now ...")
+        if(Wake_Bootloader()):
+            print("\n   The bootloader is waiting for commands")
+        else:
+            print("\n   No answer of the bootloader in", BL_WAKE_TIMEOUT, "s")
+    elif Command==23:
+        print("Stamp the image header into Application.bin")
+        OpenBinFile()
+        Image = BinFile.read()
+        BinFile.close()
+        Load_Address = int(input("\n   Enter the address the application is linked at (Ex: 0x8400) : "), 16)
+        Version = int(input("\n   Enter the image version (Ex: 0x00010200) : "), 16)
+        if((Load_Address % BL_IMAGE_HEADER_SIZE) != 0):
+            print("\n   The vector table needs a", BL_IMAGE_HEADER_SIZE, "bytes aligned address")
+            return
+        Image = Stamp_Image_Header(Image, Load_Address, Version)
+        with open('Application.bin', 'wb') as Stamped_File:
+            Stamped_File.write(Image)
+        Header = Read_Image_Header(Image)
+        print("\n   Image of", Header[2], "bytes, CRC32", hex(Header[3]), "version", hex(Header[4]))
+        print("   Write Application.bin at", hex(Load_Address - BL_IMAGE_HEADER_SIZE))
     elif Command==13:
         print("Jumping to User APP")
         BL_JUMP_TO_USER_APP_LEN=6
@@ -502,33 +1531,44 @@ def Decode_BL_Command(Command):
         for Data in BL_Host_Buffer[1 : BL_JUMP_TO_USER_APP_LEN]:
             Write_Data_To_Serial_Port(Data, BL_JUMP_TO_USER_APP_LEN - 1)
         Read_Data_From_Serial_Port(BL_JUMP_TO_USER_APP)
-SerialPortName = input("Enter the Port Name of your device(Ex: COM3):")
-State=Serial_Port_Configuration(SerialPortName)
-if State!=-1:  
-    while True:
-        print("\nTM4c123xx Custome BootLoader")
-        print("==============================")
-        print("Which command you need to send to the bootLoader :");
-        print("   BL_GET_VER_CMD              --> 1")
-        print("   BL_GET_HELP_CMD             --> 2")
-        print("   BL_GET_CID_CMD              --> 3")
-        print("   BL_GET_RDP_STATUS_CMD       --> 4")
-        print("   BL_GO_TO_ADDR_CMD           --> 5")
-        print("   BL_FLASH_ERASE_CMD          --> 6")
-        print("   BL_MEM_WRITE_CMD            --> 7")
-        print("   BL_ED_W_PROTECT_CMD         --> 8")
-        print("   BL_MEM_READ_CMD             --> 9")
-        print("   BL_READ_SECTOR_STATUS_CMD   --> 10")
-        print("   BL_OTP_READ_CMD             --> 11")
-        print("   BL_CHANGE_ROP_Level_CMD     --> 12")
-        print("   BL_JUMP_TO_USER_APP         --> 13")
+if(__name__ == "__main__"):
+    SerialPortName = input("Enter the Port Name of your device(Ex: COM3, /dev/ttyACM0, /dev/pts/3 of Sim/, can:vcan0, can:vcan0:<node>):")
+    State=Serial_Port_Configuration(SerialPortName)
+    if State!=-1:  
+        while True:
+            print("\nTM4c123xx Custome BootLoader")
+            print("==============================")
+            print("Which command you need to send to the bootLoader :");
+            print("   BL_GET_VER_CMD              --> 1")
+            print("   BL_GET_HELP_CMD             --> 2")
+            print("   BL_GET_CID_CMD              --> 3")
+            print("   BL_GET_RDP_STATUS_CMD       --> 4")
+            print("   BL_GO_TO_ADDR_CMD           --> 5")
+            print("   BL_FLASH_ERASE_CMD          --> 6")
+            print("   BL_MEM_WRITE_CMD            --> 7")
+            print("   BL_ED_W_PROTECT_CMD         --> 8")
+            print("   BL_MEM_READ_CMD             --> 9")
+            print("   BL_READ_SECTOR_STATUS_CMD   --> 10")
+            print("   BL_OTP_READ_CMD             --> 11")
+            print("   BL_CHANGE_ROP_Level_CMD     --> 12")
+            print("   BL_JUMP_TO_USER_APP         --> 13")
+            print("   BL_PIPE_WRITE_CMD           --> 14")
+            print("   BL_STREAM_WRITE_CMD         --> 15")
+            print("   BL_SET_BAUD_CMD             --> 16")
+            print("   BL_DELTA_WRITE              --> 17")
+            print("   BL_COMPRESSED_WRITE_CMD     --> 18")
+            print("   BL_VERIFY_CRC_CMD           --> 19")
+            print("   BL_FANOUT_WRITE             --> 20")
+            print("   BL_GET_STATS_CMD            --> 21")
+            print("   BL_WAKE                     --> 22")
+            print("   STAMP_IMAGE_HEADER          --> 23")
         
-        BL_Command = input("\nEnter the command code : ")
+            BL_Command = input("\nEnter the command code : ")
         
-        if(not BL_Command.isdigit()):
-            print("   Error !!, Please enter a valid command !! \n")
-        else:
-            Decode_BL_Command(int(BL_Command))
+            if(not BL_Command.isdigit()):
+                print("   Error !!, Please enter a valid command !! \n")
+            else:
+                Decode_BL_Command(int(BL_Command))
         
-        input("\nPlease press any key to continue ...")
-        Serial_Port_Obj.reset_input_buffer()
\ No newline at end of file
+            input("\nPlease press any key to continue ...")
+            Serial_Port_Obj.reset_input_buffer()
\ No newline at end of file
@@ -0,0 +1,333 @@
+/*
+ * IsoTp.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ */
+#include "IsoTp.h"
+
+#define ISOTP_PCI_SF            0x00
+#define ISOTP_PCI_FF            0x10
+#define ISOTP_PCI_CF            0x20
+#define ISOTP_PCI_FC            0x30
+
+#define ISOTP_FC_CTS            0x00
+#define ISOTP_FC_WAIT           0x01
+#define ISOTP_FC_OVFLW          0x02
+
+#define ISOTP_SF_MAX_DATA       7U
+#define ISOTP_FF_DATA           6U
+#define ISOTP_CF_DATA           7U
+
+/*STmin 0x00-0x7F is in ms, 0xF1-0xF9 is 100-900 us and is rounded up to a tick, the rest is reserved and means the maximum*/
+static uint8_t ISOTP_STminTicks(uint8_t Copy_STmin)
+{
+    uint8_t Local_Ticks=0x7FU;
+    if(Copy_STmin<=0x7FU)
+    {
+        Local_Ticks=Copy_STmin;
+    }
+    else if((Copy_STmin>=0xF1U) && (Copy_STmin<=0xF9U))
+    {
+        Local_Ticks=1U;
+    }
+    return Local_Ticks;
+}
+
+/*Build a frame padded to 8 bytes and hand it to the bus*/
+static bool ISOTP_SendFrame(ISOTP_Link_t* Copy_Link,uint8_t Copy_Pci0,uint8_t Copy_Pci1,uint8_t Copy_PciLen,const uint8_t* Copy_Data,uint8_t Copy_DataLen)
+{
+    uint8_t Local_Frame[ISOTP_FRAME_LEN];
+    uint8_t Local_Counter=0U;
+    Local_Frame[0]=Copy_Pci0;
+    Local_Frame[1]=Copy_Pci1;
+    for(Local_Counter=0U;Local_Counter<Copy_DataLen;Local_Counter++)
+    {
+        Local_Frame[Copy_PciLen+Local_Counter]=Copy_Data[Local_Counter];
+    }
+    for(Local_Counter+=Copy_PciLen;Local_Counter<ISOTP_FRAME_LEN;Local_Counter++)
+    {
+        Local_Frame[Local_Counter]=ISOTP_PADDING;
+    }
+    return Copy_Link->Transmit(Copy_Link->Context, Local_Frame);
+}
+
+static bool ISOTP_SendFlowControl(ISOTP_Link_t* Copy_Link,uint8_t Copy_Status)
+{
+    uint8_t Local_STmin=Copy_Link->STmin;
+    /*FS and BS, then STmin in byte 2*/
+    return ISOTP_SendFrame(Copy_Link, ISOTP_PCI_FC | Copy_Status, Copy_Link->BlockSize, 2U, &Local_STmin, 1U);
+}
+
+/*Bytes the next flow control grants, they must all fit in the receive ring*/
+static uint16_t ISOTP_BlockBytes(const ISOTP_Link_t* Copy_Link)
+{
+    uint16_t Local_Bytes=Copy_Link->RxRemaining;
+    if((Copy_Link->BlockSize!=0U) && (Local_Bytes>((uint16_t)Copy_Link->BlockSize*ISOTP_CF_DATA)))
+    {
+        Local_Bytes=(uint16_t)Copy_Link->BlockSize*ISOTP_CF_DATA;
+    }
+    return Local_Bytes;
+}
+
+void ISOTP_Init(ISOTP_Link_t* Copy_Link,ISOTP_Transmit_t Copy_Transmit,void* Copy_Context,RingBuffer_t* Copy_RxRing,uint8_t Copy_BlockSize,uint8_t Copy_STmin)
+{
+    Copy_Link->Transmit=Copy_Transmit;
+    Copy_Link->Context=Copy_Context;
+    Copy_Link->RxRing=Copy_RxRing;
+    Copy_Link->BlockSize=Copy_BlockSize;
+    Copy_Link->STmin=Copy_STmin;
+    Copy_Link->TxState=ISOTP_TX_IDLE;
+    Copy_Link->TxData=0;
+    Copy_Link->TxLength=0U;
+    Copy_Link->TxOffset=0U;
+    Copy_Link->TxSN=0U;
+    Copy_Link->TxBlockSize=0U;
+    Copy_Link->TxBlockLeft=0U;
+    Copy_Link->TxSTmin=0U;
+    Copy_Link->TxTimer=0U;
+    Copy_Link->RxState=ISOTP_RX_IDLE;
+    Copy_Link->RxRemaining=0U;
+    Copy_Link->RxSN=0U;
+    Copy_Link->RxBlockLeft=0U;
+    Copy_Link->RxWaits=0U;
+    Copy_Link->RxTimer=0U;
+    Copy_Link->RxErrors=0U;
+}
+
+bool ISOTP_Send(ISOTP_Link_t* Copy_Link,const uint8_t* Copy_Data,uint16_t Copy_Length)
+{
+    bool Local_State=false;
+    if((Copy_Length!=0U) && (Copy_Length<=ISOTP_MAX_MESSAGE) &&
+       ((Copy_Link->TxState==ISOTP_TX_IDLE) || (Copy_Link->TxState==ISOTP_TX_DONE) || (Copy_Link->TxState==ISOTP_TX_ERROR)))
+    {
+        Copy_Link->TxData=Copy_Data;
+        Copy_Link->TxLength=Copy_Length;
+        Copy_Link->TxOffset=0U;
+        Copy_Link->TxSN=1U;
+        Copy_Link->TxState=(Copy_Length<=ISOTP_SF_MAX_DATA) ? ISOTP_TX_SEND_SF : ISOTP_TX_SEND_FF;
+        Local_State=true;
+    }
+    return Local_State;
+}
+
+void ISOTP_OnFrame(ISOTP_Link_t* Copy_Link,const uint8_t* Copy_Frame,uint8_t Copy_Length)
+{
+    uint16_t Local_Length=0U;
+    uint8_t Local_Pci=(Copy_Length!=0U) ? (Copy_Frame[0] & 0xF0U) : 0xF0U;
+    if(Local_Pci==ISOTP_PCI_SF)
+    {
+        Local_Length=Copy_Frame[0] & 0x0FU;
+        if((Local_Length!=0U) && (Local_Length<=ISOTP_SF_MAX_DATA) && (Local_Length<Copy_Length))
+        {
+            /*A new message ends the one being received*/
+            if(Copy_Link->RxState!=ISOTP_RX_IDLE)
+            {
+                Copy_Link->RxState=ISOTP_RX_IDLE;
+                Copy_Link->RxErrors++;
+            }
+            if(RingBuffer_Free(Copy_Link->RxRing)>=Local_Length)
+            {
+                RingBuffer_Write(Copy_Link->RxRing, &Copy_Frame[1], Local_Length);
+            }
+            else
+            {
+                Copy_Link->RxErrors++;
+            }
+        }
+    }
+    else if((Local_Pci==ISOTP_PCI_FF) && (Copy_Length==ISOTP_FRAME_LEN))
+    {
+        Local_Length=((uint16_t)(Copy_Frame[0] & 0x0FU)<<8) | Copy_Frame[1];
+        if(Local_Length>ISOTP_SF_MAX_DATA)
+        {
+            if(Copy_Link->RxState!=ISOTP_RX_IDLE)
+            {
+                Copy_Link->RxErrors++;
+            }
+            if(RingBuffer_Free(Copy_Link->RxRing)>=ISOTP_FF_DATA)
+            {
+                RingBuffer_Write(Copy_Link->RxRing, &Copy_Frame[2], ISOTP_FF_DATA);
+                Copy_Link->RxRemaining=Local_Length-ISOTP_FF_DATA;
+                Copy_Link->RxSN=1U;
+                Copy_Link->RxWaits=0U;
+                Copy_Link->RxTimer=ISOTP_WAIT_TICKS;
+                Copy_Link->RxState=ISOTP_RX_SEND_FC;
+            }
+            else
+            {
+                Copy_Link->RxState=ISOTP_RX_SEND_OVFLW;
+            }
+        }
+    }
+    else if((Local_Pci==ISOTP_PCI_CF) && (Copy_Link->RxState==ISOTP_RX_WAIT_CF))
+    {
+        Local_Length=(Copy_Link->RxRemaining>ISOTP_CF_DATA) ? ISOTP_CF_DATA : Copy_Link->RxRemaining;
+        if(((Copy_Frame[0] & 0x0FU)!=Copy_Link->RxSN) || (Copy_Length<(Local_Length+1U)))
+        {
+            /*A lost frame breaks the message, the bootloader CRC makes the host send it again*/
+            Copy_Link->RxState=ISOTP_RX_IDLE;
+            Copy_Link->RxErrors++;
+        }
+        else
+        {
+            /*The flow control only granted this block once it fitted in the ring*/
+            RingBuffer_Write(Copy_Link->RxRing, &Copy_Frame[1], Local_Length);
+            Copy_Link->RxRemaining-=Local_Length;
+            Copy_Link->RxSN=(Copy_Link->RxSN+1U) & 0x0FU;
+            Copy_Link->RxTimer=ISOTP_TIMEOUT_TICKS;
+            if(Copy_Link->RxRemaining==0U)
+            {
+                Copy_Link->RxState=ISOTP_RX_IDLE;
+            }
+            else if(Copy_Link->BlockSize!=0U)
+            {
+                Copy_Link->RxBlockLeft--;
+                if(Copy_Link->RxBlockLeft==0U)
+                {
+                    Copy_Link->RxWaits=0U;
+                    Copy_Link->RxTimer=ISOTP_WAIT_TICKS;
+                    Copy_Link->RxState=ISOTP_RX_SEND_FC;
+                }
+            }
+        }
+    }
+    else if((Local_Pci==ISOTP_PCI_FC) && (Copy_Link->TxState==ISOTP_TX_WAIT_FC) && (Copy_Length>=3U))
+    {
+        if((Copy_Frame[0] & 0x0FU)==ISOTP_FC_CTS)
+        {
+            Copy_Link->TxBlockSize=Copy_Frame[1];
+            Copy_Link->TxBlockLeft=Copy_Frame[1];
+            Copy_Link->TxSTmin=ISOTP_STminTicks(Copy_Frame[2]);
+            Copy_Link->TxTimer=0U;
+            Copy_Link->TxState=ISOTP_TX_SEND_CF;
+        }
+        else if((Copy_Frame[0] & 0x0FU)==ISOTP_FC_WAIT)
+        {
+            Copy_Link->TxTimer=ISOTP_TIMEOUT_TICKS;
+        }
+        else
+        {
+            Copy_Link->TxState=ISOTP_TX_ERROR;
+        }
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+}
+
+void ISOTP_OnTick(ISOTP_Link_t* Copy_Link)
+{
+    if(Copy_Link->TxTimer!=0U)
+    {
+        Copy_Link->TxTimer--;
+        if((Copy_Link->TxTimer==0U) && (Copy_Link->TxState==ISOTP_TX_WAIT_FC))
+        {
+            Copy_Link->TxState=ISOTP_TX_ERROR;
+        }
+    }
+    if(Copy_Link->RxTimer!=0U)
+    {
+        Copy_Link->RxTimer--;
+        if((Copy_Link->RxTimer==0U) && (Copy_Link->RxState==ISOTP_RX_WAIT_CF))
+        {
+            Copy_Link->RxState=ISOTP_RX_IDLE;
+            Copy_Link->RxErrors++;
+        }
+    }
+}
+
+ISOTP_TxState_t ISOTP_Poll(ISOTP_Link_t* Copy_Link)
+{
+    uint8_t Local_Length=0U;
+    /*Our flow control first, the peer is stalled until it gets it*/
+    if(Copy_Link->RxState==ISOTP_RX_SEND_FC)
+    {
+        if(RingBuffer_Free(Copy_Link->RxRing)>=ISOTP_BlockBytes(Copy_Link))
+        {
+            if(ISOTP_SendFlowControl(Copy_Link, ISOTP_FC_CTS)==true)
+            {
+                Copy_Link->RxBlockLeft=Copy_Link->BlockSize;
+                Copy_Link->RxTimer=ISOTP_TIMEOUT_TICKS;
+                Copy_Link->RxState=ISOTP_RX_WAIT_CF;
+            }
+        }
+        else if(Copy_Link->RxTimer==0U)
+        {
+            /*The reader is behind, keep the sender waiting a bit longer*/
+            if(Copy_Link->RxWaits>=ISOTP_MAX_WAITS)
+            {
+                Copy_Link->RxState=ISOTP_RX_SEND_OVFLW;
+            }
+            else if(ISOTP_SendFlowControl(Copy_Link, ISOTP_FC_WAIT)==true)
+            {
+                Copy_Link->RxWaits++;
+                Copy_Link->RxTimer=ISOTP_WAIT_TICKS;
+            }
+        }
+    }
+    if(Copy_Link->RxState==ISOTP_RX_SEND_OVFLW)
+    {
+        if(ISOTP_SendFlowControl(Copy_Link, ISOTP_FC_OVFLW)==true)
+        {
+            Copy_Link->RxState=ISOTP_RX_IDLE;
+            Copy_Link->RxErrors++;
+        }
+    }
+    if(Copy_Link->TxState==ISOTP_TX_SEND_SF)
+    {
+        if(ISOTP_SendFrame(Copy_Link, ISOTP_PCI_SF | (uint8_t)Copy_Link->TxLength, 0U, 1U, Copy_Link->TxData, (uint8_t)Copy_Link->TxLength)==true)
+        {
+            Copy_Link->TxState=ISOTP_TX_DONE;
+        }
+    }
+    else if(Copy_Link->TxState==ISOTP_TX_SEND_FF)
+    {
+        if(ISOTP_SendFrame(Copy_Link, ISOTP_PCI_FF | (uint8_t)(Copy_Link->TxLength>>8), (uint8_t)Copy_Link->TxLength, 2U, Copy_Link->TxData, ISOTP_FF_DATA)==true)
+        {
+            Copy_Link->TxOffset=ISOTP_FF_DATA;
+            Copy_Link->TxTimer=ISOTP_TIMEOUT_TICKS;
+            Copy_Link->TxState=ISOTP_TX_WAIT_FC;
+        }
+    }
+    else if((Copy_Link->TxState==ISOTP_TX_SEND_CF) && (Copy_Link->TxTimer==0U))
+    {
+        Local_Length=((uint16_t)(Copy_Link->TxLength-Copy_Link->TxOffset)>ISOTP_CF_DATA) ? ISOTP_CF_DATA : (uint8_t)(Copy_Link->TxLength-Copy_Link->TxOffset);
+        if(ISOTP_SendFrame(Copy_Link, ISOTP_PCI_CF | Copy_Link->TxSN, 0U, 1U, &Copy_Link->TxData[Copy_Link->TxOffset], Local_Length)==true)
+        {
+            Copy_Link->TxOffset+=Local_Length;
+            Copy_Link->TxSN=(Copy_Link->TxSN+1U) & 0x0FU;
+            /*STmin is the gap to the next consecutive frame*/
+            Copy_Link->TxTimer=Copy_Link->TxSTmin;
+            if(Copy_Link->TxOffset==Copy_Link->TxLength)
+            {
+                Copy_Link->TxTimer=0U;
+                Copy_Link->TxState=ISOTP_TX_DONE;
+            }
+            else if(Copy_Link->TxBlockSize!=0U)
+            {
+                Copy_Link->TxBlockLeft--;
+                if(Copy_Link->TxBlockLeft==0U)
+                {
+                    Copy_Link->TxTimer=ISOTP_TIMEOUT_TICKS;
+                    Copy_Link->TxState=ISOTP_TX_WAIT_FC;
+                }
+            }
+        }
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    return Copy_Link->TxState;
+}
+
+void ISOTP_AbortSend(ISOTP_Link_t* Copy_Link)
+{
+    if((Copy_Link->TxState!=ISOTP_TX_IDLE) && (Copy_Link->TxState!=ISOTP_TX_DONE))
+    {
+        Copy_Link->TxTimer=0U;
+        Copy_Link->TxState=ISOTP_TX_ERROR;
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * IsoTp.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  ISO 15765-2 style segmentation of the host byte stream over 8-byte CAN frames:
+ *  single, first, consecutive and flow control frames with block size / STmin tuning.
+ *  Nothing here touches the hardware, frames leave through the Transmit callback and come
+ *  back with ISOTP_OnFrame, time only moves with ISOTP_OnTick, so the layer runs unchanged
+ *  against a fake bus. All calls of one link must come from the same context.
+ */
+
+#ifndef ISOTP_H_
+#define ISOTP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "RingBuffer.h"
+
+#define ISOTP_FRAME_LEN         8U
+/* Longest message a first frame can announce (12-bit length) */
+#define ISOTP_MAX_MESSAGE       4095U
+#define ISOTP_PADDING           0xCC
+
+/* N_Bs / N_Cr: ticks to wait for the peer flow control / next consecutive frame */
+#define ISOTP_TIMEOUT_TICKS     1000U
+/* While the receive ring has no room for the next block, FC.WAIT is sent at this period,
+ * at most ISOTP_MAX_WAITS times before the reception is dropped with FC.OVFLW */
+#define ISOTP_WAIT_TICKS        100U
+#define ISOTP_MAX_WAITS         10U
+
+typedef enum
+{
+    ISOTP_TX_IDLE=0,
+    ISOTP_TX_SEND_SF,
+    ISOTP_TX_SEND_FF,
+    ISOTP_TX_WAIT_FC,
+    ISOTP_TX_SEND_CF,
+    ISOTP_TX_DONE,
+    ISOTP_TX_ERROR
+}ISOTP_TxState_t;
+
+typedef enum
+{
+    ISOTP_RX_IDLE=0,
+    ISOTP_RX_SEND_FC,
+    ISOTP_RX_SEND_OVFLW,
+    ISOTP_RX_WAIT_CF
+}ISOTP_RxState_t;
+
+/* Queue one 8-byte frame on the bus, returns false if the mailbox is still busy */
+typedef bool (*ISOTP_Transmit_t)(void* Copy_Context,const uint8_t* Copy_Frame);
+
+typedef struct
+{
+    ISOTP_Transmit_t Transmit;
+    void* Context;
+    RingBuffer_t* RxRing;       /* Reassembled bytes, a consecutive block is only granted when it fits */
+    uint8_t BlockSize;          /* Sent to the peer in our flow control, 0 = no limit */
+    uint8_t STmin;              /* Sent to the peer in our flow control, ISO encoding */
+
+    ISOTP_TxState_t TxState;
+    const uint8_t* TxData;
+    uint16_t TxLength;
+    uint16_t TxOffset;
+    uint8_t TxSN;
+    uint8_t TxBlockSize;
+    uint8_t TxBlockLeft;
+    uint8_t TxSTmin;            /* Peer STmin in ticks */
+    uint16_t TxTimer;
+
+    ISOTP_RxState_t RxState;
+    uint16_t RxRemaining;
+    uint8_t RxSN;
+    uint8_t RxBlockLeft;
+    uint8_t RxWaits;
+    uint16_t RxTimer;
+    uint16_t RxErrors;          /* Dropped frames and aborted receptions */
+}ISOTP_Link_t;
+
+void ISOTP_Init(ISOTP_Link_t* Copy_Link,ISOTP_Transmit_t Copy_Transmit,void* Copy_Context,RingBuffer_t* Copy_RxRing,uint8_t Copy_BlockSize,uint8_t Copy_STmin);
+
+/* Start sending a message, Copy_Data must stay untouched until ISOTP_Poll reports DONE or ERROR */
+bool ISOTP_Send(ISOTP_Link_t* Copy_Link,const uint8_t* Copy_Data,uint16_t Copy_Length);
+
+/* Feed a frame received with the link receive identifier */
+void ISOTP_OnFrame(ISOTP_Link_t* Copy_Link,const uint8_t* Copy_Frame,uint8_t Copy_Length);
+
+/* Advance the timers of the link by one tick (1 ms on target) */
+void ISOTP_OnTick(ISOTP_Link_t* Copy_Link);
+
+/* Send whatever frame is due (own flow control, next frame of the message), returns the send state,
+ * DONE and ERROR stay until the next ISOTP_Send */
+ISOTP_TxState_t ISOTP_Poll(ISOTP_Link_t* Copy_Link);
+
+/* Give up the message being sent, for a bus that stopped taking frames */
+void ISOTP_AbortSend(ISOTP_Link_t* Copy_Link);
+
+#endif /* ISOTP_H_ */
@@ -0,0 +1,83 @@
+/*
+ * Loopback.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ */
+#include "Loopback.h"
+
+static RingBuffer_t LOOPBACK_ToTarget;
+static RingBuffer_t LOOPBACK_ToHost;
+static LOOPBACK_Feed_t LOOPBACK_Feed=0;
+
+/*State of the pending LOOPBACK_StartReceive request*/
+static uint8_t* LOOPBACK_RxDest=0;
+static uint16_t LOOPBACK_RxRemaining=0;
+
+void LOOPBACK_Init(uint8_t* Copy_ToTarget,uint16_t Copy_ToTargetSize,uint8_t* Copy_ToHost,uint16_t Copy_ToHostSize,LOOPBACK_Feed_t Copy_Feed)
+{
+    RingBuffer_Init(&LOOPBACK_ToTarget, Copy_ToTarget, Copy_ToTargetSize);
+    RingBuffer_Init(&LOOPBACK_ToHost, Copy_ToHost, Copy_ToHostSize);
+    LOOPBACK_Feed=Copy_Feed;
+    LOOPBACK_RxRemaining=0U;
+}
+
+uint16_t LOOPBACK_HostWrite(const uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    return RingBuffer_Write(&LOOPBACK_ToTarget, Copy_Data, Copy_DataLength);
+}
+
+uint16_t LOOPBACK_HostRead(uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    return RingBuffer_Read(&LOOPBACK_ToHost, Copy_Data, Copy_DataLength);
+}
+
+bool LOOPBACK_IsHostActive(void)
+{
+    if((RingBuffer_Count(&LOOPBACK_ToTarget)==0U) && (LOOPBACK_Feed!=0))
+    {
+        LOOPBACK_Feed();
+    }
+    return (RingBuffer_Count(&LOOPBACK_ToTarget)!=0U);
+}
+
+void LOOPBACK_SendBytes(uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    uint16_t Local_Sent=0U;
+    while(Local_Sent<Copy_DataLength)
+    {
+        Local_Sent+=RingBuffer_Write(&LOOPBACK_ToHost, &Copy_Data[Local_Sent], (uint16_t)(Copy_DataLength-Local_Sent));
+        if((Local_Sent<Copy_DataLength) && (LOOPBACK_Feed!=0))
+        {
+            /*Full ring, the host has to read before the reply goes on*/
+            LOOPBACK_Feed();
+        }
+    }
+}
+
+uint16_t LOOPBACK_ReadBytes(uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    return RingBuffer_Read(&LOOPBACK_ToTarget, Copy_Data, Copy_DataLength);
+}
+
+void LOOPBACK_StartReceive(uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    LOOPBACK_RxDest=Copy_Data;
+    LOOPBACK_RxRemaining=Copy_DataLength;
+}
+
+bool LOOPBACK_IsReceiveComplete(void)
+{
+    uint16_t Local_Received=0U;
+    if(LOOPBACK_RxRemaining!=0U)
+    {
+        Local_Received=RingBuffer_Read(&LOOPBACK_ToTarget, LOOPBACK_RxDest, LOOPBACK_RxRemaining);
+        LOOPBACK_RxDest+=Local_Received;
+        LOOPBACK_RxRemaining-=Local_Received;
+        if((LOOPBACK_RxRemaining!=0U) && (LOOPBACK_Feed!=0))
+        {
+            LOOPBACK_Feed();
+        }
+    }
+    return (LOOPBACK_RxRemaining==0U);
+}
@@ -0,0 +1,43 @@
+/*
+ * Loopback.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Host link kept in memory for off target runs of the command layer (tests, benchmarks).
+ *  The bootloader side has the same calls as the UART and CAN drivers, the caller plays the
+ *  host with LOOPBACK_HostWrite / LOOPBACK_HostRead. When the bootloader waits for bytes that
+ *  aren't there (or for room to reply) the Feed callback runs, so both sides share one thread.
+ *  Nothing here touches the hardware.
+ */
+
+#ifndef LOOPBACK_H_
+#define LOOPBACK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "RingBuffer.h"
+
+/* Called while the bootloader is blocked on the link, it must move some bytes or the wait never ends */
+typedef void (*LOOPBACK_Feed_t)(void);
+
+/* Ring storage is given by the caller, sizes must be powers of two */
+void LOOPBACK_Init(uint8_t* Copy_ToTarget,uint16_t Copy_ToTargetSize,uint8_t* Copy_ToHost,uint16_t Copy_ToHostSize,LOOPBACK_Feed_t Copy_Feed);
+
+/* Host side, non blocking, return the number of bytes queued / copied */
+uint16_t LOOPBACK_HostWrite(const uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+uint16_t LOOPBACK_HostRead(uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+/* Bootloader side */
+bool LOOPBACK_IsHostActive(void);
+
+void LOOPBACK_SendBytes(uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+uint16_t LOOPBACK_ReadBytes(uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+void LOOPBACK_StartReceive(uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+bool LOOPBACK_IsReceiveComplete(void);
+
+#endif /* LOOPBACK_H_ */
@@ -0,0 +1,95 @@
+/*
+ * RingBuffer.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ */
+#include "RingBuffer.h"
+
+void RingBuffer_Init(RingBuffer_t* Copy_Ring,uint8_t* Copy_Storage,uint16_t Copy_Size)
+{
+    Copy_Ring->Buffer=Copy_Storage;
+    Copy_Ring->Mask=Copy_Size-1U;
+    Copy_Ring->Head=0;
+    Copy_Ring->Tail=0;
+}
+
+uint16_t RingBuffer_Count(const RingBuffer_t* Copy_Ring)
+{
+    return (uint16_t)(Copy_Ring->Head-Copy_Ring->Tail);
+}
+
+uint16_t RingBuffer_Free(const RingBuffer_t* Copy_Ring)
+{
+    return (uint16_t)((Copy_Ring->Mask+1U)-RingBuffer_Count(Copy_Ring));
+}
+
+bool RingBuffer_Put(RingBuffer_t* Copy_Ring,uint8_t Copy_Data)
+{
+    bool Local_State=false;
+    uint16_t Local_Head=Copy_Ring->Head;
+    if((uint16_t)(Local_Head-Copy_Ring->Tail)<=Copy_Ring->Mask)
+    {
+        RINGBUFFER_BARRIER();
+        Copy_Ring->Buffer[Local_Head&Copy_Ring->Mask]=Copy_Data;
+        /*Publish the byte only after it is stored*/
+        RINGBUFFER_BARRIER();
+        Copy_Ring->Head=Local_Head+1U;
+        Local_State=true;
+    }
+    return Local_State;
+}
+
+bool RingBuffer_Get(RingBuffer_t* Copy_Ring,uint8_t* Copy_Data)
+{
+    bool Local_State=false;
+    uint16_t Local_Tail=Copy_Ring->Tail;
+    if(Copy_Ring->Head!=Local_Tail)
+    {
+        RINGBUFFER_BARRIER();
+        *Copy_Data=Copy_Ring->Buffer[Local_Tail&Copy_Ring->Mask];
+        /*Release the slot only after it is read*/
+        RINGBUFFER_BARRIER();
+        Copy_Ring->Tail=Local_Tail+1U;
+        Local_State=true;
+    }
+    return Local_State;
+}
+
+uint16_t RingBuffer_Write(RingBuffer_t* Copy_Ring,const uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    uint16_t Local_Counter=0;
+    uint16_t Local_Head=Copy_Ring->Head;
+    uint16_t Local_Free=(uint16_t)((Copy_Ring->Mask+1U)-(uint16_t)(Local_Head-Copy_Ring->Tail));
+    if(Copy_DataLength>Local_Free)
+    {
+        Copy_DataLength=Local_Free;
+    }
+    RINGBUFFER_BARRIER();
+    for( ;Local_Counter<Copy_DataLength;Local_Counter++)
+    {
+        Copy_Ring->Buffer[(uint16_t)(Local_Head+Local_Counter)&Copy_Ring->Mask]=Copy_Data[Local_Counter];
+    }
+    RINGBUFFER_BARRIER();
+    Copy_Ring->Head=Local_Head+Copy_DataLength;
+    return Copy_DataLength;
+}
+
+uint16_t RingBuffer_Read(RingBuffer_t* Copy_Ring,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    uint16_t Local_Counter=0;
+    uint16_t Local_Tail=Copy_Ring->Tail;
+    uint16_t Local_Count=(uint16_t)(Copy_Ring->Head-Local_Tail);
+    if(Copy_DataLength>Local_Count)
+    {
+        Copy_DataLength=Local_Count;
+    }
+    RINGBUFFER_BARRIER();
+    for( ;Local_Counter<Copy_DataLength;Local_Counter++)
+    {
+        Copy_Data[Local_Counter]=Copy_Ring->Buffer[(uint16_t)(Local_Tail+Local_Counter)&Copy_Ring->Mask];
+    }
+    RINGBUFFER_BARRIER();
+    Copy_Ring->Tail=Local_Tail+Copy_DataLength;
+    return Copy_DataLength;
+}
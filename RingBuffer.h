@@ -0,0 +1,49 @@
+/*
+ * RingBuffer.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Lock free single producer / single consumer byte ring.
+ *  The producer only writes Head and the consumer only writes Tail, so an ISR can fill
+ *  the ring while the main loop drains it without disabling interrupts.
+ *  The indices run freely and are masked on access, the size must be a power of two.
+ */
+
+#ifndef RINGBUFFER_H_
+#define RINGBUFFER_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Orders the data accesses with the index that hands them to the other side. Nothing is needed on
+ * the target: the ISR and the main loop run on the one core of the M4, which sees its own accesses
+ * in program order, and the buffer and the indices are volatile, so the compiler keeps that order.
+ * A host running the producer and the consumer on two cores defines it as a fence */
+#ifndef RINGBUFFER_BARRIER
+#define RINGBUFFER_BARRIER()
+#endif
+
+typedef struct
+{
+    volatile uint8_t* Buffer;
+    uint16_t Mask;
+    volatile uint16_t Head;
+    volatile uint16_t Tail;
+}RingBuffer_t;
+
+void RingBuffer_Init(RingBuffer_t* Copy_Ring,uint8_t* Copy_Storage,uint16_t Copy_Size);
+
+uint16_t RingBuffer_Count(const RingBuffer_t* Copy_Ring);
+
+uint16_t RingBuffer_Free(const RingBuffer_t* Copy_Ring);
+
+bool RingBuffer_Put(RingBuffer_t* Copy_Ring,uint8_t Copy_Data);
+
+bool RingBuffer_Get(RingBuffer_t* Copy_Ring,uint8_t* Copy_Data);
+
+uint16_t RingBuffer_Write(RingBuffer_t* Copy_Ring,const uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+uint16_t RingBuffer_Read(RingBuffer_t* Copy_Ring,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+#endif /* RINGBUFFER_H_ */
@@ -0,0 +1,92 @@
+/*
+ * Sim.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Host build of the bootloader: main.c, Bootloader/ and the UART drivers run unchanged on Linux
+ *  against the simulated TM4C123GH6PM of this directory (256 KB flash with its erase / program
+ *  times and FMPRE / FMPPE protection, 32 KB SRAM, the eight UARTs with uDMA receive, NVIC).
+ *  One UART is wired to a pty that Host.py opens like the LaunchPad virtual COM port.
+ *
+ *  Interrupts come from a periodic signal: each tick moves the UARTs forward in time at their
+ *  baud rate and calls the ISR of every pending and enabled interrupt, so the ISRs preempt the
+ *  bootloader the way the NVIC does. A flash operation stalls the CPU: the peripherals and uDMA
+ *  keep moving meanwhile but no ISR runs, a FIFO left without uDMA overruns as on the target.
+ */
+
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SIM_FLASH_SIZE          (256UL*1024UL)
+#define SIM_FLASH_SECTOR_SIZE   1024UL
+/* FMPREn / FMPPEn bit granularity */
+#define SIM_FLASH_PROTECT_BLOCK 2048UL
+#define SIM_FLASH_PROTECT_REGS  4U
+#define SIM_SRAM_SIZE           (32UL*1024UL)
+
+/* PIOSC, the clock after reset */
+#define SIM_CLOCK_DEFAULT       16000000UL
+
+/* Flash timing, the order of the datasheet figures, -e / -p override them */
+#define SIM_ERASE_US_DEFAULT    12000U
+#define SIM_PROGRAM_US_DEFAULT  15U
+
+/* Period of the interrupt signal */
+#define SIM_TICK_US             50U
+
+#define SIM_UART_NUM            8U
+
+typedef struct
+{
+    const char* FlashFile;      /* NULL: erased flash for this run only */
+    const char* Link;           /* Symbolic link created to the pty, NULL: none */
+    uint8_t Uart;               /* UART wired to the pty */
+    uint32_t EraseUs;           /* Sector erase time */
+    uint32_t ProgramUs;         /* Time per programmed word */
+    /* Kept across SysCtlReset, the simulator starts itself again with them */
+    int PtyFd;
+    int FlashFd;
+    int SramFd;
+    uint32_t ResetCause;
+    uint32_t UpdateBitRate;     /* Update mailbox written before the first run, 0: none */
+    bool NoCrystal;             /* The main oscillator doesn't start, no PLL */
+}SIM_Config_t;
+
+extern SIM_Config_t SIM_Config;
+
+/* main() of main.c, renamed by the Makefile */
+int SIM_TargetMain(void);
+
+/* SimCore.c: time, NVIC, register decoding, SRAM, system control, reset */
+void SIM_CoreInit(int Copy_Argc,char** Copy_Argv);
+void SIM_CoreStart(void);
+uint64_t SIM_Now(void);
+/* CPU stalled by the flash, the peripherals go on but no ISR runs */
+void SIM_Stall(uint64_t Copy_Nanoseconds);
+/* Around every simulated peripheral access of the bootloader, no tick runs in between */
+void SIM_Enter(void);
+void SIM_Exit(void);
+bool SIM_IsInterruptAllowed(uint32_t Copy_Interrupt);
+void SIM_RunIsr(void (*Copy_Handler)(void));
+/* Register storage without side effects, for the simulator itself */
+volatile uint32_t* SIM_RegisterSlot(uint32_t Copy_Address);
+void SIM_Report(const char* Copy_Format,...);
+
+/* SimFlash.c */
+void SIM_FlashInit(void);
+/* Runs the commands written to the flash controller since the previous register access */
+void SIM_FlashRegisterAccess(uint32_t Copy_Address);
+void SIM_FlashStats(void);
+
+/* SimUart.c */
+void SIM_UartInit(void);
+void SIM_UartAdvance(uint64_t Copy_Now);
+/* Sends what the transmitter still holds, the UARTs go on shifting after the jump to the application */
+void SIM_UartDrain(void);
+void SIM_UartStats(void);
+
+#endif /* SIM_H_ */
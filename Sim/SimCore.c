@@ -0,0 +1,552 @@
+/*
+ * SimCore.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include "Sim.h"
+#include "Fls.h"
+#include "Prof.h"
+#include "Boot.h"
+#include "Transport.h"
+#include "inc/hw_types.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_sysctl.h"
+#include "inc/hw_nvic.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/systick.h"
+
+/*TM4C123GH6PM identification*/
+#define SIM_DID0_VALUE          0x18050103UL
+#define SIM_DID1_VALUE          0x10A1606EUL
+
+/*Fields of the SysCtlClockSet configuration*/
+#define SIM_OSC_SOURCE_MASK     0x00000030UL
+#define SIM_SYSDIV_USE          0x00400000UL
+#define SIM_SYSDIV_DIV400       0x40000000UL
+
+/*Peripheral registers without behavior, found by address*/
+#define SIM_REGISTER_SLOTS      256U
+
+typedef struct
+{
+    uint32_t Address;
+    uint32_t Value;
+}SIM_Slot_t;
+
+SIM_Config_t SIM_Config=
+{
+    NULL, NULL, 0U, SIM_ERASE_US_DEFAULT, SIM_PROGRAM_US_DEFAULT, -1, -1, -1, SYSCTL_CAUSE_POR, 0U, false
+};
+
+static int SIM_Argc=0;
+static char** SIM_Argv=NULL;
+
+static SIM_Slot_t SIM_Slots[SIM_REGISTER_SLOTS];
+static uint32_t SIM_SlotCount=0U;
+static uint8_t* SIM_Sram=NULL;
+
+static volatile sig_atomic_t SIM_Busy=0;
+static volatile sig_atomic_t SIM_InTick=0;
+static volatile sig_atomic_t SIM_InIsr=0;
+static volatile sig_atomic_t SIM_Stalled=0;
+/*End of the running stall, the sleep may overshoot it*/
+static volatile uint64_t SIM_StallEnd=0U;
+static volatile bool SIM_MasterEnabled=false;
+static volatile bool SIM_IntEnabled[NUM_INTERRUPTS];
+
+static uint32_t SIM_ResetCause=0U;
+/*Start of this run, the reset handler of the target starts CYCCNT from 0*/
+static uint64_t SIM_ResetTime=0U;
+/*CPU clock, the PIOSC after reset. CYCCNT adds the cycles counted at every clock since the reset*/
+static uint32_t SIM_Clock=SIM_CLOCK_DEFAULT;
+static uint64_t SIM_ClockTime=0U;
+static uint64_t SIM_ClockCycles=0U;
+
+/*Moves the peripherals up to now and runs the pending ISRs, never nested*/
+static void SIM_Tick(void)
+{
+    uint64_t Local_Now=SIM_Now();
+    if((SIM_Busy==0) && (SIM_InTick==0))
+    {
+        SIM_InTick=1;
+        /*A tick during a stall stops at its end, the bytes of an overshoot are taken with the ISRs back*/
+        SIM_UartAdvance(((SIM_Stalled!=0) && (Local_Now>SIM_StallEnd)) ? SIM_StallEnd : Local_Now);
+        SIM_InTick=0;
+    }
+    else
+    {
+        /*Picked up by SIM_Exit or the next tick*/
+    }
+}
+
+static void SIM_OnAlarm(int Copy_Signal)
+{
+    int Local_Errno=errno;
+    SIM_Tick();
+    errno=Local_Errno;
+}
+
+static void SIM_OnStop(int Copy_Signal)
+{
+    SIM_FlashStats();
+    SIM_UartStats();
+    _exit(0);
+}
+
+/*The bootloader called into a flash address, that is the application start on the target*/
+static void SIM_OnFault(int Copy_Signal,siginfo_t* Copy_Info,void* Copy_Context)
+{
+    uintptr_t Local_Address=(uintptr_t)Copy_Info->si_addr;
+    bool Local_Jump=(Local_Address<=0xFFFFFFFFUL);
+#if defined(__x86_64__)
+    Local_Jump=Local_Jump && ((uintptr_t)((ucontext_t*)Copy_Context)->uc_mcontext.gregs[REG_RIP]==Local_Address);
+#elif defined(__aarch64__)
+    Local_Jump=Local_Jump && ((uintptr_t)((ucontext_t*)Copy_Context)->uc_mcontext.pc==Local_Address);
+#endif
+    if(Local_Jump==true)
+    {
+        SIM_UartDrain();
+        SIM_Report("jump to 0x%08lX, VTOR 0x%08X", (unsigned long)Local_Address, *SIM_RegisterSlot(NVIC_VTABLE));
+        if(*SIM_Register(BOOT_HANDOFF_CLOCK)!=0U)
+        {
+            /*Written by BOOT_Jump, host time from the start of the run*/
+            SIM_Report("handoff: cycles=%u handoff_us=%.1f", *SIM_Register(BOOT_HANDOFF_CYCLES), (double)*SIM_Register(BOOT_HANDOFF_CYCLES)*1e6/(double)*SIM_Register(BOOT_HANDOFF_CLOCK));
+        }
+        if(*SIM_Register(BOOT_ARGS_MAGIC)==BOOT_ARGS_VALID)
+        {
+            SIM_Report("boot args: link=0x%08X bit_rate=%u reset_cause=0x%X", *SIM_Register(BOOT_ARGS_LINK), *SIM_Register(BOOT_ARGS_BIT_RATE), *SIM_Register(BOOT_ARGS_RESET_CAUSE));
+        }
+        SIM_FlashStats();
+        SIM_UartStats();
+        _exit((Local_Address<SIM_FLASH_SIZE) ? 0 : 1);
+    }
+    else
+    {
+        /*A real crash of the simulator, let it dump*/
+        signal(SIGSEGV, SIG_DFL);
+    }
+}
+
+static void SIM_SramInit(void)
+{
+    if(SIM_Config.SramFd<0)
+    {
+        /*Kept across SysCtlReset like the SRAM of the target, the content is lost on power up only*/
+        SIM_Config.SramFd=memfd_create("blsim-sram", 0);
+        if((SIM_Config.SramFd<0) || (ftruncate(SIM_Config.SramFd, SIM_SRAM_SIZE)!=0))
+        {
+            SIM_Report("SRAM: %s", strerror(errno));
+            exit(1);
+        }
+    }
+    SIM_Sram=mmap(NULL, SIM_SRAM_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, SIM_Config.SramFd, 0);
+    if(SIM_Sram==MAP_FAILED)
+    {
+        SIM_Report("SRAM: %s", strerror(errno));
+        exit(1);
+    }
+}
+
+void SIM_CoreInit(int Copy_Argc,char** Copy_Argv)
+{
+    struct sigaction Local_Action;
+    SIM_Argc=Copy_Argc;
+    SIM_Argv=Copy_Argv;
+    SIM_ResetTime=SIM_Now();
+    SIM_ClockTime=SIM_ResetTime;
+    SIM_ResetCause=SIM_Config.ResetCause;
+    *SIM_RegisterSlot(SYSCTL_DID0)=SIM_DID0_VALUE;
+    *SIM_RegisterSlot(SYSCTL_DID1)=SIM_DID1_VALUE;
+    SIM_SramInit();
+    /*Left from a previous run otherwise, only a jump of this run writes it*/
+    *SIM_Register(BOOT_HANDOFF_CLOCK)=0U;
+    *SIM_Register(BOOT_ARGS_MAGIC)=0U;
+    if(SIM_Config.UpdateBitRate!=0U)
+    {
+        /*What an application does before it resets for an update over the pty UART*/
+        *SIM_Register(BOOT_MAILBOX_ACTION)=BOOT_ACTION_UPDATE;
+        *SIM_Register(BOOT_MAILBOX_LINK)=((uint32_t)TRANSPORT_KIND_UART<<8) | SIM_Config.Uart;
+        *SIM_Register(BOOT_MAILBOX_BIT_RATE)=SIM_Config.UpdateBitRate;
+        *SIM_Register(BOOT_MAILBOX_CHECK)=BOOT_MAILBOX_CHECK_OF(BOOT_ACTION_UPDATE, *SIM_Register(BOOT_MAILBOX_LINK), SIM_Config.UpdateBitRate);
+        *SIM_Register(BOOT_MAILBOX_MAGIC)=BOOT_MAILBOX_VALID;
+        SIM_ResetCause=SYSCTL_CAUSE_SW;
+    }
+    memset(&Local_Action, 0, sizeof(Local_Action));
+    Local_Action.sa_handler=SIM_OnAlarm;
+    Local_Action.sa_flags=SA_RESTART;
+    sigaction(SIGALRM, &Local_Action, NULL);
+    Local_Action.sa_handler=SIM_OnStop;
+    sigaction(SIGINT, &Local_Action, NULL);
+    sigaction(SIGTERM, &Local_Action, NULL);
+    Local_Action.sa_handler=NULL;
+    Local_Action.sa_sigaction=SIM_OnFault;
+    Local_Action.sa_flags=SA_SIGINFO;
+    sigaction(SIGSEGV, &Local_Action, NULL);
+}
+
+void SIM_CoreStart(void)
+{
+    sigset_t Local_Set;
+    struct itimerval Local_Timer;
+    /*exec keeps the mask of SysCtlReset*/
+    sigemptyset(&Local_Set);
+    sigprocmask(SIG_SETMASK, &Local_Set, NULL);
+    Local_Timer.it_interval.tv_sec=0;
+    Local_Timer.it_interval.tv_usec=SIM_TICK_US;
+    Local_Timer.it_value=Local_Timer.it_interval;
+    setitimer(ITIMER_REAL, &Local_Timer, NULL);
+}
+
+uint64_t SIM_Now(void)
+{
+    struct timespec Local_Time;
+    clock_gettime(CLOCK_MONOTONIC, &Local_Time);
+    return ((uint64_t)Local_Time.tv_sec*1000000000ULL)+(uint64_t)Local_Time.tv_nsec;
+}
+
+/*Sleeps until Copy_Deadline, the ticks keep coming meanwhile*/
+static void SIM_SleepUntil(uint64_t Copy_Deadline)
+{
+    struct timespec Local_Time;
+    Local_Time.tv_sec=(time_t)(Copy_Deadline/1000000000ULL);
+    Local_Time.tv_nsec=(long)(Copy_Deadline%1000000000ULL);
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &Local_Time, NULL)==EINTR)
+    {
+        /*Woken by a tick*/
+    }
+}
+
+void SIM_Stall(uint64_t Copy_Nanoseconds)
+{
+    /*The line up to the start of the stall still has the ISRs*/
+    SIM_Tick();
+    SIM_StallEnd=SIM_Now()+Copy_Nanoseconds;
+    SIM_Stalled=1;
+    SIM_SleepUntil(SIM_StallEnd);
+    SIM_Stalled=0;
+    /*The interrupts raised during the stall are taken now*/
+    SIM_Tick();
+}
+
+void SIM_Enter(void)
+{
+    SIM_Busy++;
+}
+
+void SIM_Exit(void)
+{
+    SIM_Busy--;
+    if(SIM_Busy==0)
+    {
+        /*An interrupt enabled or raised by this access is taken right away*/
+        SIM_Tick();
+    }
+}
+
+bool SIM_IsInterruptAllowed(uint32_t Copy_Interrupt)
+{
+    return (SIM_Stalled==0) && (SIM_InIsr==0) && (SIM_MasterEnabled==true) && (Copy_Interrupt<NUM_INTERRUPTS) && (SIM_IntEnabled[Copy_Interrupt]==true);
+}
+
+void SIM_RunIsr(void (*Copy_Handler)(void))
+{
+    SIM_InIsr=1;
+    Copy_Handler();
+    SIM_InIsr=0;
+}
+
+void SIM_Report(const char* Copy_Format,...)
+{
+    va_list Local_Args;
+    va_start(Local_Args, Copy_Format);
+    fputs("blsim: ", stdout);
+    vfprintf(stdout, Copy_Format, Local_Args);
+    fputc('\n', stdout);
+    fflush(stdout);
+    va_end(Local_Args);
+}
+
+volatile uint32_t* SIM_RegisterSlot(uint32_t Copy_Address)
+{
+    static uint32_t Local_Last=0U;
+    volatile uint32_t* Local_Register=NULL;
+    uint32_t Local_Counter=0U;
+    uint32_t Local_Address=Copy_Address & ~3UL;
+    if((Local_Last<SIM_SlotCount) && (SIM_Slots[Local_Last].Address==Local_Address))
+    {
+        Local_Register=&SIM_Slots[Local_Last].Value;
+    }
+    else
+    {
+        for(Local_Counter=0U;(Local_Counter<SIM_SlotCount) && (SIM_Slots[Local_Counter].Address!=Local_Address);Local_Counter++)
+        {
+            /*Linear search, a few dozen registers are used*/
+        }
+        if(Local_Counter==SIM_SlotCount)
+        {
+            if(SIM_SlotCount<SIM_REGISTER_SLOTS)
+            {
+                SIM_Slots[SIM_SlotCount].Address=Local_Address;
+                SIM_Slots[SIM_SlotCount].Value=0U;
+                SIM_SlotCount++;
+            }
+            else
+            {
+                SIM_Report("out of register slots at 0x%08X", Local_Address);
+                exit(1);
+            }
+        }
+        Local_Last=Local_Counter;
+        Local_Register=&SIM_Slots[Local_Counter].Value;
+    }
+    return Local_Register;
+}
+
+volatile uint32_t* SIM_Register(uint32_t Copy_Address)
+{
+    volatile uint32_t* Local_Register=NULL;
+    SIM_FlashRegisterAccess(Copy_Address);
+    if(Copy_Address<SIM_FLASH_SIZE)
+    {
+        Local_Register=(volatile uint32_t*)FLS_MEMORY(Copy_Address & ~3UL);
+    }
+    else if((Copy_Address>=SRAM_BASE) && (Copy_Address<(SRAM_BASE+SIM_SRAM_SIZE)))
+    {
+        Local_Register=(volatile uint32_t*)&SIM_Sram[(Copy_Address-SRAM_BASE) & ~3UL];
+    }
+    else
+    {
+        Local_Register=SIM_RegisterSlot(Copy_Address);
+        if(((Copy_Address & ~3UL)==PROF_DWT_CYCCNT) && ((*SIM_RegisterSlot(PROF_DWT_CTRL) & PROF_DWT_CTRL_CYCCNTENA)!=0U))
+        {
+            /*The cycles of the CPU clock in the time elapsed, stalls included*/
+            *Local_Register=(uint32_t)(SIM_ClockCycles+(((SIM_Now()-SIM_ClockTime)/1000U)*(SIM_Clock/1000000U)));
+        }
+    }
+    return Local_Register;
+}
+
+/*NVIC*/
+bool IntMasterEnable(void)
+{
+    bool Local_WasDisabled=(SIM_MasterEnabled==false);
+    SIM_Enter();
+    SIM_MasterEnabled=true;
+    SIM_Exit();
+    return Local_WasDisabled;
+}
+
+bool IntMasterDisable(void)
+{
+    bool Local_WasDisabled=(SIM_MasterEnabled==false);
+    SIM_MasterEnabled=false;
+    return Local_WasDisabled;
+}
+
+void IntEnable(uint32_t ui32Interrupt)
+{
+    SIM_Enter();
+    if(ui32Interrupt<NUM_INTERRUPTS)
+    {
+        SIM_IntEnabled[ui32Interrupt]=true;
+    }
+    SIM_Exit();
+}
+
+void IntDisable(uint32_t ui32Interrupt)
+{
+    if(ui32Interrupt<NUM_INTERRUPTS)
+    {
+        SIM_IntEnabled[ui32Interrupt]=false;
+    }
+}
+
+void IntPendClear(uint32_t ui32Interrupt)
+{
+    /*The simulated interrupts are levels of the peripherals, nothing latches in the NVIC*/
+}
+
+/*SysTick, only the CAN backend uses it and it isn't simulated*/
+void SysTickPeriodSet(uint32_t ui32Period)
+{
+    /*Do Nothing*/
+}
+
+void SysTickEnable(void)
+{
+    /*Do Nothing*/
+}
+
+void SysTickDisable(void)
+{
+    /*Do Nothing*/
+}
+
+void SysTickIntEnable(void)
+{
+    /*Do Nothing*/
+}
+
+void SysTickIntDisable(void)
+{
+    /*Do Nothing*/
+}
+
+/*System control*/
+void SysCtlPeripheralEnable(uint32_t ui32Peripheral)
+{
+    /*Every peripheral is clocked*/
+}
+
+void SysCtlPeripheralDisable(uint32_t ui32Peripheral)
+{
+    /*Do Nothing*/
+}
+
+void SysCtlPeripheralReset(uint32_t ui32Peripheral)
+{
+    /*Do Nothing*/
+}
+
+bool SysCtlPeripheralReady(uint32_t ui32Peripheral)
+{
+    return true;
+}
+
+/*The switch is immediate, the target waits for the crystal and the PLL lock first.
+ *SYSCTL_RCC_BYPASS alone starts the PLL and keeps the CPU on the oscillator*/
+void SysCtlClockSet(uint32_t ui32Config)
+{
+    bool Local_Pll=((ui32Config & SYSCTL_USE_OSC)!=SYSCTL_USE_OSC);
+    bool Local_Bypass=((ui32Config & SYSCTL_RCC_BYPASS)!=0U);
+    uint32_t Local_Source=SIM_CLOCK_DEFAULT;
+    uint32_t Local_Divider=1U;
+    if(((ui32Config & SIM_OSC_SOURCE_MASK)==SYSCTL_OSC_MAIN) && (SIM_Config.NoCrystal==true))
+    {
+        /*The library gives up on a main oscillator that doesn't start and keeps the clock*/
+        *SIM_RegisterSlot(SYSCTL_PLLSTAT)=0U;
+    }
+    else
+    {
+        /*The main oscillator is the 16 MHz crystal of the LaunchPad, like the PIOSC*/
+        if((Local_Pll==true) && (Local_Bypass==false))
+        {
+            Local_Source=((ui32Config & SIM_SYSDIV_DIV400)!=0U) ? 400000000UL : 200000000UL;
+        }
+        if((ui32Config & SIM_SYSDIV_DIV400)!=0U)
+        {
+            Local_Divider=((ui32Config>>22) & 0x7FU)+1U;
+        }
+        else if((ui32Config & SIM_SYSDIV_USE)!=0U)
+        {
+            Local_Divider=((ui32Config>>23) & 0x3FU)+1U;
+        }
+        *SIM_RegisterSlot(SYSCTL_PLLSTAT)=(Local_Pll==true) ? SYSCTL_PLLSTAT_LOCK : 0U;
+        SIM_Enter();
+        SIM_ClockCycles+=((SIM_Now()-SIM_ClockTime)/1000U)*(SIM_Clock/1000000U);
+        SIM_ClockTime=SIM_Now();
+        SIM_Clock=Local_Source/Local_Divider;
+        SIM_Exit();
+    }
+}
+
+uint32_t SysCtlClockGet(void)
+{
+    return SIM_Clock;
+}
+
+void SysCtlDelay(uint32_t ui32Count)
+{
+    /*3 cycles per loop, interrupts are taken meanwhile*/
+    SIM_SleepUntil(SIM_Now()+(((uint64_t)ui32Count*3ULL*1000000000ULL)/SysCtlClockGet()));
+}
+
+uint32_t SysCtlResetCauseGet(void)
+{
+    return SIM_ResetCause;
+}
+
+void SysCtlResetCauseClear(uint32_t ui32Causes)
+{
+    SIM_ResetCause&=~ui32Causes;
+}
+
+/*Starts the simulator again with the pty, flash and SRAM of this run, the options of the user are kept*/
+void SysCtlReset(void)
+{
+    static char Local_Numbers[4][16];
+    char** Local_Argv=calloc((size_t)SIM_Argc+9U, sizeof(char*));
+    struct itimerval Local_Timer;
+    int Local_Counter=0;
+    int Local_Count=0;
+    memset(&Local_Timer, 0, sizeof(Local_Timer));
+    setitimer(ITIMER_REAL, &Local_Timer, NULL);
+    for(Local_Counter=0;Local_Counter<SIM_Argc;Local_Counter++)
+    {
+        if((Local_Counter>0) && (strlen(SIM_Argv[Local_Counter])==2U) && (strchr("PFSRw", SIM_Argv[Local_Counter][1])!=NULL) && (SIM_Argv[Local_Counter][0]=='-'))
+        {
+            /*Internal option of the previous reset, or the request of the first run, and its value*/
+            Local_Counter++;
+        }
+        else
+        {
+            Local_Argv[Local_Count]=SIM_Argv[Local_Counter];
+            Local_Count++;
+        }
+    }
+    snprintf(Local_Numbers[0], sizeof(Local_Numbers[0]), "%d", SIM_Config.PtyFd);
+    snprintf(Local_Numbers[1], sizeof(Local_Numbers[1]), "%d", SIM_Config.FlashFd);
+    snprintf(Local_Numbers[2], sizeof(Local_Numbers[2]), "%d", SIM_Config.SramFd);
+    snprintf(Local_Numbers[3], sizeof(Local_Numbers[3]), "0x%X", (unsigned)SYSCTL_CAUSE_SW);
+    Local_Argv[Local_Count++]="-P";
+    Local_Argv[Local_Count++]=Local_Numbers[0];
+    Local_Argv[Local_Count++]="-F";
+    Local_Argv[Local_Count++]=Local_Numbers[1];
+    Local_Argv[Local_Count++]="-S";
+    Local_Argv[Local_Count++]=Local_Numbers[2];
+    Local_Argv[Local_Count++]="-R";
+    Local_Argv[Local_Count++]=Local_Numbers[3];
+    Local_Argv[Local_Count]=NULL;
+    SIM_Report("software reset");
+    execv("/proc/self/exe", Local_Argv);
+    SIM_Report("reset: %s", strerror(errno));
+    _exit(1);
+}
+
+/*GPIO, the pins have no behavior*/
+void GPIOPinTypeUART(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    /*Do Nothing*/
+}
+
+void GPIOPinTypeCAN(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    /*Do Nothing*/
+}
+
+void GPIOPinConfigure(uint32_t ui32PinConfig)
+{
+    /*Do Nothing*/
+}
+
+void GPIOPadConfigSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32Strength, uint32_t ui32PinType)
+{
+    /*Do Nothing*/
+}
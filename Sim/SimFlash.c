@@ -0,0 +1,362 @@
+/*
+ * SimFlash.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "Sim.h"
+#include "Fls.h"
+#include "inc/hw_types.h"
+#include "inc/hw_flash.h"
+#include "driverlib/flash.h"
+#include "driverlib/eeprom.h"
+
+/*The image file holds the flash followed by one page with the committed FMPREn / FMPPEn,
+ *the 2 KB of the EEPROM are the second half of that page*/
+#define SIM_FLASH_PAGE          4096UL
+#define SIM_FLASH_FILE_SIZE     (SIM_FLASH_SIZE+SIM_FLASH_PAGE)
+#define SIM_FLASH_BUFFER_WORDS  32U
+#define SIM_EEPROM_OFFSET       (SIM_FLASH_SIZE+2048UL)
+#define SIM_EEPROM_SIZE         2048UL
+/*Word program time of the EEPROM, the order of the datasheet figure*/
+#define SIM_EEPROM_WORD_US      110U
+
+static uint8_t* SIM_Flash=NULL;
+static uint32_t* SIM_FlashSaved=NULL;
+
+static uint32_t SIM_FlashErases=0U;
+static uint32_t SIM_FlashWords=0U;
+static uint32_t SIM_FlashErrors=0U;
+static uint64_t SIM_FlashEraseNs=0U;
+static uint64_t SIM_FlashProgramNs=0U;
+static uint32_t SIM_EepromWords=0U;
+static uint64_t SIM_EepromNs=0U;
+
+static volatile uint32_t* SIM_FlashRegisterFmpre(uint32_t Copy_Index)
+{
+    return SIM_RegisterSlot(FLASH_FMPRE0+(4U*Copy_Index));
+}
+
+static volatile uint32_t* SIM_FlashRegisterFmppe(uint32_t Copy_Index)
+{
+    return SIM_RegisterSlot(FLASH_FMPPE0+(4U*Copy_Index));
+}
+
+static bool SIM_FlashIsProgrammable(uint32_t Copy_Address)
+{
+    uint32_t Local_Block=Copy_Address/SIM_FLASH_PROTECT_BLOCK;
+    return (Copy_Address<SIM_FLASH_SIZE) && (((*SIM_FlashRegisterFmppe(Local_Block/32U)>>(Local_Block%32U)) & 1U)!=0U);
+}
+
+static void SIM_FlashStall(uint64_t* Copy_Total,uint64_t Copy_Nanoseconds)
+{
+    *Copy_Total+=Copy_Nanoseconds;
+    SIM_Stall(Copy_Nanoseconds);
+}
+
+static void SIM_FlashEraseSector(uint32_t Copy_Address)
+{
+    if(SIM_FlashIsProgrammable(Copy_Address)==true)
+    {
+        SIM_FlashStall(&SIM_FlashEraseNs, (uint64_t)SIM_Config.EraseUs*1000ULL);
+        memset(&SIM_Flash[Copy_Address & ~(SIM_FLASH_SECTOR_SIZE-1U)], 0xFF, SIM_FLASH_SECTOR_SIZE);
+        SIM_FlashErases++;
+    }
+    else
+    {
+        *SIM_RegisterSlot(FLASH_FCRIS)|=FLASH_FCRIS_ARIS;
+        SIM_FlashErrors++;
+    }
+}
+
+/*Flash cells only go from 1 to 0, asking for a 0 to 1 change is a program verify error*/
+static void SIM_FlashProgramWord(uint32_t Copy_Address,uint32_t Copy_Data)
+{
+    uint32_t* Local_Word=(uint32_t*)&SIM_Flash[Copy_Address & ~3UL];
+    if(SIM_FlashIsProgrammable(Copy_Address)==true)
+    {
+        if((*Local_Word & Copy_Data)!=Copy_Data)
+        {
+            *SIM_RegisterSlot(FLASH_FCRIS)|=FLASH_FCRIS_PROGRIS;
+            SIM_FlashErrors++;
+        }
+        *Local_Word&=Copy_Data;
+        SIM_FlashWords++;
+    }
+    else
+    {
+        *SIM_RegisterSlot(FLASH_FCRIS)|=FLASH_FCRIS_ARIS;
+        SIM_FlashErrors++;
+    }
+}
+
+/*Programs the valid words of the write buffer in one operation*/
+static void SIM_FlashProgramBuffer(void)
+{
+    uint32_t Local_Valid=*SIM_RegisterSlot(FLASH_FWBVAL);
+    uint32_t Local_Base=*SIM_RegisterSlot(FLASH_FMA) & ~((SIM_FLASH_BUFFER_WORDS*4U)-1U);
+    uint32_t Local_Counter=0U;
+    uint32_t Local_Words=0U;
+    for(Local_Counter=0U;Local_Counter<SIM_FLASH_BUFFER_WORDS;Local_Counter++)
+    {
+        if(((Local_Valid>>Local_Counter) & 1U)!=0U)
+        {
+            SIM_FlashProgramWord(Local_Base+(4U*Local_Counter), *SIM_RegisterSlot(FLASH_FWBN+(4U*Local_Counter)));
+            Local_Words++;
+        }
+    }
+    SIM_FlashStall(&SIM_FlashProgramNs, (uint64_t)Local_Words*SIM_Config.ProgramUs*1000ULL);
+    *SIM_RegisterSlot(FLASH_FWBVAL)=0U;
+}
+
+void SIM_FlashInit(void)
+{
+    struct stat Local_Stat;
+    int Local_Fd=SIM_Config.FlashFd;
+    uint32_t Local_Counter=0U;
+    void* Local_Map=NULL;
+    if(Local_Fd<0)
+    {
+        Local_Fd=(SIM_Config.FlashFile!=NULL) ? open(SIM_Config.FlashFile, O_RDWR | O_CREAT, 0644) : memfd_create("blsim-flash", 0);
+        if((Local_Fd<0) || (fstat(Local_Fd, &Local_Stat)!=0))
+        {
+            SIM_Report("flash: %s", strerror(errno));
+            exit(1);
+        }
+        /*A new or raw image: pad it with erased flash and a page without any protection*/
+        if(Local_Stat.st_size<(off_t)SIM_FLASH_FILE_SIZE)
+        {
+            if(ftruncate(Local_Fd, SIM_FLASH_FILE_SIZE)!=0)
+            {
+                SIM_Report("flash: %s", strerror(errno));
+                exit(1);
+            }
+            Local_Map=mmap(NULL, SIM_FLASH_FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, Local_Fd, 0);
+            if(Local_Map!=MAP_FAILED)
+            {
+                memset((uint8_t*)Local_Map+Local_Stat.st_size, 0xFF, (size_t)(SIM_FLASH_FILE_SIZE-(uint64_t)Local_Stat.st_size));
+                munmap(Local_Map, SIM_FLASH_FILE_SIZE);
+            }
+        }
+        SIM_Config.FlashFd=Local_Fd;
+    }
+    /*The bootloader reads the flash through FLS_MEMORY, so the image has to sit at FLS_MEMORY_BASE*/
+    Local_Map=mmap((void*)FLS_MEMORY_BASE, SIM_FLASH_FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED_NOREPLACE, Local_Fd, 0);
+    if(Local_Map!=(void*)FLS_MEMORY_BASE)
+    {
+        SIM_Report("flash: can't map the image at 0x%lX", (unsigned long)FLS_MEMORY_BASE);
+        exit(1);
+    }
+    SIM_Flash=(uint8_t*)Local_Map;
+    SIM_FlashSaved=(uint32_t*)&SIM_Flash[SIM_FLASH_SIZE];
+    for(Local_Counter=0U;Local_Counter<SIM_FLASH_PROTECT_REGS;Local_Counter++)
+    {
+        *SIM_FlashRegisterFmpre(Local_Counter)=SIM_FlashSaved[Local_Counter];
+        *SIM_FlashRegisterFmppe(Local_Counter)=SIM_FlashSaved[SIM_FLASH_PROTECT_REGS+Local_Counter];
+    }
+}
+
+void SIM_FlashRegisterAccess(uint32_t Copy_Address)
+{
+    volatile uint32_t* Local_Misc=SIM_RegisterSlot(FLASH_FCMISC);
+    volatile uint32_t* Local_Fmc=SIM_RegisterSlot(FLASH_FMC);
+    volatile uint32_t* Local_Fmc2=SIM_RegisterSlot(FLASH_FMC2);
+    uint32_t Local_Counter=0U;
+    /*Writing 1 to an FCMISC bit clears the raw status*/
+    if(*Local_Misc!=0U)
+    {
+        *SIM_RegisterSlot(FLASH_FCRIS)&=~*Local_Misc;
+        *Local_Misc=0U;
+    }
+    /*A command written with the key runs to its end before the next access, the CPU stalls meanwhile*/
+    if((*Local_Fmc & (FLASH_FMC_WRITE | FLASH_FMC_ERASE | FLASH_FMC_MERASE))!=0U)
+    {
+        if((*Local_Fmc & 0xFFFF0000UL)==FLASH_FMC_WRKEY)
+        {
+            if((*Local_Fmc & FLASH_FMC_WRITE)!=0U)
+            {
+                SIM_FlashProgramWord(*SIM_RegisterSlot(FLASH_FMA), *SIM_RegisterSlot(FLASH_FMD));
+                SIM_FlashStall(&SIM_FlashProgramNs, (uint64_t)SIM_Config.ProgramUs*1000ULL);
+            }
+            else if((*Local_Fmc & FLASH_FMC_ERASE)!=0U)
+            {
+                SIM_FlashEraseSector(*SIM_RegisterSlot(FLASH_FMA));
+            }
+            else
+            {
+                for(Local_Counter=0U;Local_Counter<SIM_FLASH_SIZE;Local_Counter+=SIM_FLASH_SECTOR_SIZE)
+                {
+                    SIM_FlashEraseSector(Local_Counter);
+                }
+            }
+        }
+        *Local_Fmc=0U;
+    }
+    if((*Local_Fmc2 & FLASH_FMC2_WRBUF)!=0U)
+    {
+        if((*Local_Fmc2 & 0xFFFF0000UL)==FLASH_FMC2_WRKEY)
+        {
+            SIM_FlashProgramBuffer();
+        }
+        *Local_Fmc2=0U;
+    }
+    if((Copy_Address>=FLASH_FWBN) && (Copy_Address<(FLASH_FWBN+(SIM_FLASH_BUFFER_WORDS*4U))))
+    {
+        *SIM_RegisterSlot(FLASH_FWBVAL)|=1UL<<((Copy_Address-FLASH_FWBN)/4U);
+    }
+}
+
+/*key=value pairs, read back by FlashBench.py*/
+void SIM_FlashStats(void)
+{
+    SIM_Report("flash: erases=%u erase_s=%.6f words=%u program_s=%.6f errors=%u", SIM_FlashErases, (double)SIM_FlashEraseNs/1e9, SIM_FlashWords, (double)SIM_FlashProgramNs/1e9, SIM_FlashErrors);
+    SIM_Report("eeprom: words=%u eeprom_s=%.6f", SIM_EepromWords, (double)SIM_EepromNs/1e9);
+}
+
+/*TivaWare flash API, same register sequence and error flags as the library*/
+int32_t FlashErase(uint32_t ui32Address)
+{
+    int32_t Local_State=-1;
+    if((ui32Address & (SIM_FLASH_SECTOR_SIZE-1U))==0U)
+    {
+        HWREG(FLASH_FCMISC)=FLASH_FCMISC_AMISC | FLASH_FCMISC_VOLTMISC | FLASH_FCMISC_ERMISC;
+        HWREG(FLASH_FMA)=ui32Address;
+        HWREG(FLASH_FMC)=FLASH_FMC_WRKEY | FLASH_FMC_ERASE;
+        while((HWREG(FLASH_FMC) & FLASH_FMC_ERASE)!=0U)
+        {
+            /*Runs on this access*/
+        }
+        Local_State=((HWREG(FLASH_FCRIS) & (FLASH_FCRIS_ARIS | FLASH_FCRIS_VOLTRIS | FLASH_FCRIS_ERRIS))!=0U) ? -1 : 0;
+    }
+    return Local_State;
+}
+
+int32_t FlashProgram(uint32_t* pui32Data, uint32_t ui32Address, uint32_t ui32Count)
+{
+    int32_t Local_State=-1;
+    if(((ui32Address & 3U)==0U) && ((ui32Count & 3U)==0U))
+    {
+        HWREG(FLASH_FCMISC)=FLASH_FCMISC_AMISC | FLASH_FCMISC_VOLTMISC | FLASH_FCMISC_INVDMISC | FLASH_FCMISC_PROGMISC;
+        while(ui32Count!=0U)
+        {
+            HWREG(FLASH_FMA)=ui32Address & ~((SIM_FLASH_BUFFER_WORDS*4U)-1U);
+            do
+            {
+                HWREG(FLASH_FWBN+(ui32Address & ((SIM_FLASH_BUFFER_WORDS*4U)-1U)))=*pui32Data;
+                pui32Data++;
+                ui32Address+=4U;
+                ui32Count-=4U;
+            }while((ui32Count!=0U) && ((ui32Address & ((SIM_FLASH_BUFFER_WORDS*4U)-1U))!=0U));
+            HWREG(FLASH_FMC2)=FLASH_FMC2_WRKEY | FLASH_FMC2_WRBUF;
+            while((HWREG(FLASH_FMC2) & FLASH_FMC2_WRBUF)!=0U)
+            {
+                /*Runs on this access*/
+            }
+        }
+        Local_State=((HWREG(FLASH_FCRIS) & (FLASH_FCRIS_ARIS | FLASH_FCRIS_VOLTRIS | FLASH_FCRIS_INVDRIS | FLASH_FCRIS_PROGRIS))!=0U) ? -1 : 0;
+    }
+    return Local_State;
+}
+
+tFlashProtection FlashProtectGet(uint32_t ui32Address)
+{
+    uint32_t Local_Block=(ui32Address % SIM_FLASH_SIZE)/SIM_FLASH_PROTECT_BLOCK;
+    uint32_t Local_Read=(*SIM_FlashRegisterFmpre(Local_Block/32U)>>(Local_Block%32U)) & 1U;
+    uint32_t Local_Program=(*SIM_FlashRegisterFmppe(Local_Block/32U)>>(Local_Block%32U)) & 1U;
+    tFlashProtection Local_Protection=FlashExecuteOnly;
+    if(Local_Program!=0U)
+    {
+        Local_Protection=FlashReadWrite;
+    }
+    else if(Local_Read!=0U)
+    {
+        Local_Protection=FlashReadOnly;
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    return Local_Protection;
+}
+
+/*Protection bits only go from 1 to 0 until FlashProtectSave commits them*/
+int32_t FlashProtectSet(uint32_t ui32Address, tFlashProtection eProtect)
+{
+    int32_t Local_State=0;
+    uint32_t Local_Block=(ui32Address % SIM_FLASH_SIZE)/SIM_FLASH_PROTECT_BLOCK;
+    uint32_t Local_Bit=1UL<<(Local_Block%32U);
+    volatile uint32_t* Local_Fmpre=SIM_FlashRegisterFmpre(Local_Block/32U);
+    volatile uint32_t* Local_Fmppe=SIM_FlashRegisterFmppe(Local_Block/32U);
+    if((ui32Address & (SIM_FLASH_PROTECT_BLOCK-1U))!=0U)
+    {
+        Local_State=-1;
+    }
+    else if(eProtect==FlashReadWrite)
+    {
+        Local_State=(((*Local_Fmpre & Local_Bit)!=0U) && ((*Local_Fmppe & Local_Bit)!=0U)) ? 0 : -1;
+    }
+    else if(eProtect==FlashReadOnly)
+    {
+        if((*Local_Fmpre & Local_Bit)!=0U)
+        {
+            *Local_Fmppe&=~Local_Bit;
+        }
+        else
+        {
+            Local_State=-1;
+        }
+    }
+    else
+    {
+        *Local_Fmpre&=~Local_Bit;
+        *Local_Fmppe&=~Local_Bit;
+    }
+    return Local_State;
+}
+
+int32_t FlashProtectSave(void)
+{
+    uint32_t Local_Counter=0U;
+    for(Local_Counter=0U;Local_Counter<SIM_FLASH_PROTECT_REGS;Local_Counter++)
+    {
+        SIM_FlashSaved[Local_Counter]=*SIM_FlashRegisterFmpre(Local_Counter);
+        SIM_FlashSaved[SIM_FLASH_PROTECT_REGS+Local_Counter]=*SIM_FlashRegisterFmppe(Local_Counter);
+    }
+    return 0;
+}
+
+/*TivaWare EEPROM API, the content is kept in the image file, a program stalls the CPU as on the target*/
+uint32_t EEPROMInit(void)
+{
+    return EEPROM_INIT_OK;
+}
+
+void EEPROMRead(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count)
+{
+    if(((ui32Address & 3U)==0U) && ((ui32Count & 3U)==0U) && ((ui32Address+ui32Count)<=SIM_EEPROM_SIZE))
+    {
+        memcpy(pui32Data, &SIM_Flash[SIM_EEPROM_OFFSET+ui32Address], ui32Count);
+    }
+}
+
+uint32_t EEPROMProgram(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count)
+{
+    uint32_t Local_State=EEPROM_RC_INVPL;
+    if(((ui32Address & 3U)==0U) && ((ui32Count & 3U)==0U) && ((ui32Address+ui32Count)<=SIM_EEPROM_SIZE))
+    {
+        Local_State=0U;
+        memcpy(&SIM_Flash[SIM_EEPROM_OFFSET+ui32Address], pui32Data, ui32Count);
+        SIM_EepromWords+=ui32Count/4U;
+        SIM_FlashStall(&SIM_EepromNs, (uint64_t)(ui32Count/4U)*SIM_EEPROM_WORD_US*1000ULL);
+    }
+    return Local_State;
+}
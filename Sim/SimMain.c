@@ -0,0 +1,61 @@
+/*
+ * SimMain.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "Sim.h"
+
+/*Prints the usage to Copy_Stream and exits with Copy_Status, stdout and 0 for -h, stderr and 2 otherwise*/
+static void SIM_Usage(const char* Copy_Name,FILE* Copy_Stream,int Copy_Status)
+{
+    fprintf(Copy_Stream,
+            "usage: %s [-h] [-f flash.bin] [-u uart] [-l link] [-e erase_us] [-p word_us] [-w baud] [-x]\n"
+            "  -h  print this help and exit\n"
+            "  -f  flash image, created erased when missing, kept between runs (default: erased, this run only)\n"
+            "  -u  UART wired to the pty, 0 to 7 (default 0, the LaunchPad virtual COM port)\n"
+            "  -l  symbolic link to create to the pty, e.g. /tmp/blsim\n"
+            "  -e  sector erase time in us (default %u)\n"
+            "  -p  program time per word in us (default %u)\n"
+            "  -w  start as after an update request of the application on the pty UART at this baud rate\n"
+            "  -x  no crystal, the PLL doesn't lock and the bootloader runs on its fallback clock\n",
+            Copy_Name, SIM_ERASE_US_DEFAULT, SIM_PROGRAM_US_DEFAULT);
+    exit(Copy_Status);
+}
+
+int main(int argc,char** argv)
+{
+    int Local_Option=0;
+    while((Local_Option=getopt(argc, argv, "hf:u:l:e:p:w:xP:F:S:R:"))!=-1)
+    {
+        switch(Local_Option)
+        {
+        case 'h': SIM_Usage(argv[0], stdout, 0); break;
+        case 'f': SIM_Config.FlashFile=optarg; break;
+        case 'u': SIM_Config.Uart=(uint8_t)strtoul(optarg, NULL, 0); break;
+        case 'l': SIM_Config.Link=optarg; break;
+        case 'e': SIM_Config.EraseUs=(uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'p': SIM_Config.ProgramUs=(uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'w': SIM_Config.UpdateBitRate=(uint32_t)strtoul(optarg, NULL, 0); break;
+        case 'x': SIM_Config.NoCrystal=true; break;
+        /*Internal, passed by SysCtlReset to the next run*/
+        case 'P': SIM_Config.PtyFd=(int)strtol(optarg, NULL, 0); break;
+        case 'F': SIM_Config.FlashFd=(int)strtol(optarg, NULL, 0); break;
+        case 'S': SIM_Config.SramFd=(int)strtol(optarg, NULL, 0); break;
+        case 'R': SIM_Config.ResetCause=(uint32_t)strtoul(optarg, NULL, 0); break;
+        default: SIM_Usage(argv[0], stderr, 2); break;
+        }
+    }
+    if((optind!=argc) || (SIM_Config.Uart>=SIM_UART_NUM))
+    {
+        SIM_Usage(argv[0], stderr, 2);
+    }
+    SIM_CoreInit(argc, argv);
+    SIM_FlashInit();
+    SIM_UartInit();
+    SIM_CoreStart();
+    return SIM_TargetMain();
+}
@@ -0,0 +1,567 @@
+/*
+ * SimUart.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include "Sim.h"
+#include "Uart.h"
+
+#define SIM_UART_FIFO_DEPTH     16U
+/*Bytes read from the pty and not yet on the RX line*/
+#define SIM_UART_WIRE_SIZE      4096U
+#define SIM_UART_NO_CHANNEL     0xFFU
+#define SIM_DMA_CHANNELS        32U
+/*Receive timeout after 32 bit times without a new character*/
+#define SIM_UART_TIMEOUT_BITS   32U
+/*Same TX levels as the RX ones: 2, 4, 8, 12, 14 bytes*/
+static const uint8_t SIM_UartLevels[5]={2U, 4U, 8U, 12U, 14U};
+
+typedef struct
+{
+    uint32_t Base;
+    uint32_t Interrupt;
+    bool Enabled;
+    uint64_t ByteNs;            /* Start, data, parity and stop bits at the configured rate */
+    uint64_t BitNs;
+    uint32_t Levels;            /* IFLS */
+    uint32_t Mask;              /* IM */
+    uint32_t Raw;               /* RIS */
+    uint32_t DmaControl;        /* DMACTL */
+    bool DmaDone;               /* Completion of the receive channel, taken by the UART interrupt */
+    uint16_t RxFifo[SIM_UART_FIFO_DEPTH];   /* Character with its error flags as read from DR */
+    uint8_t RxHead;
+    uint8_t RxCount;
+    uint16_t RxErrors;          /* Error flags of the next character */
+    bool RxTimeoutArmed;
+    uint64_t RxLastAt;
+    uint64_t RxNextAt;          /* End of the character on the line */
+    uint8_t TxFifo[SIM_UART_FIFO_DEPTH];
+    uint8_t TxHead;
+    uint8_t TxCount;
+    bool TxShifting;
+    uint8_t TxShift;
+    uint64_t TxDoneAt;
+    uint8_t Wire[SIM_UART_WIRE_SIZE];       /* Only used by the UART wired to the pty */
+    uint16_t WireHead;
+    uint16_t WireCount;
+    uint32_t RxBytes;
+    uint32_t TxBytes;
+    uint32_t Overruns;
+}SIM_Uart_t;
+
+typedef struct
+{
+    bool Enabled;
+    uint8_t Uart;
+    uint8_t* Dest;
+    uint32_t Remaining;
+}SIM_Dma_t;
+
+static SIM_Uart_t SIM_Uarts[SIM_UART_NUM];
+static SIM_Dma_t SIM_Dma[SIM_DMA_CHANNELS];
+static const uint32_t SIM_UartInterrupts[SIM_UART_NUM]=
+{
+    INT_UART0, INT_UART1, INT_UART2, INT_UART3, INT_UART4, INT_UART5, INT_UART6, INT_UART7
+};
+
+static SIM_Uart_t* SIM_UartFind(uint32_t Copy_Base)
+{
+    uint32_t Local_Index=(Copy_Base-UART0_BASE)>>12;
+    if(Local_Index>=SIM_UART_NUM)
+    {
+        SIM_Report("no UART at 0x%08X", Copy_Base);
+        exit(1);
+    }
+    return &SIM_Uarts[Local_Index];
+}
+
+static uint8_t SIM_UartLevel(uint32_t Copy_Field)
+{
+    return SIM_UartLevels[(Copy_Field<5U) ? Copy_Field : 4U];
+}
+
+static uint8_t SIM_UartRxLevel(const SIM_Uart_t* Copy_Uart)
+{
+    return SIM_UartLevel((Copy_Uart->Levels>>3) & 7U);
+}
+
+/*The TX level counts the free entries: the interrupt comes when the FIFO drops to 16 minus it*/
+static uint8_t SIM_UartTxLevel(const SIM_Uart_t* Copy_Uart)
+{
+    return (uint8_t)(SIM_UART_FIFO_DEPTH-SIM_UartLevel(Copy_Uart->Levels & 7U));
+}
+
+static int32_t SIM_UartPop(SIM_Uart_t* Copy_Uart)
+{
+    int32_t Local_Data=Copy_Uart->RxFifo[Copy_Uart->RxHead];
+    Copy_Uart->RxHead=(uint8_t)((Copy_Uart->RxHead+1U)%SIM_UART_FIFO_DEPTH);
+    Copy_Uart->RxCount--;
+    /*The RX level and the receive timeout are levels of the FIFO*/
+    if(Copy_Uart->RxCount<SIM_UartRxLevel(Copy_Uart))
+    {
+        Copy_Uart->Raw&=~UART_INT_RX;
+    }
+    if(Copy_Uart->RxCount==0U)
+    {
+        Copy_Uart->Raw&=~UART_INT_RT;
+    }
+    return Local_Data;
+}
+
+static void SIM_UartReceive(SIM_Uart_t* Copy_Uart,uint64_t Copy_At)
+{
+    uint8_t Local_Data=Copy_Uart->Wire[Copy_Uart->WireHead];
+    Copy_Uart->WireHead=(uint16_t)((Copy_Uart->WireHead+1U)%SIM_UART_WIRE_SIZE);
+    Copy_Uart->WireCount--;
+    Copy_Uart->RxNextAt=Copy_At+Copy_Uart->ByteNs;
+    if(Copy_Uart->Enabled==false)
+    {
+        /*Nobody listens on a disabled UART*/
+    }
+    else if(Copy_Uart->RxCount==SIM_UART_FIFO_DEPTH)
+    {
+        /*The character is lost, the flag comes with the next one*/
+        Copy_Uart->RxErrors|=UART_DR_OE;
+        Copy_Uart->Raw|=UART_INT_OE;
+        Copy_Uart->Overruns++;
+    }
+    else
+    {
+        Copy_Uart->RxFifo[(Copy_Uart->RxHead+Copy_Uart->RxCount)%SIM_UART_FIFO_DEPTH]=(uint16_t)(Local_Data | Copy_Uart->RxErrors);
+        Copy_Uart->RxErrors=0U;
+        Copy_Uart->RxCount++;
+        Copy_Uart->RxBytes++;
+        Copy_Uart->RxLastAt=Copy_At;
+        Copy_Uart->RxTimeoutArmed=true;
+        if(Copy_Uart->RxCount>=SIM_UartRxLevel(Copy_Uart))
+        {
+            Copy_Uart->Raw|=UART_INT_RX;
+        }
+    }
+}
+
+/*Next FIFO entry to the shift register*/
+static void SIM_UartLoadShift(SIM_Uart_t* Copy_Uart,uint64_t Copy_At)
+{
+    if(Copy_Uart->TxCount!=0U)
+    {
+        Copy_Uart->TxShift=Copy_Uart->TxFifo[Copy_Uart->TxHead];
+        Copy_Uart->TxHead=(uint8_t)((Copy_Uart->TxHead+1U)%SIM_UART_FIFO_DEPTH);
+        Copy_Uart->TxCount--;
+        Copy_Uart->TxShifting=true;
+        Copy_Uart->TxDoneAt=Copy_At+Copy_Uart->ByteNs;
+        if(Copy_Uart->TxCount==SIM_UartTxLevel(Copy_Uart))
+        {
+            Copy_Uart->Raw|=UART_INT_TX;
+        }
+    }
+    else
+    {
+        Copy_Uart->TxShifting=false;
+    }
+}
+
+static void SIM_UartTransmitDone(SIM_Uart_t* Copy_Uart,uint64_t Copy_At)
+{
+    if(((Copy_Uart-SIM_Uarts)==SIM_Config.Uart) && (write(SIM_Config.PtyFd, &Copy_Uart->TxShift, 1U)!=1))
+    {
+        /*The host side is full, the line stays busy for one more character time*/
+        Copy_Uart->TxDoneAt=Copy_At+Copy_Uart->ByteNs;
+    }
+    else
+    {
+        Copy_Uart->TxBytes++;
+        SIM_UartLoadShift(Copy_Uart, Copy_At);
+    }
+}
+
+static void SIM_UartFillWire(SIM_Uart_t* Copy_Uart,uint64_t Copy_Now)
+{
+    uint16_t Local_Tail=(uint16_t)((Copy_Uart->WireHead+Copy_Uart->WireCount)%SIM_UART_WIRE_SIZE);
+    uint16_t Local_Room=(uint16_t)(SIM_UART_WIRE_SIZE-Copy_Uart->WireCount);
+    ssize_t Local_Read=0;
+    if(Local_Tail+Local_Room>SIM_UART_WIRE_SIZE)
+    {
+        Local_Room=(uint16_t)(SIM_UART_WIRE_SIZE-Local_Tail);
+    }
+    Local_Read=read(SIM_Config.PtyFd, &Copy_Uart->Wire[Local_Tail], Local_Room);
+    if(Local_Read>0)
+    {
+        if(Copy_Uart->WireCount==0U)
+        {
+            /*A line that was idle: the first character ends one character time after it showed up*/
+            Copy_Uart->RxNextAt=(Copy_Uart->RxNextAt>Copy_Now) ? Copy_Uart->RxNextAt : (Copy_Now+Copy_Uart->ByteNs);
+        }
+        Copy_Uart->WireCount+=(uint16_t)Local_Read;
+    }
+}
+
+/*uDMA requests of the UART and its interrupt line*/
+static void SIM_UartService(SIM_Uart_t* Copy_Uart)
+{
+    uint8_t Local_Counter=0U;
+    uint8_t Local_Index=(uint8_t)(Copy_Uart-SIM_Uarts);
+    SIM_Dma_t* Local_Dma=NULL;
+    if((Copy_Uart->DmaControl & UART_DMA_RX)!=0U)
+    {
+        for(Local_Counter=0U;Local_Counter<SIM_DMA_CHANNELS;Local_Counter++)
+        {
+            Local_Dma=&SIM_Dma[Local_Counter];
+            if((Local_Dma->Enabled==true) && (Local_Dma->Uart==Local_Index))
+            {
+                while((Copy_Uart->RxCount!=0U) && (Local_Dma->Remaining!=0U))
+                {
+                    *Local_Dma->Dest=(uint8_t)SIM_UartPop(Copy_Uart);
+                    Local_Dma->Dest++;
+                    Local_Dma->Remaining--;
+                }
+                if(Local_Dma->Remaining==0U)
+                {
+                    /*Basic mode ends by disabling the channel and interrupting the peripheral*/
+                    Local_Dma->Enabled=false;
+                    Copy_Uart->DmaDone=true;
+                }
+            }
+        }
+    }
+    if((((Copy_Uart->Raw & Copy_Uart->Mask)!=0U) || (Copy_Uart->DmaDone==true)) && (SIM_IsInterruptAllowed(Copy_Uart->Interrupt)==true))
+    {
+        Copy_Uart->DmaDone=false;
+        SIM_RunIsr(UART_IntHandler);
+    }
+}
+
+static void SIM_UartStep(SIM_Uart_t* Copy_Uart,uint64_t Copy_Now)
+{
+    bool Local_Wired=((Copy_Uart-SIM_Uarts)==SIM_Config.Uart);
+    uint64_t Local_RxAt=0U;
+    uint64_t Local_TxAt=0U;
+    bool Local_Done=false;
+    if(Local_Wired==true)
+    {
+        SIM_UartFillWire(Copy_Uart, Copy_Now);
+    }
+    /*Line events in time order, the uDMA and the ISR see the FIFO as it was at each of them*/
+    while(Local_Done==false)
+    {
+        Local_RxAt=(Copy_Uart->WireCount!=0U) ? Copy_Uart->RxNextAt : UINT64_MAX;
+        Local_TxAt=(Copy_Uart->TxShifting==true) ? Copy_Uart->TxDoneAt : UINT64_MAX;
+        if((Local_RxAt<=Copy_Now) && (Local_RxAt<=Local_TxAt))
+        {
+            SIM_UartReceive(Copy_Uart, Local_RxAt);
+            if((Local_Wired==true) && (Copy_Uart->WireCount==0U))
+            {
+                SIM_UartFillWire(Copy_Uart, Copy_Now);
+            }
+            SIM_UartService(Copy_Uart);
+        }
+        else if(Local_TxAt<=Copy_Now)
+        {
+            SIM_UartTransmitDone(Copy_Uart, Local_TxAt);
+            SIM_UartService(Copy_Uart);
+        }
+        else
+        {
+            Local_Done=true;
+        }
+    }
+    if((Copy_Uart->RxTimeoutArmed==true) && (Copy_Uart->RxCount!=0U) && (Copy_Now>=(Copy_Uart->RxLastAt+(SIM_UART_TIMEOUT_BITS*Copy_Uart->BitNs))))
+    {
+        Copy_Uart->Raw|=UART_INT_RT;
+        Copy_Uart->RxTimeoutArmed=false;
+    }
+    SIM_UartService(Copy_Uart);
+}
+
+void SIM_UartInit(void)
+{
+    struct termios Local_Termios;
+    uint8_t Local_Counter=0U;
+    int Local_Slave=-1;
+    const char* Local_Name=NULL;
+    for(Local_Counter=0U;Local_Counter<SIM_UART_NUM;Local_Counter++)
+    {
+        SIM_Uarts[Local_Counter].Base=UART0_BASE+((uint32_t)Local_Counter<<12);
+        SIM_Uarts[Local_Counter].Interrupt=SIM_UartInterrupts[Local_Counter];
+        SIM_Uarts[Local_Counter].BitNs=1000000000ULL/UART_DEFAULT_BAUD;
+        SIM_Uarts[Local_Counter].ByteNs=10U*SIM_Uarts[Local_Counter].BitNs;
+        SIM_Uarts[Local_Counter].Levels=UART_FIFO_TX4_8 | UART_FIFO_RX4_8;
+    }
+    for(Local_Counter=0U;Local_Counter<SIM_DMA_CHANNELS;Local_Counter++)
+    {
+        SIM_Dma[Local_Counter].Uart=SIM_UART_NO_CHANNEL;
+    }
+    if(SIM_Config.PtyFd<0)
+    {
+        SIM_Config.PtyFd=posix_openpt(O_RDWR | O_NOCTTY);
+        if((SIM_Config.PtyFd<0) || (grantpt(SIM_Config.PtyFd)!=0) || (unlockpt(SIM_Config.PtyFd)!=0))
+        {
+            SIM_Report("pty: %s", strerror(errno));
+            exit(1);
+        }
+        if(SIM_Config.Link!=NULL)
+        {
+            unlink(SIM_Config.Link);
+            if(symlink(ptsname(SIM_Config.PtyFd), SIM_Config.Link)!=0)
+            {
+                SIM_Report("link %s: %s", SIM_Config.Link, strerror(errno));
+            }
+        }
+    }
+    Local_Name=ptsname(SIM_Config.PtyFd);
+    /*Raw bytes in both directions, and an open slave so the master never reads EIO between two host sessions*/
+    Local_Slave=open(Local_Name, O_RDWR | O_NOCTTY | O_CLOEXEC);
+    if((Local_Slave>=0) && (tcgetattr(Local_Slave, &Local_Termios)==0))
+    {
+        cfmakeraw(&Local_Termios);
+        tcsetattr(Local_Slave, TCSANOW, &Local_Termios);
+    }
+    fcntl(SIM_Config.PtyFd, F_SETFL, fcntl(SIM_Config.PtyFd, F_GETFL) | O_NONBLOCK);
+    SIM_Report("UART%u on %s", SIM_Config.Uart, Local_Name);
+}
+
+void SIM_UartAdvance(uint64_t Copy_Now)
+{
+    uint8_t Local_Counter=0U;
+    for(Local_Counter=0U;Local_Counter<SIM_UART_NUM;Local_Counter++)
+    {
+        SIM_UartStep(&SIM_Uarts[Local_Counter], Copy_Now);
+    }
+}
+
+void SIM_UartDrain(void)
+{
+    SIM_Uart_t* Local_Uart=&SIM_Uarts[SIM_Config.Uart];
+    while(Local_Uart->TxShifting==true)
+    {
+        SIM_UartTransmitDone(Local_Uart, Local_Uart->TxDoneAt);
+    }
+}
+
+void SIM_UartStats(void)
+{
+    uint8_t Local_Counter=0U;
+    for(Local_Counter=0U;Local_Counter<SIM_UART_NUM;Local_Counter++)
+    {
+        if((SIM_Uarts[Local_Counter].RxBytes!=0U) || (SIM_Uarts[Local_Counter].TxBytes!=0U) || (SIM_Uarts[Local_Counter].Overruns!=0U))
+        {
+            SIM_Report("UART%u: rx=%u tx=%u overruns=%u", Local_Counter, SIM_Uarts[Local_Counter].RxBytes, SIM_Uarts[Local_Counter].TxBytes, SIM_Uarts[Local_Counter].Overruns);
+        }
+    }
+}
+
+/*TivaWare UART API*/
+void UARTEnable(uint32_t ui32Base)
+{
+    SIM_Enter();
+    SIM_UartFind(ui32Base)->Enabled=true;
+    SIM_Exit();
+}
+
+/*As the library: waits for the end of the transmission*/
+void UARTDisable(uint32_t ui32Base)
+{
+    while(UARTBusy(ui32Base)==true)
+    {
+        /*Drained by the ticks*/
+    }
+    SIM_UartFind(ui32Base)->Enabled=false;
+}
+
+void UARTConfigSetExpClk(uint32_t ui32Base, uint32_t ui32UARTClk, uint32_t ui32Baud, uint32_t ui32Config)
+{
+    SIM_Uart_t* Local_Uart=SIM_UartFind(ui32Base);
+    uint32_t Local_Bits=1U+5U+((ui32Config & UART_CONFIG_WLEN_MASK)>>5)+(((ui32Config & UART_CONFIG_STOP_MASK)!=0U) ? 2U : 1U)+(((ui32Config & UART_CONFIG_PAR_MASK)!=0U) ? 1U : 0U);
+    UARTDisable(ui32Base);
+    SIM_Enter();
+    Local_Uart->BitNs=1000000000ULL/ui32Baud;
+    Local_Uart->ByteNs=((uint64_t)Local_Bits*1000000000ULL)/ui32Baud;
+    SIM_Exit();
+    UARTEnable(ui32Base);
+}
+
+void UARTFIFOLevelSet(uint32_t ui32Base, uint32_t ui32TxLevel, uint32_t ui32RxLevel)
+{
+    SIM_Enter();
+    SIM_UartFind(ui32Base)->Levels=ui32TxLevel | ui32RxLevel;
+    SIM_Exit();
+}
+
+bool UARTCharsAvail(uint32_t ui32Base)
+{
+    bool Local_State=false;
+    SIM_Enter();
+    Local_State=(SIM_UartFind(ui32Base)->RxCount!=0U);
+    SIM_Exit();
+    return Local_State;
+}
+
+bool UARTSpaceAvail(uint32_t ui32Base)
+{
+    bool Local_State=false;
+    SIM_Enter();
+    Local_State=(SIM_UartFind(ui32Base)->TxCount<SIM_UART_FIFO_DEPTH);
+    SIM_Exit();
+    return Local_State;
+}
+
+int32_t UARTCharGetNonBlocking(uint32_t ui32Base)
+{
+    int32_t Local_Data=-1;
+    SIM_Uart_t* Local_Uart=SIM_UartFind(ui32Base);
+    SIM_Enter();
+    if(Local_Uart->RxCount!=0U)
+    {
+        Local_Data=SIM_UartPop(Local_Uart);
+    }
+    SIM_Exit();
+    return Local_Data;
+}
+
+int32_t UARTCharGet(uint32_t ui32Base)
+{
+    while(UARTCharsAvail(ui32Base)==false)
+    {
+        /*Filled by the ticks*/
+    }
+    return UARTCharGetNonBlocking(ui32Base);
+}
+
+bool UARTCharPutNonBlocking(uint32_t ui32Base, unsigned char ucData)
+{
+    bool Local_State=false;
+    SIM_Uart_t* Local_Uart=SIM_UartFind(ui32Base);
+    SIM_Enter();
+    if(Local_Uart->TxCount<SIM_UART_FIFO_DEPTH)
+    {
+        Local_Uart->TxFifo[(Local_Uart->TxHead+Local_Uart->TxCount)%SIM_UART_FIFO_DEPTH]=ucData;
+        Local_Uart->TxCount++;
+        if(Local_Uart->TxShifting==false)
+        {
+            SIM_UartLoadShift(Local_Uart, SIM_Now());
+        }
+        Local_State=true;
+    }
+    SIM_Exit();
+    return Local_State;
+}
+
+void UARTCharPut(uint32_t ui32Base, unsigned char ucData)
+{
+    while(UARTCharPutNonBlocking(ui32Base, ucData)==false)
+    {
+        /*Drained by the ticks*/
+    }
+}
+
+bool UARTBusy(uint32_t ui32Base)
+{
+    bool Local_State=false;
+    SIM_Uart_t* Local_Uart=SIM_UartFind(ui32Base);
+    SIM_Enter();
+    Local_State=(Local_Uart->TxShifting==true) || (Local_Uart->TxCount!=0U);
+    SIM_Exit();
+    return Local_State;
+}
+
+void UARTIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    SIM_Enter();
+    SIM_UartFind(ui32Base)->Mask|=ui32IntFlags;
+    SIM_Exit();
+}
+
+void UARTIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    SIM_UartFind(ui32Base)->Mask&=~ui32IntFlags;
+}
+
+uint32_t UARTIntStatus(uint32_t ui32Base, bool bMasked)
+{
+    SIM_Uart_t* Local_Uart=SIM_UartFind(ui32Base);
+    return (bMasked==true) ? (Local_Uart->Raw & Local_Uart->Mask) : Local_Uart->Raw;
+}
+
+void UARTIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    SIM_UartFind(ui32Base)->Raw&=~ui32IntFlags;
+}
+
+void UARTDMAEnable(uint32_t ui32Base, uint32_t ui32DMAFlags)
+{
+    SIM_Enter();
+    SIM_UartFind(ui32Base)->DmaControl|=ui32DMAFlags;
+    SIM_Exit();
+}
+
+void UARTDMADisable(uint32_t ui32Base, uint32_t ui32DMAFlags)
+{
+    SIM_UartFind(ui32Base)->DmaControl&=~ui32DMAFlags;
+}
+
+/*uDMA, basic mode transfers from a UART data register to memory*/
+void uDMAEnable(void)
+{
+    /*Do Nothing*/
+}
+
+void uDMAControlBaseSet(void* pControlTable)
+{
+    /*The channel state lives in the simulator*/
+}
+
+void uDMAChannelAssign(uint32_t ui32Mapping)
+{
+    /*Do Nothing*/
+}
+
+void uDMAChannelAttributeDisable(uint32_t ui32ChannelNum, uint32_t ui32Attr)
+{
+    /*Do Nothing*/
+}
+
+void uDMAChannelControlSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Control)
+{
+    /*Byte reads from a fixed source into an incrementing buffer, the only mode simulated*/
+}
+
+void uDMAChannelTransferSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Mode, void* pvSrcAddr, void* pvDstAddr, uint32_t ui32TransferSize)
+{
+    SIM_Dma_t* Local_Dma=&SIM_Dma[ui32ChannelStructIndex & 0x1FU];
+    SIM_Enter();
+    Local_Dma->Uart=(uint8_t)(SIM_UartFind((uint32_t)(uintptr_t)pvSrcAddr & ~0xFFFUL)-SIM_Uarts);
+    Local_Dma->Dest=(uint8_t*)pvDstAddr;
+    Local_Dma->Remaining=ui32TransferSize;
+    SIM_Exit();
+}
+
+void uDMAChannelEnable(uint32_t ui32ChannelNum)
+{
+    SIM_Enter();
+    SIM_Dma[ui32ChannelNum & 0x1FU].Enabled=true;
+    SIM_Exit();
+}
+
+void uDMAChannelDisable(uint32_t ui32ChannelNum)
+{
+    SIM_Dma[ui32ChannelNum & 0x1FU].Enabled=false;
+}
+
+bool uDMAChannelIsEnabled(uint32_t ui32ChannelNum)
+{
+    return SIM_Dma[ui32ChannelNum & 0x1FU].Enabled;
+}
+
+void uDMAIntClear(uint32_t ui32ChanMask)
+{
+    /*Do Nothing*/
+}
@@ -0,0 +1,82 @@
+''' BL_SET_BAUD against the simulator: Host.Negotiate_Baud_Rate on one side, the switch / ping / fallback
+    of BL_SetBaudRate on the other, over the pty of the simulated UART0. The pty carries the bytes at any
+    rate, the rate the bootloader really runs at shows in the time a long reply takes on the line:
+      a rate the UART clock can't generate is refused and the link stays at 115200
+      a lost ping makes both sides fall back to 115200 once the bootloader timeout expires
+      a ping that gets through moves both sides to 921600
+    Run by make -C Sim test, needs pyserial as Host.py does.
+    Usage: python3 BaudTest.py <build directory> '''
+import sys
+import os
+import signal
+import tempfile
+from time import monotonic
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..'))
+import serial
+import Host
+import FlashBench
+
+''' GET_SECTOR_CRC of 4 x 60 sectors, 4 replies of 243 bytes '''
+REPLY_FIRST_SECTOR           = 0
+REPLY_SECTORS                = 4 * Host.BL_SECTOR_CRC_MAX
+REPLY_BYTES                  = 4 * (2 + 1 + 4 * Host.BL_SECTOR_CRC_MAX)
+TEST_TIMEOUT_S               = 60
+
+Failures = 0
+
+def Check(Condition, Message):
+    global Failures
+    if(not Condition):
+        Failures = Failures + 1
+        print("  check failed:", Message)
+
+def Reply_Baud(BL_Host_Buffer):
+    ''' Rate of the bootloader UART measured on the sector CRC replies '''
+    Start_Time = monotonic()
+    Sector_CRCs = Host.Read_Sector_CRCs(BL_Host_Buffer, REPLY_FIRST_SECTOR, REPLY_SECTORS)
+    Check((Sector_CRCs is not None) and (len(Sector_CRCs) == REPLY_SECTORS), "sector CRC replies")
+    return REPLY_BYTES * FlashBench.UART_FRAME_BITS / (monotonic() - Start_Time)
+
+def On_Timeout(Signal, Frame):
+    raise TimeoutError("no reply from the simulator")
+
+def Run_Test(Flash_File):
+    BL_Host_Buffer = [0] * Host.BL_HOST_BUFFER_LEN
+    Simulator, Port = FlashBench.Start_Simulator(Flash_File, 0, 0)
+    try:
+        Host.Serial_Port_Obj = serial.Serial(Port, Host.BL_DEFAULT_BAUD, timeout = 2)
+        Host.verbose_mode = 0
+        ''' The host side of the time goes to the rate as well, the checks leave it a wide margin '''
+        Start_Baud = Reply_Baud(BL_Host_Buffer)
+        Check(Start_Baud < 1.3 * Host.BL_DEFAULT_BAUD, "%d baud at start" % Start_Baud)
+        Check(not Host.Negotiate_Baud_Rate(BL_Host_Buffer, 20000000), "20 Mbaud accepted")
+        Baud = Reply_Baud(BL_Host_Buffer)
+        Check(Baud < 1.3 * Host.BL_DEFAULT_BAUD, "%d baud after the refused rate" % Baud)
+        ''' The bootloader drops any byte but the ping while it waits at the new rate '''
+        Ping = Host.BL_BAUD_PING
+        Host.BL_BAUD_PING = 0x00
+        Check(not Host.Negotiate_Baud_Rate(BL_Host_Buffer, 921600), "switch confirmed without the ping")
+        Host.BL_BAUD_PING = Ping
+        Fallback_Baud = Reply_Baud(BL_Host_Buffer)
+        Check(Fallback_Baud < 1.3 * Host.BL_DEFAULT_BAUD, "%d baud after the fallback" % Fallback_Baud)
+        Check(Host.Negotiate_Baud_Rate(BL_Host_Buffer, 921600), "921600 baud refused")
+        Baud = Reply_Baud(BL_Host_Buffer)
+        Check(Baud > 2 * Host.BL_DEFAULT_BAUD, "%d baud after the switch" % Baud)
+        print("  replies at %d baud at start, %d after the fallback, %d after the switch" % (Start_Baud, Fallback_Baud, Baud))
+        Host.Serial_Port_Obj.close()
+    finally:
+        FlashBench.Stop_Simulator(Simulator)
+
+if(__name__ == "__main__"):
+    if(len(sys.argv) != 2):
+        sys.exit("Usage: python3 BaudTest.py <build directory>")
+    FlashBench.SIM_PATH = os.path.join(sys.argv[1], 'blsim')
+    signal.signal(signal.SIGALRM, On_Timeout)
+    signal.alarm(TEST_TIMEOUT_S)
+    with tempfile.TemporaryDirectory() as Directory:
+        Flash_File = os.path.join(Directory, 'flash.bin')
+        with open(Flash_File, 'wb') as File:
+            File.write(b'\xff' * (256 * 1024))
+        Run_Test(Flash_File)
+    print("BaudTest: %s" % ("passed" if Failures == 0 else "FAILED"))
+    sys.exit(0 if Failures == 0 else 1)
@@ -0,0 +1,59 @@
+/*
+ * Crc32Bench.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Throughput of every CRC32_ENGINE over a 1 KB packet and a 64 KB image, on the host CPU.
+ *  The ratios between the engines are the interesting part, the M4 has no cache and a
+ *  slower memory, the absolute numbers of the target come from BL_GET_STATS.
+ */
+#include "Test.h"
+#include "Crc32Engines.h"
+
+#define CRC32_BENCH_SIZE    (64UL*1024UL)
+#define CRC32_BENCH_TIME    0.2
+
+static uint8_t CRC32_BenchData[CRC32_BENCH_SIZE];
+/* Keeps the calculations from being optimized away */
+static volatile uint32_t CRC32_BenchSink=0U;
+
+/* MB/s of one engine over Copy_Length bytes */
+static double CRC32_Measure(const CRC32_Engine_t* Copy_Engine,uint32_t Copy_Length)
+{
+    uint32_t Local_Rounds=0U;
+    double Local_Start=TEST_Seconds();
+    double Local_Elapsed=0.0;
+    do
+    {
+        CRC32_BenchSink^=Copy_Engine->Calculate(CRC32_BenchData, Copy_Length);
+        Local_Rounds++;
+        Local_Elapsed=TEST_Seconds()-Local_Start;
+    }while(Local_Elapsed<CRC32_BENCH_TIME);
+    return ((double)Copy_Length*(double)Local_Rounds)/(Local_Elapsed*1e6);
+}
+
+int main(void)
+{
+    uint32_t Local_Seed=1U;
+    uint32_t Local_Counter=0U;
+    double Local_Packet=0.0;
+    double Local_Image=0.0;
+    double Local_Bitwise=0.0;
+    for(Local_Counter=0U;Local_Counter<CRC32_BENCH_SIZE;Local_Counter++)
+    {
+        CRC32_BenchData[Local_Counter]=(uint8_t)TEST_Random(&Local_Seed);
+    }
+    printf("%-12s %12s %12s %10s\n", "engine", "1KB MB/s", "64KB MB/s", "x bitwise");
+    for(Local_Counter=0U;Local_Counter<CRC32_ENGINES_NUM;Local_Counter++)
+    {
+        Local_Packet=CRC32_Measure(&CRC32_Engines[Local_Counter], 1024U);
+        Local_Image=CRC32_Measure(&CRC32_Engines[Local_Counter], CRC32_BENCH_SIZE);
+        if(Local_Counter==0U)
+        {
+            Local_Bitwise=Local_Image;
+        }
+        printf("%-12s %12.1f %12.1f %10.1f\n", CRC32_Engines[Local_Counter].Name, Local_Packet, Local_Image, Local_Image/Local_Bitwise);
+    }
+    return 0;
+}
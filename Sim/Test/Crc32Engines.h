@@ -0,0 +1,43 @@
+/*
+ * Crc32Engines.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Bootloader/Crc32.c is built once per CRC32_ENGINE for the CRC test and benchmark,
+ *  CRC32_Update / CRC32_Calculate of engine n are renamed CRC32_Update_n / CRC32_Calculate_n.
+ */
+
+#ifndef CRC32ENGINES_H_
+#define CRC32ENGINES_H_
+
+#include "Crc32.h"
+
+#define CRC32_ENGINES_NUM   4U
+
+uint32_t CRC32_Update_1(uint32_t Copy_CRC,const uint8_t* Copy_Buffer,uint32_t Copy_Length);
+uint32_t CRC32_Update_2(uint32_t Copy_CRC,const uint8_t* Copy_Buffer,uint32_t Copy_Length);
+uint32_t CRC32_Update_3(uint32_t Copy_CRC,const uint8_t* Copy_Buffer,uint32_t Copy_Length);
+uint32_t CRC32_Update_4(uint32_t Copy_CRC,const uint8_t* Copy_Buffer,uint32_t Copy_Length);
+uint32_t CRC32_Calculate_1(const uint8_t* Copy_Buffer,uint32_t Copy_Length);
+uint32_t CRC32_Calculate_2(const uint8_t* Copy_Buffer,uint32_t Copy_Length);
+uint32_t CRC32_Calculate_3(const uint8_t* Copy_Buffer,uint32_t Copy_Length);
+uint32_t CRC32_Calculate_4(const uint8_t* Copy_Buffer,uint32_t Copy_Length);
+
+typedef struct
+{
+    const char* Name;
+    uint32_t (*Update)(uint32_t Copy_CRC,const uint8_t* Copy_Buffer,uint32_t Copy_Length);
+    uint32_t (*Calculate)(const uint8_t* Copy_Buffer,uint32_t Copy_Length);
+}CRC32_Engine_t;
+
+/* In CRC32_ENGINE order */
+static const CRC32_Engine_t CRC32_Engines[CRC32_ENGINES_NUM]=
+{
+    {"bitwise",     CRC32_Update_1, CRC32_Calculate_1},
+    {"table",       CRC32_Update_2, CRC32_Calculate_2},
+    {"slice-by-4",  CRC32_Update_3, CRC32_Calculate_3},
+    {"slice-by-8",  CRC32_Update_4, CRC32_Calculate_4}
+};
+
+#endif /* CRC32ENGINES_H_ */
@@ -0,0 +1,89 @@
+/*
+ * Crc32Test.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Every CRC32_ENGINE against the bit by bit definition of the CRC of the bootloader: each byte is
+ *  XORed into the low byte of the register, then the register is shifted 32 times. All the lengths
+ *  up to CRC32_TEST_LENGTH at every alignment of a word, and the same data split in two and three
+ *  CRC32_Update calls, as the bootloader does for a packet received in chunks.
+ */
+#include <string.h>
+#include "Test.h"
+#include "Crc32Engines.h"
+
+#define CRC32_TEST_LENGTH   300U
+#define CRC32_TEST_SPLITS   2000U
+
+static uint8_t CRC32_TestData[CRC32_TEST_LENGTH+8U];
+
+static uint32_t CRC32_Reference(uint32_t Copy_CRC,const uint8_t* Copy_Buffer,uint32_t Copy_Length)
+{
+    uint32_t Local_Counter=0U;
+    uint8_t Local_Bit=0U;
+    for(Local_Counter=0U;Local_Counter<Copy_Length;Local_Counter++)
+    {
+        Copy_CRC^=Copy_Buffer[Local_Counter];
+        for(Local_Bit=0U;Local_Bit<32U;Local_Bit++)
+        {
+            Copy_CRC=((Copy_CRC & 0x80000000UL)!=0U) ? ((Copy_CRC<<1)^CRC32_POLYNOMIAL) : (Copy_CRC<<1);
+        }
+    }
+    return Copy_CRC;
+}
+
+int main(void)
+{
+    uint32_t Local_Seed=1U;
+    uint32_t Local_Engine=0U;
+    uint32_t Local_Length=0U;
+    uint32_t Local_Offset=0U;
+    uint32_t Local_Split=0U;
+    uint32_t Local_First=0U;
+    uint32_t Local_Second=0U;
+    uint32_t Local_Expected=0U;
+    uint32_t Local_CRC=0U;
+    for(Local_Offset=0U;Local_Offset<sizeof(CRC32_TestData);Local_Offset++)
+    {
+        CRC32_TestData[Local_Offset]=(uint8_t)TEST_Random(&Local_Seed);
+    }
+    /*Known values, the same as Calculate_CRC32 of Host.py*/
+    TEST_CHECK(CRC32_Reference(CRC32_INIT_VALUE, (const uint8_t*)"123456789", 9U)==0x1556F485UL);
+    TEST_CHECK(CRC32_Reference(CRC32_INIT_VALUE, NULL, 0U)==CRC32_INIT_VALUE);
+    for(Local_Engine=0U;Local_Engine<CRC32_ENGINES_NUM;Local_Engine++)
+    {
+        const CRC32_Engine_t* Local_Under=&CRC32_Engines[Local_Engine];
+        uint32_t Local_Failures=TEST_Failures;
+        /*Whole buffers, the slicing engines read four bytes at a time*/
+        for(Local_Offset=0U;Local_Offset<8U;Local_Offset++)
+        {
+            for(Local_Length=0U;Local_Length<=CRC32_TEST_LENGTH;Local_Length++)
+            {
+                Local_Expected=CRC32_Reference(CRC32_INIT_VALUE, &CRC32_TestData[Local_Offset], Local_Length);
+                TEST_CHECK(Local_Under->Calculate(&CRC32_TestData[Local_Offset], Local_Length)==Local_Expected);
+            }
+        }
+        /*Every split point of the whole buffer*/
+        Local_Expected=CRC32_Reference(CRC32_INIT_VALUE, CRC32_TestData, CRC32_TEST_LENGTH);
+        for(Local_Split=0U;Local_Split<=CRC32_TEST_LENGTH;Local_Split++)
+        {
+            Local_CRC=Local_Under->Update(CRC32_INIT_VALUE, CRC32_TestData, Local_Split);
+            Local_CRC=Local_Under->Update(Local_CRC, &CRC32_TestData[Local_Split], CRC32_TEST_LENGTH-Local_Split);
+            TEST_CHECK(Local_CRC==Local_Expected);
+        }
+        /*Random three way splits of random lengths*/
+        for(Local_Split=0U;Local_Split<CRC32_TEST_SPLITS;Local_Split++)
+        {
+            Local_Length=TEST_Random(&Local_Seed)%(CRC32_TEST_LENGTH+1U);
+            Local_First=TEST_Random(&Local_Seed)%(Local_Length+1U);
+            Local_Second=Local_First+(TEST_Random(&Local_Seed)%(Local_Length-Local_First+1U));
+            Local_CRC=Local_Under->Update(CRC32_INIT_VALUE, CRC32_TestData, Local_First);
+            Local_CRC=Local_Under->Update(Local_CRC, &CRC32_TestData[Local_First], Local_Second-Local_First);
+            Local_CRC=Local_Under->Update(Local_CRC, &CRC32_TestData[Local_Second], Local_Length-Local_Second);
+            TEST_CHECK(Local_CRC==CRC32_Reference(CRC32_INIT_VALUE, CRC32_TestData, Local_Length));
+        }
+        printf("  %-12s %s\n", Local_Under->Name, (TEST_Failures==Local_Failures) ? "ok" : "FAILED");
+    }
+    return TEST_RESULT("Crc32Test");
+}
@@ -0,0 +1,257 @@
+/*
+ * FakeUart.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  driverlib functions used by Uart.c, see FakeUart.h. Only UART0 is modelled, the driver tests
+ *  don't open another one.
+ */
+#include <string.h>
+#include "FakeUart.h"
+#include "Uart.h"
+
+#define FAKE_UART_TX_SIZE       8192U
+
+FAKE_UartStats_t FAKE_UartStats;
+
+static const uint8_t* FAKE_UartWire=NULL;
+static uint32_t FAKE_UartWireLength=0U;
+static uint32_t FAKE_UartWireIndex=0U;
+static uint8_t FAKE_UartFifo[FAKE_UART_FIFO_SIZE];
+static uint8_t FAKE_UartFifoHead=0U;
+static uint8_t FAKE_UartFifoCount=0U;
+static uint8_t FAKE_UartTx[FAKE_UART_TX_SIZE];
+static uint32_t FAKE_UartTxCount=0U;
+static uint32_t FAKE_UartMask=0U;
+static uint32_t FAKE_UartDmaControl=0U;
+static bool FAKE_UartDmaRaw=false;
+static bool FAKE_UartNvic=false;
+static bool FAKE_UartMaster=false;
+static bool FAKE_UartInIsr=false;
+static uint32_t FAKE_UartRegisters[4];
+
+static uint32_t FAKE_UartSources(void)
+{
+    uint32_t Local_Sources=FAKE_UartMask & UART_INT_TX;
+    if(FAKE_UartFifoCount!=0U)
+    {
+        Local_Sources|=(FAKE_UartMask & (UART_INT_RX | UART_INT_RT));
+    }
+    return Local_Sources;
+}
+
+/* Level triggered, the handler runs again while an enabled source is left pending */
+static void FAKE_UartInterrupt(void)
+{
+    uint8_t Local_Rounds=0U;
+    while((FAKE_UartInIsr==false) && (FAKE_UartNvic==true) && (FAKE_UartMaster==true) &&
+          ((FAKE_UartSources()!=0U) || (FAKE_UartDmaRaw==true)) && (Local_Rounds<8U))
+    {
+        FAKE_UartInIsr=true;
+        FAKE_UartDmaRaw=false;
+        FAKE_UartStats.Interrupts++;
+        UART_IntHandler();
+        FAKE_UartInIsr=false;
+        Local_Rounds++;
+    }
+}
+
+void FAKE_UartScript(const uint8_t* Copy_Data,uint32_t Copy_Length)
+{
+    FAKE_UartWire=Copy_Data;
+    FAKE_UartWireLength=Copy_Length;
+    FAKE_UartWireIndex=0U;
+}
+
+uint32_t FAKE_UartPending(void)
+{
+    return FAKE_UartWireLength-FAKE_UartWireIndex;
+}
+
+uint32_t FAKE_UartRun(uint32_t Copy_Bytes)
+{
+    uint32_t Local_Moved=0U;
+    for( ;(Local_Moved<Copy_Bytes) && (FAKE_UartWireIndex<FAKE_UartWireLength);Local_Moved++)
+    {
+        if(FAKE_UartFifoCount<FAKE_UART_FIFO_SIZE)
+        {
+            FAKE_UartFifo[(FAKE_UartFifoHead+FAKE_UartFifoCount)%FAKE_UART_FIFO_SIZE]=FAKE_UartWire[FAKE_UartWireIndex];
+            FAKE_UartFifoCount++;
+        }
+        else
+        {
+            FAKE_UartStats.Overruns++;
+        }
+        FAKE_UartWireIndex++;
+        FAKE_DmaService();
+        FAKE_UartInterrupt();
+    }
+    return Local_Moved;
+}
+
+uint32_t FAKE_UartTaken(uint8_t* Copy_Data,uint32_t Copy_Length)
+{
+    uint32_t Local_Length=(FAKE_UartTxCount<Copy_Length) ? FAKE_UartTxCount : Copy_Length;
+    memcpy(Copy_Data, FAKE_UartTx, Local_Length);
+    memmove(FAKE_UartTx, &FAKE_UartTx[Local_Length], FAKE_UartTxCount-Local_Length);
+    FAKE_UartTxCount-=Local_Length;
+    return Local_Length;
+}
+
+bool FAKE_UartDmaRequest(void)
+{
+    return ((FAKE_UartDmaControl & UART_DMA_RX)!=0U) && (FAKE_UartFifoCount!=0U);
+}
+
+uint8_t FAKE_UartFifoPop(void)
+{
+    uint8_t Local_Data=FAKE_UartFifo[FAKE_UartFifoHead];
+    FAKE_UartFifoHead=(uint8_t)((FAKE_UartFifoHead+1U)%FAKE_UART_FIFO_SIZE);
+    FAKE_UartFifoCount--;
+    return Local_Data;
+}
+
+void FAKE_UartDmaDone(void)
+{
+    /*A peripheral channel completes on the interrupt of its peripheral*/
+    FAKE_UartDmaRaw=true;
+}
+
+volatile uint32_t* SIM_Register(uint32_t Copy_Address)
+{
+    return &FAKE_UartRegisters[(Copy_Address>>2) & 3U];
+}
+
+void SysCtlPeripheralEnable(uint32_t ui32Peripheral)
+{
+}
+
+void SysCtlPeripheralDisable(uint32_t ui32Peripheral)
+{
+}
+
+void SysCtlPeripheralReset(uint32_t ui32Peripheral)
+{
+}
+
+uint32_t SysCtlClockGet(void)
+{
+    return FAKE_UART_CLOCK;
+}
+
+void GPIOPinTypeUART(uint32_t ui32Port, uint8_t ui8Pins)
+{
+}
+
+void GPIOPinConfigure(uint32_t ui32PinConfig)
+{
+}
+
+void GPIOPadConfigSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32Strength, uint32_t ui32PinType)
+{
+}
+
+bool IntMasterEnable(void)
+{
+    bool Local_Previous=!FAKE_UartMaster;
+    FAKE_UartMaster=true;
+    FAKE_UartInterrupt();
+    return Local_Previous;
+}
+
+void IntEnable(uint32_t ui32Interrupt)
+{
+    if(ui32Interrupt==INT_UART0)
+    {
+        FAKE_UartNvic=true;
+        FAKE_UartInterrupt();
+    }
+}
+
+void IntDisable(uint32_t ui32Interrupt)
+{
+    if(ui32Interrupt==INT_UART0)
+    {
+        FAKE_UartNvic=false;
+    }
+}
+
+void UARTEnable(uint32_t ui32Base)
+{
+}
+
+void UARTDisable(uint32_t ui32Base)
+{
+}
+
+void UARTConfigSetExpClk(uint32_t ui32Base, uint32_t ui32UARTClk, uint32_t ui32Baud, uint32_t ui32Config)
+{
+}
+
+void UARTFIFOLevelSet(uint32_t ui32Base, uint32_t ui32TxLevel, uint32_t ui32RxLevel)
+{
+}
+
+bool UARTCharsAvail(uint32_t ui32Base)
+{
+    return (FAKE_UartFifoCount!=0U);
+}
+
+bool UARTSpaceAvail(uint32_t ui32Base)
+{
+    return (FAKE_UartTxCount<FAKE_UART_TX_SIZE);
+}
+
+int32_t UARTCharGetNonBlocking(uint32_t ui32Base)
+{
+    return (FAKE_UartFifoCount!=0U) ? (int32_t)FAKE_UartFifoPop() : -1;
+}
+
+bool UARTCharPutNonBlocking(uint32_t ui32Base, unsigned char ucData)
+{
+    bool Local_State=UARTSpaceAvail(ui32Base);
+    if(Local_State==true)
+    {
+        FAKE_UartTx[FAKE_UartTxCount]=ucData;
+        FAKE_UartTxCount++;
+    }
+    return Local_State;
+}
+
+bool UARTBusy(uint32_t ui32Base)
+{
+    return false;
+}
+
+void UARTIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    FAKE_UartMask|=ui32IntFlags;
+    FAKE_UartInterrupt();
+}
+
+void UARTIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    FAKE_UartMask&=~ui32IntFlags;
+}
+
+uint32_t UARTIntStatus(uint32_t ui32Base, bool bMasked)
+{
+    return FAKE_UartSources();
+}
+
+void UARTIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+}
+
+void UARTDMAEnable(uint32_t ui32Base, uint32_t ui32DMAFlags)
+{
+    FAKE_UartDmaControl|=ui32DMAFlags;
+    FAKE_DmaService();
+    FAKE_UartInterrupt();
+}
+
+void UARTDMADisable(uint32_t ui32Base, uint32_t ui32DMAFlags)
+{
+    FAKE_UartDmaControl&=~ui32DMAFlags;
+}
@@ -0,0 +1,54 @@
+/*
+ * FakeUart.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Stand-in of UART0 for the driver tests: Uart.c runs unchanged on top of the driverlib functions
+ *  of FakeUart.c and of the fake DMA engine of FakeUartDma.c. The host bytes are a scripted stream,
+ *  FAKE_UartRun moves them one at a time into the 16 byte RX FIFO, the fake DMA engine copies them
+ *  from there to memory while it is armed and the UART DMA request is on, and UART_IntHandler is
+ *  called while an enabled source is pending, as the NVIC does. The bytes sent by the driver are
+ *  collected.
+ */
+
+#ifndef FAKEUART_H_
+#define FAKEUART_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FAKE_UART_FIFO_SIZE     16U
+#define FAKE_UART_CLOCK         80000000UL
+
+typedef struct
+{
+    uint32_t Overruns;          /* Bytes lost on a full RX FIFO */
+    uint32_t Interrupts;        /* UART_IntHandler calls */
+    uint32_t DmaArms;           /* UARTDMA_Arm calls */
+    uint32_t DmaBytes;          /* Bytes moved by the fake DMA engine */
+    uint16_t DmaLongest;        /* Longest armed transfer */
+}FAKE_UartStats_t;
+
+extern FAKE_UartStats_t FAKE_UartStats;
+
+/* Script of the host, Copy_Data must stay valid until it is consumed */
+void FAKE_UartScript(const uint8_t* Copy_Data,uint32_t Copy_Length);
+
+/* Bytes of the script not on the wire yet */
+uint32_t FAKE_UartPending(void);
+
+/* Put up to Copy_Bytes script bytes on the wire, returns the number moved */
+uint32_t FAKE_UartRun(uint32_t Copy_Bytes);
+
+/* Bytes the driver transmitted since the last call */
+uint32_t FAKE_UartTaken(uint8_t* Copy_Data,uint32_t Copy_Length);
+
+/* Between the UART and the fake DMA engine: the UART requests a transfer while its DMA receive is
+ * enabled and the RX FIFO holds a byte, the engine pops the byte and signals the end of the transfer */
+bool FAKE_UartDmaRequest(void);
+uint8_t FAKE_UartFifoPop(void);
+void FAKE_UartDmaDone(void);
+void FAKE_DmaService(void);
+
+#endif /* FAKEUART_H_ */
@@ -0,0 +1,62 @@
+/*
+ * FakeUartDma.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Fake DMA engine behind UartDma.h, linked instead of UartDma.c by the driver tests. An armed
+ *  transfer copies the scripted host bytes from the RX FIFO of FakeUart.c while the UART requests
+ *  it, and ends on the UART interrupt as a uDMA basic transfer does.
+ */
+#include <stddef.h>
+#include "UartDma.h"
+#include "FakeUart.h"
+
+static uint8_t* FAKE_DmaDest=NULL;
+static uint16_t FAKE_DmaRemaining=0U;
+static bool FAKE_DmaEnabled=false;
+
+void UARTDMA_Init(uint32_t Copy_UartBase,uint32_t Copy_Channel)
+{
+    FAKE_DmaEnabled=false;
+}
+
+void UARTDMA_Arm(uint8_t* Copy_Dest,uint16_t Copy_Length)
+{
+    FAKE_DmaDest=Copy_Dest;
+    FAKE_DmaRemaining=Copy_Length;
+    FAKE_DmaEnabled=(Copy_Length!=0U);
+    FAKE_UartStats.DmaArms++;
+    if(Copy_Length>FAKE_UartStats.DmaLongest)
+    {
+        FAKE_UartStats.DmaLongest=Copy_Length;
+    }
+    FAKE_DmaService();
+}
+
+bool UARTDMA_IsDone(void)
+{
+    return (FAKE_DmaEnabled==false);
+}
+
+void UARTDMA_DeInit(void)
+{
+    FAKE_DmaEnabled=false;
+}
+
+void FAKE_DmaService(void)
+{
+    while((FAKE_DmaEnabled==true) && (FAKE_UartDmaRequest()==true))
+    {
+        *FAKE_DmaDest=FAKE_UartFifoPop();
+        FAKE_DmaDest++;
+        FAKE_DmaRemaining--;
+        FAKE_UartStats.DmaBytes++;
+        if(FAKE_DmaRemaining==0U)
+        {
+            /*The controller disables the channel at the end of a basic transfer*/
+            FAKE_DmaEnabled=false;
+            FAKE_UartDmaDone();
+        }
+    }
+}
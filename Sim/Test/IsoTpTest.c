@@ -0,0 +1,378 @@
+/*
+ * IsoTpTest.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  IsoTp.c on an in-process bus: two links whose Transmit callbacks queue the frames for the other
+ *  one, a mailbox that is busy now and then, a reader draining the receive ring at a set rate.
+ *  Checks the frames on the wire (single, first and consecutive frames, sequence numbers, padding),
+ *  the reassembly, the flow control per block size, the STmin gaps, FC.WAIT while the ring is full
+ *  and FC.OVFLW once it stays full, lost frames and the timeouts, then random messages both ways.
+ */
+#include <string.h>
+#include "Test.h"
+#include "IsoTp.h"
+
+#define ISOTP_TEST_LOG          2048U
+#define ISOTP_TEST_RING         4096U
+#define ISOTP_TEST_MAX_TICKS    200000UL
+#define ISOTP_TEST_MESSAGES     300U
+
+typedef struct
+{
+    uint8_t Frames[ISOTP_TEST_LOG][ISOTP_FRAME_LEN];
+    uint32_t Ticks[ISOTP_TEST_LOG];     /* Tick each frame left on */
+    uint16_t Count;
+    uint16_t Delivered;
+    uint8_t BusyPercent;                /* Transmit calls refused with a busy mailbox */
+    uint32_t Seed;
+}ISOTP_TestBus_t;
+
+typedef struct
+{
+    ISOTP_Link_t Link;
+    ISOTP_TestBus_t Bus;                /* Frames this side sent */
+    RingBuffer_t Ring;
+    uint8_t Storage[ISOTP_TEST_RING];
+    uint8_t Received[ISOTP_MAX_MESSAGE];
+    uint16_t ReceivedLength;
+    uint16_t ReadRate;                  /* Bytes taken from the ring per tick */
+}ISOTP_TestSide_t;
+
+static ISOTP_TestSide_t ISOTP_TestA;
+static ISOTP_TestSide_t ISOTP_TestB;
+static uint8_t ISOTP_TestData[2][ISOTP_MAX_MESSAGE];
+static uint32_t ISOTP_TestTick=0U;
+/* Frame of the log the bus drops instead of delivering, ISOTP_TEST_LOG for none */
+static uint16_t ISOTP_TestDrop=ISOTP_TEST_LOG;
+
+static bool ISOTP_TestTransmit(void* Copy_Context,const uint8_t* Copy_Frame)
+{
+    ISOTP_TestBus_t* Local_Bus=(ISOTP_TestBus_t*)Copy_Context;
+    bool Local_State=false;
+    if(((TEST_Random(&Local_Bus->Seed)%100U)>=Local_Bus->BusyPercent) && (Local_Bus->Count<ISOTP_TEST_LOG))
+    {
+        memcpy(Local_Bus->Frames[Local_Bus->Count], Copy_Frame, ISOTP_FRAME_LEN);
+        Local_Bus->Ticks[Local_Bus->Count]=ISOTP_TestTick;
+        Local_Bus->Count++;
+        Local_State=true;
+    }
+    return Local_State;
+}
+
+static void ISOTP_TestInit(ISOTP_TestSide_t* Copy_Side,uint16_t Copy_RingSize,uint8_t Copy_BlockSize,uint8_t Copy_STmin,uint16_t Copy_ReadRate)
+{
+    memset(&Copy_Side->Bus, 0, sizeof(Copy_Side->Bus));
+    Copy_Side->Bus.Seed=Copy_RingSize+Copy_BlockSize+Copy_STmin;
+    RingBuffer_Init(&Copy_Side->Ring, Copy_Side->Storage, Copy_RingSize);
+    ISOTP_Init(&Copy_Side->Link, ISOTP_TestTransmit, &Copy_Side->Bus, &Copy_Side->Ring, Copy_BlockSize, Copy_STmin);
+    Copy_Side->ReceivedLength=0U;
+    Copy_Side->ReadRate=Copy_ReadRate;
+}
+
+/* Hands the new frames of one side to the other */
+static void ISOTP_TestDeliver(ISOTP_TestSide_t* Copy_From,ISOTP_TestSide_t* Copy_To)
+{
+    for( ;Copy_From->Bus.Delivered<Copy_From->Bus.Count;Copy_From->Bus.Delivered++)
+    {
+        if((Copy_From==&ISOTP_TestA) && (Copy_From->Bus.Delivered==ISOTP_TestDrop))
+        {
+            continue;
+        }
+        ISOTP_OnFrame(&Copy_To->Link, Copy_From->Bus.Frames[Copy_From->Bus.Delivered], ISOTP_FRAME_LEN);
+    }
+}
+
+static void ISOTP_TestRead(ISOTP_TestSide_t* Copy_Side)
+{
+    uint16_t Local_Length=Copy_Side->ReadRate;
+    if(Local_Length>(ISOTP_MAX_MESSAGE-Copy_Side->ReceivedLength))
+    {
+        Local_Length=ISOTP_MAX_MESSAGE-Copy_Side->ReceivedLength;
+    }
+    Copy_Side->ReceivedLength+=RingBuffer_Read(&Copy_Side->Ring, &Copy_Side->Received[Copy_Side->ReceivedLength], Local_Length);
+}
+
+/* One tick of the bus: both links send what is due, the frames arrive, the readers drain the rings */
+static void ISOTP_TestStep(void)
+{
+    ISOTP_Poll(&ISOTP_TestA.Link);
+    ISOTP_Poll(&ISOTP_TestB.Link);
+    ISOTP_TestDeliver(&ISOTP_TestA, &ISOTP_TestB);
+    ISOTP_TestDeliver(&ISOTP_TestB, &ISOTP_TestA);
+    ISOTP_TestRead(&ISOTP_TestA);
+    ISOTP_TestRead(&ISOTP_TestB);
+    ISOTP_OnTick(&ISOTP_TestA.Link);
+    ISOTP_OnTick(&ISOTP_TestB.Link);
+    ISOTP_TestTick++;
+}
+
+static bool ISOTP_TestBusy(const ISOTP_TestSide_t* Copy_Side)
+{
+    return ((Copy_Side->Link.TxState!=ISOTP_TX_IDLE) && (Copy_Side->Link.TxState!=ISOTP_TX_DONE) && (Copy_Side->Link.TxState!=ISOTP_TX_ERROR)) ||
+           (Copy_Side->Link.RxState!=ISOTP_RX_IDLE) || (RingBuffer_Count(&Copy_Side->Ring)!=0U);
+}
+
+/* Runs the bus until A is done with its message and B has nothing left to receive or read, returns A's send state */
+static ISOTP_TxState_t ISOTP_TestRun(uint16_t Copy_Length)
+{
+    uint32_t Local_Start=ISOTP_TestTick;
+    TEST_CHECK(ISOTP_Send(&ISOTP_TestA.Link, ISOTP_TestData[0], Copy_Length)==true);
+    do
+    {
+        ISOTP_TestStep();
+    }while(((ISOTP_TestTick-Local_Start)<ISOTP_TEST_MAX_TICKS) && ((ISOTP_TestBusy(&ISOTP_TestA)==true) || (ISOTP_TestBusy(&ISOTP_TestB)==true)));
+    return ISOTP_TestA.Link.TxState;
+}
+
+/* Frames of the log starting with this byte */
+static uint16_t ISOTP_TestCount(const ISOTP_TestBus_t* Copy_Bus,uint8_t Copy_Pci)
+{
+    uint16_t Local_Count=0U;
+    uint16_t Local_Counter=0U;
+    for(Local_Counter=0U;Local_Counter<Copy_Bus->Count;Local_Counter++)
+    {
+        if(Copy_Bus->Frames[Local_Counter][0]==Copy_Pci)
+        {
+            Local_Count++;
+        }
+    }
+    return Local_Count;
+}
+
+static void ISOTP_TestSegmentation(void)
+{
+    static const uint16_t Local_Lengths[]={1U, 6U, 7U, 8U, 13U, 14U, 20U, 111U, 112U, 113U, 1000U, ISOTP_MAX_MESSAGE};
+    uint8_t Local_Length=0U;
+    uint16_t Local_Counter=0U;
+    uint16_t Local_Frames=0U;
+    uint16_t Local_Last=0U;
+    bool Local_Padded=true;
+    for(Local_Length=0U;Local_Length<(sizeof(Local_Lengths)/sizeof(Local_Lengths[0]));Local_Length++)
+    {
+        ISOTP_TestInit(&ISOTP_TestA, 64U, 0U, 0U, 0U);
+        ISOTP_TestInit(&ISOTP_TestB, ISOTP_TEST_RING, 0U, 0U, ISOTP_TEST_RING);
+        TEST_CHECK(ISOTP_TestRun(Local_Lengths[Local_Length])==ISOTP_TX_DONE);
+        TEST_CHECK((ISOTP_TestB.ReceivedLength==Local_Lengths[Local_Length]) &&
+                   (memcmp(ISOTP_TestB.Received, ISOTP_TestData[0], Local_Lengths[Local_Length])==0));
+        TEST_CHECK(ISOTP_TestB.Link.RxErrors==0U);
+        if(Local_Lengths[Local_Length]<=7U)
+        {
+            /*One single frame, PCI 0x0N, the rest padded*/
+            TEST_CHECK((ISOTP_TestA.Bus.Count==1U) && (ISOTP_TestA.Bus.Frames[0][0]==Local_Lengths[Local_Length]));
+            for(Local_Counter=Local_Lengths[Local_Length]+1U;Local_Counter<ISOTP_FRAME_LEN;Local_Counter++)
+            {
+                TEST_CHECK(ISOTP_TestA.Bus.Frames[0][Local_Counter]==ISOTP_PADDING);
+            }
+            TEST_CHECK(ISOTP_TestB.Bus.Count==0U);
+        }
+        else
+        {
+            /*First frame with the 12-bit length, then the consecutive frames numbered 1..15, 0, 1..*/
+            Local_Frames=(uint16_t)((Local_Lengths[Local_Length]-6U+6U)/7U);
+            Local_Last=(uint16_t)(((Local_Lengths[Local_Length]-6U-1U)%7U)+1U);
+            TEST_CHECK((ISOTP_TestA.Bus.Frames[0][0]==(0x10U | (Local_Lengths[Local_Length]>>8))) &&
+                       (ISOTP_TestA.Bus.Frames[0][1]==(uint8_t)Local_Lengths[Local_Length]));
+            TEST_CHECK(ISOTP_TestA.Bus.Count==(Local_Frames+1U));
+            for(Local_Counter=1U;Local_Counter<ISOTP_TestA.Bus.Count;Local_Counter++)
+            {
+                TEST_CHECK(ISOTP_TestA.Bus.Frames[Local_Counter][0]==(0x20U | (Local_Counter & 0x0FU)));
+            }
+            for(Local_Counter=Local_Last+1U;Local_Counter<ISOTP_FRAME_LEN;Local_Counter++)
+            {
+                Local_Padded&=(ISOTP_TestA.Bus.Frames[ISOTP_TestA.Bus.Count-1U][Local_Counter]==ISOTP_PADDING);
+            }
+            /*No block size: one flow control for the whole message*/
+            TEST_CHECK((ISOTP_TestB.Bus.Count==1U) && (ISOTP_TestB.Bus.Frames[0][0]==0x30U) && (ISOTP_TestB.Bus.Frames[0][1]==0U));
+        }
+    }
+    TEST_CHECK(Local_Padded==true);
+    TEST_CHECK(ISOTP_Send(&ISOTP_TestA.Link, ISOTP_TestData[0], 0U)==false);
+    TEST_CHECK(ISOTP_Send(&ISOTP_TestA.Link, ISOTP_TestData[0], ISOTP_MAX_MESSAGE+1U)==false);
+    /*One message at a time*/
+    TEST_CHECK(ISOTP_Send(&ISOTP_TestA.Link, ISOTP_TestData[0], 100U)==true);
+    TEST_CHECK(ISOTP_Send(&ISOTP_TestA.Link, ISOTP_TestData[0], 100U)==false);
+}
+
+static void ISOTP_TestFlowControl(void)
+{
+    static const uint8_t Local_BlockSizes[]={1U, 2U, 4U, 15U, 255U};
+    uint8_t Local_Size=0U;
+    uint16_t Local_Counter=0U;
+    uint16_t Local_Frames=0U;
+    uint16_t Local_SinceFC=0U;
+    uint16_t Local_Consecutive=(ISOTP_MAX_MESSAGE-6U+6U)/7U;
+    for(Local_Size=0U;Local_Size<sizeof(Local_BlockSizes);Local_Size++)
+    {
+        ISOTP_TestInit(&ISOTP_TestA, 64U, 0U, 0U, 0U);
+        ISOTP_TestInit(&ISOTP_TestB, ISOTP_TEST_RING, Local_BlockSizes[Local_Size], 0U, ISOTP_TEST_RING);
+        TEST_CHECK(ISOTP_TestRun(ISOTP_MAX_MESSAGE)==ISOTP_TX_DONE);
+        TEST_CHECK(memcmp(ISOTP_TestB.Received, ISOTP_TestData[0], ISOTP_MAX_MESSAGE)==0);
+        /*A flow control after the first frame and after every full block but the last*/
+        Local_Frames=(uint16_t)((Local_Consecutive+Local_BlockSizes[Local_Size]-1U)/Local_BlockSizes[Local_Size]);
+        TEST_CHECK(ISOTP_TestB.Bus.Count==Local_Frames);
+        TEST_CHECK(ISOTP_TestB.Bus.Frames[0][1]==Local_BlockSizes[Local_Size]);
+        /*The sender never runs ahead of the grant: every CF comes after a FC that covers it*/
+        Local_SinceFC=0U;
+        Local_Frames=0U;
+        for(Local_Counter=1U;Local_Counter<ISOTP_TestA.Bus.Count;Local_Counter++)
+        {
+            while((Local_Frames<ISOTP_TestB.Bus.Count) && (ISOTP_TestB.Bus.Ticks[Local_Frames]<ISOTP_TestA.Bus.Ticks[Local_Counter]))
+            {
+                Local_Frames++;
+                Local_SinceFC=0U;
+            }
+            Local_SinceFC++;
+            TEST_CHECK(Local_SinceFC<=Local_BlockSizes[Local_Size]);
+        }
+    }
+}
+
+static void ISOTP_TestSTmin(void)
+{
+    static const uint8_t Local_STmins[]={0x00U, 0x01U, 0x05U, 0xF1U, 0xF9U, 0x80U, 0xFAU};
+    static const uint8_t Local_Gaps[]={1U, 1U, 5U, 1U, 1U, 0x7FU, 0x7FU};
+    uint8_t Local_STmin=0U;
+    uint16_t Local_Counter=0U;
+    uint32_t Local_Gap=0U;
+    bool Local_Exact=true;
+    for(Local_STmin=0U;Local_STmin<sizeof(Local_STmins);Local_STmin++)
+    {
+        ISOTP_TestInit(&ISOTP_TestA, 64U, 0U, 0U, 0U);
+        ISOTP_TestInit(&ISOTP_TestB, ISOTP_TEST_RING, 8U, Local_STmins[Local_STmin], ISOTP_TEST_RING);
+        TEST_CHECK(ISOTP_TestRun(300U)==ISOTP_TX_DONE);
+        TEST_CHECK(memcmp(ISOTP_TestB.Received, ISOTP_TestData[0], 300U)==0);
+        TEST_CHECK(ISOTP_TestB.Bus.Frames[0][2]==Local_STmins[Local_STmin]);
+        /*Between two consecutive frames of a block, the sender waits exactly STmin*/
+        for(Local_Counter=2U;Local_Counter<ISOTP_TestA.Bus.Count;Local_Counter++)
+        {
+            if(((Local_Counter-1U)%8U)!=0U)
+            {
+                Local_Gap=ISOTP_TestA.Bus.Ticks[Local_Counter]-ISOTP_TestA.Bus.Ticks[Local_Counter-1U];
+                Local_Exact&=(Local_Gap==Local_Gaps[Local_STmin]);
+            }
+        }
+        if(Local_Exact==false)
+        {
+            printf("  STmin 0x%02X: wrong gap\n", Local_STmins[Local_STmin]);
+            TEST_Failures++;
+            Local_Exact=true;
+        }
+    }
+}
+
+static void ISOTP_TestWait(void)
+{
+    /*The reader takes 1 byte a tick out of a 512 byte ring: FC.WAIT until the next block of 64 CFs fits,
+     *each one restarts the N_Bs of the sender*/
+    ISOTP_TestInit(&ISOTP_TestA, 64U, 0U, 0U, 0U);
+    ISOTP_TestInit(&ISOTP_TestB, 512U, 64U, 0U, 1U);
+    TEST_CHECK(ISOTP_TestRun(1000U)==ISOTP_TX_DONE);
+    TEST_CHECK((ISOTP_TestB.ReceivedLength==1000U) && (memcmp(ISOTP_TestB.Received, ISOTP_TestData[0], 1000U)==0));
+    TEST_CHECK((ISOTP_TestCount(&ISOTP_TestB.Bus, 0x31U)>=3U) && (ISOTP_TestB.Link.RxErrors==0U));
+    /*A reader that stopped: ISOTP_MAX_WAITS waits, then FC.OVFLW and the sender gives up*/
+    ISOTP_TestInit(&ISOTP_TestA, 64U, 0U, 0U, 0U);
+    ISOTP_TestInit(&ISOTP_TestB, 512U, 64U, 0U, 0U);
+    TEST_CHECK(ISOTP_TestRun(1000U)==ISOTP_TX_ERROR);
+    TEST_CHECK(ISOTP_TestCount(&ISOTP_TestB.Bus, 0x31U)==ISOTP_MAX_WAITS);
+    TEST_CHECK((ISOTP_TestCount(&ISOTP_TestB.Bus, 0x32U)==1U) && (ISOTP_TestB.Link.RxErrors==1U));
+}
+
+static void ISOTP_TestLoss(void)
+{
+    uint32_t Local_Start=0U;
+    /*A lost consecutive frame: the receiver drops the message on the next sequence number*/
+    ISOTP_TestInit(&ISOTP_TestA, 64U, 0U, 0U, 0U);
+    ISOTP_TestInit(&ISOTP_TestB, ISOTP_TEST_RING, 0U, 0U, ISOTP_TEST_RING);
+    ISOTP_TestDrop=5U;
+    TEST_CHECK(ISOTP_TestRun(200U)==ISOTP_TX_DONE);
+    ISOTP_TestDrop=ISOTP_TEST_LOG;
+    TEST_CHECK((ISOTP_TestB.Link.RxErrors==1U) && (ISOTP_TestB.Link.RxState==ISOTP_RX_IDLE));
+    TEST_CHECK(ISOTP_TestB.ReceivedLength==(6U+(4U*7U)));
+    /*The next message goes through*/
+    ISOTP_TestB.ReceivedLength=0U;
+    TEST_CHECK(ISOTP_TestRun(200U)==ISOTP_TX_DONE);
+    TEST_CHECK((ISOTP_TestB.ReceivedLength==200U) && (memcmp(ISOTP_TestB.Received, ISOTP_TestData[0], 200U)==0));
+    /*A lost first frame: no flow control comes, the sender times out after N_Bs*/
+    ISOTP_TestInit(&ISOTP_TestA, 64U, 0U, 0U, 0U);
+    ISOTP_TestInit(&ISOTP_TestB, ISOTP_TEST_RING, 0U, 0U, ISOTP_TEST_RING);
+    ISOTP_TestDrop=0U;
+    Local_Start=ISOTP_TestTick;
+    TEST_CHECK(ISOTP_TestRun(200U)==ISOTP_TX_ERROR);
+    ISOTP_TestDrop=ISOTP_TEST_LOG;
+    TEST_CHECK(((ISOTP_TestTick-Local_Start)>=ISOTP_TIMEOUT_TICKS) && ((ISOTP_TestTick-Local_Start)<=(ISOTP_TIMEOUT_TICKS+2U)));
+    /*A sender that stops after the first frame: the receiver gives up after N_Cr*/
+    ISOTP_TestInit(&ISOTP_TestB, ISOTP_TEST_RING, 0U, 0U, ISOTP_TEST_RING);
+    ISOTP_OnFrame(&ISOTP_TestB.Link, (const uint8_t*)"\x10\x64" "abcdef", ISOTP_FRAME_LEN);
+    ISOTP_Poll(&ISOTP_TestB.Link);
+    for(Local_Start=0U;Local_Start<(ISOTP_TIMEOUT_TICKS-1U);Local_Start++)
+    {
+        ISOTP_OnTick(&ISOTP_TestB.Link);
+    }
+    TEST_CHECK(ISOTP_TestB.Link.RxState==ISOTP_RX_WAIT_CF);
+    ISOTP_OnTick(&ISOTP_TestB.Link);
+    TEST_CHECK((ISOTP_TestB.Link.RxState==ISOTP_RX_IDLE) && (ISOTP_TestB.Link.RxErrors==1U));
+}
+
+/* Random messages both ways at once, random block sizes, STmin, ring sizes, readers and busy mailboxes */
+static void ISOTP_TestRandom(void)
+{
+    uint32_t Local_Seed=10U;
+    uint16_t Local_Message=0U;
+    uint16_t Local_Length[2];
+    uint32_t Local_Start=0U;
+    uint8_t Local_Side=0U;
+    uint8_t Local_BlockSize=0U;
+    ISOTP_TestSide_t* const Local_Sides[2]={&ISOTP_TestA, &ISOTP_TestB};
+    for(Local_Message=0U;Local_Message<ISOTP_TEST_MESSAGES;Local_Message++)
+    {
+        for(Local_Side=0U;Local_Side<2U;Local_Side++)
+        {
+            /*Without a block size the whole message must fit in the ring*/
+            Local_BlockSize=(uint8_t)(TEST_Random(&Local_Seed)%17U);
+            ISOTP_TestInit(Local_Sides[Local_Side], (Local_BlockSize==0U) ? ISOTP_TEST_RING : (uint16_t)(128U<<(TEST_Random(&Local_Seed)%6U)),
+                           Local_BlockSize, (uint8_t)(TEST_Random(&Local_Seed)%3U), (uint16_t)((TEST_Random(&Local_Seed)%64U)+1U));
+        }
+        ISOTP_TestA.Bus.BusyPercent=(uint8_t)(TEST_Random(&Local_Seed)%50U);
+        ISOTP_TestB.Bus.BusyPercent=(uint8_t)(TEST_Random(&Local_Seed)%50U);
+        Local_Length[0]=(uint16_t)((TEST_Random(&Local_Seed)%ISOTP_MAX_MESSAGE)+1U);
+        Local_Length[1]=(uint16_t)((TEST_Random(&Local_Seed)%ISOTP_MAX_MESSAGE)+1U);
+        for(Local_Start=0U;Local_Start<ISOTP_MAX_MESSAGE;Local_Start++)
+        {
+            ISOTP_TestData[0][Local_Start]=(uint8_t)TEST_Random(&Local_Seed);
+            ISOTP_TestData[1][Local_Start]=(uint8_t)TEST_Random(&Local_Seed);
+        }
+        TEST_CHECK(ISOTP_Send(&ISOTP_TestA.Link, ISOTP_TestData[0], Local_Length[0])==true);
+        TEST_CHECK(ISOTP_Send(&ISOTP_TestB.Link, ISOTP_TestData[1], Local_Length[1])==true);
+        Local_Start=ISOTP_TestTick;
+        do
+        {
+            ISOTP_TestStep();
+        }while(((ISOTP_TestTick-Local_Start)<ISOTP_TEST_MAX_TICKS) && ((ISOTP_TestBusy(&ISOTP_TestA)==true) || (ISOTP_TestBusy(&ISOTP_TestB)==true)));
+        if((ISOTP_TestB.ReceivedLength!=Local_Length[0]) || (memcmp(ISOTP_TestB.Received, ISOTP_TestData[0], Local_Length[0])!=0) ||
+           (ISOTP_TestA.ReceivedLength!=Local_Length[1]) || (memcmp(ISOTP_TestA.Received, ISOTP_TestData[1], Local_Length[1])!=0))
+        {
+            printf("  message %u: %u and %u bytes, received %u and %u\n", (unsigned)Local_Message, (unsigned)Local_Length[0],
+                   (unsigned)Local_Length[1], (unsigned)ISOTP_TestB.ReceivedLength, (unsigned)ISOTP_TestA.ReceivedLength);
+            TEST_Failures++;
+        }
+    }
+}
+
+int main(void)
+{
+    uint32_t Local_Seed=9U;
+    uint16_t Local_Counter=0U;
+    for(Local_Counter=0U;Local_Counter<ISOTP_MAX_MESSAGE;Local_Counter++)
+    {
+        ISOTP_TestData[0][Local_Counter]=(uint8_t)TEST_Random(&Local_Seed);
+    }
+    ISOTP_TestSegmentation();
+    ISOTP_TestFlowControl();
+    ISOTP_TestSTmin();
+    ISOTP_TestWait();
+    ISOTP_TestLoss();
+    ISOTP_TestRandom();
+    return TEST_RESULT("IsoTpTest");
+}
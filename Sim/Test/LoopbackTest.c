@@ -0,0 +1,376 @@
+/*
+ * LoopbackTest.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  The command layer of Bootloader.c over Loopback.c, built with TRANSPORT_LOOPBACK_ENABLE: the
+ *  Feed callback plays the host while BL_FetchHostCommand waits, it sends the frames of a script a
+ *  few bytes at a time through small rings and checks every reply byte for byte. The script covers
+ *  the wake byte, BL_GET_VER in both frame formats, a bad CRC, a frame length out of range,
+ *  BL_WRITE_MEM / BL_READ_MEM on the simulated flash, a BL_STREAM_WRITE stream with a failed
+ *  frame and a resent sequence 0, BL_GET_SECTOR_CRC of an erased then execute only sector, and the
+ *  status of the last coalesced BL_WRITE_MEM block with and without the empty end frame, and an
+ *  unknown command. The simulator is up without its tick, no
+ *  interrupt is needed on a link in memory.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include "Test.h"
+#include "Sim.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/flash.h"
+#include "Loopback.h"
+#include "Transport.h"
+#include "Bootloader.h"
+#include "Crc32.h"
+
+#define LOOPBACK_TEST_TO_TARGET     64U
+#define LOOPBACK_TEST_TO_HOST       16U
+#define LOOPBACK_TEST_MAX_CHUNK     7U
+/* Feed calls without a byte moved before the test gives up */
+#define LOOPBACK_TEST_STALL         1000000UL
+#define LOOPBACK_TEST_ADDRESS       (BL_FLASH_BOOT_SECTORS*FLASH_SECTOR_SIZE)
+#define LOOPBACK_TEST_WRITE         200U
+#define LOOPBACK_TEST_EXT_WRITE     600U
+#define LOOPBACK_TEST_STREAM        (LOOPBACK_TEST_ADDRESS+FLASH_SECTOR_SIZE)
+#define LOOPBACK_TEST_STREAM_FRAME  16U
+/* Erased sector of its own flash protection block */
+#define LOOPBACK_TEST_CRC_SECTOR    (BL_FLASH_BOOT_SECTORS+4U)
+/* Less than a write buffer block, the write leaves it in the coalescing buffer */
+#define LOOPBACK_TEST_TAIL          16U
+#define LOOPBACK_TEST_TAIL_SECTOR   (BL_FLASH_BOOT_SECTORS+6U)
+
+static uint8_t LOOPBACK_TestToTarget[LOOPBACK_TEST_TO_TARGET];
+static uint8_t LOOPBACK_TestToHost[LOOPBACK_TEST_TO_HOST];
+
+static uint8_t LOOPBACK_TestImage[LOOPBACK_TEST_WRITE+LOOPBACK_TEST_EXT_WRITE];
+static uint8_t LOOPBACK_TestRequest[BL_HOST_BUFFER_SIZE+8U];
+static uint16_t LOOPBACK_TestRequestLen=0U;
+static uint16_t LOOPBACK_TestSent=0U;
+static uint8_t LOOPBACK_TestExpected[LOOPBACK_TEST_WRITE+LOOPBACK_TEST_EXT_WRITE+16U];
+static uint16_t LOOPBACK_TestExpectedLen=0U;
+static uint8_t LOOPBACK_TestReply[sizeof(LOOPBACK_TestExpected)];
+static uint16_t LOOPBACK_TestReceived=0U;
+static uint8_t LOOPBACK_TestStep=0U;
+static uint32_t LOOPBACK_TestSeed=14U;
+static uint32_t LOOPBACK_TestIdle=0U;
+
+static const char* const LOOPBACK_TestSteps[]=
+{
+    "wake byte", "BL_GET_VER", "bad CRC", "frame too short", "BL_GET_VER extended frame",
+    "BL_WRITE_MEM", "BL_WRITE_MEM extended frame", "BL_READ_MEM", "BL_STREAM_WRITE 0",
+    "BL_STREAM_WRITE 1 out of flash", "BL_STREAM_WRITE 0 resent", "BL_STREAM_WRITE 2", "BL_STREAM_WRITE end",
+    "BL_GET_SECTOR_CRC", "BL_GET_SECTOR_CRC execute only",
+    "BL_WRITE_MEM over written flash", "BL_WRITE_MEM end failed", "BL_WRITE_MEM over written flash again",
+    "BL_GET_VER after the write", "BL_WRITE_MEM to erased flash", "BL_WRITE_MEM end passed", "BL_VERIFY_CRC after a lost write",
+    "BL_ERASE_FLASH", "BL_VERIFY_CRC after the erase", "unknown command"
+};
+
+#define LOOPBACK_TEST_STEPS         (sizeof(LOOPBACK_TestSteps)/sizeof(LOOPBACK_TestSteps[0]))
+
+/* Appends the CRC of the frame and returns its length, Copy_HeaderLen is 1 or 3 (extended) */
+static uint16_t LOOPBACK_TestFrame(uint8_t Copy_HeaderLen,uint16_t Copy_BodyLen)
+{
+    uint16_t Local_FrameLen=Copy_BodyLen+BL_CRC_LEN;
+    uint32_t Local_CRC=0U;
+    if(Copy_HeaderLen==1U)
+    {
+        LOOPBACK_TestRequest[0]=(uint8_t)Local_FrameLen;
+    }
+    else
+    {
+        LOOPBACK_TestRequest[0]=BL_EXT_FRAME_MARKER;
+        LOOPBACK_TestRequest[1]=(uint8_t)Local_FrameLen;
+        LOOPBACK_TestRequest[2]=(uint8_t)(Local_FrameLen>>8);
+    }
+    Local_CRC=CRC32_Calculate(LOOPBACK_TestRequest, Copy_HeaderLen+Copy_BodyLen);
+    memcpy(&LOOPBACK_TestRequest[Copy_HeaderLen+Copy_BodyLen], &Local_CRC, BL_CRC_LEN);
+    return Copy_HeaderLen+Local_FrameLen;
+}
+
+static void LOOPBACK_TestVersion(void)
+{
+    static const uint8_t Local_Version[]={BL_ACK, 7U, BL_VENDOR_ID, BL_SW_MAJOR_VERSION, BL_SW_MANOR_VERSION, BL_SW_PATCH_VERSION,
+                                          BL_FRAME_VERSION, (uint8_t)BL_MAX_FRAME_LEN, (uint8_t)(BL_MAX_FRAME_LEN>>8)};
+    memcpy(LOOPBACK_TestExpected, Local_Version, sizeof(Local_Version));
+    LOOPBACK_TestExpectedLen=sizeof(Local_Version);
+}
+
+/* BL_WRITE_MEM of Copy_Length bytes to Copy_Address and its Copy_Status, the length byte only counts in legacy frames */
+static uint16_t LOOPBACK_TestWrite(uint8_t Copy_HeaderLen,uint32_t Copy_Address,const uint8_t* Copy_Data,uint16_t Copy_Length,bool Copy_Status)
+{
+    LOOPBACK_TestRequest[Copy_HeaderLen]=BL_WRITE_MEM;
+    memcpy(&LOOPBACK_TestRequest[Copy_HeaderLen+1U], &Copy_Address, 4U);
+    LOOPBACK_TestRequest[Copy_HeaderLen+5U]=(uint8_t)Copy_Length;
+    memcpy(&LOOPBACK_TestRequest[Copy_HeaderLen+6U], Copy_Data, Copy_Length);
+    LOOPBACK_TestExpected[0]=BL_ACK;
+    LOOPBACK_TestExpected[1]=1U;
+    LOOPBACK_TestExpected[2]=Copy_Status;
+    LOOPBACK_TestExpectedLen=3U;
+    return LOOPBACK_TestFrame(Copy_HeaderLen, 6U+Copy_Length);
+}
+
+/* BL_STREAM_WRITE frame Copy_Seq to Copy_Address, empty to end the stream, and its ACK of Copy_Expected and Copy_Status */
+static uint16_t LOOPBACK_TestStream(uint16_t Copy_Seq,uint32_t Copy_Address,uint16_t Copy_Length,uint16_t Copy_Expected,uint8_t Copy_Status)
+{
+    LOOPBACK_TestRequest[1]=BL_STREAM_WRITE;
+    memcpy(&LOOPBACK_TestRequest[2], &Copy_Seq, 2U);
+    memcpy(&LOOPBACK_TestRequest[4], &Copy_Address, 4U);
+    LOOPBACK_TestRequest[8]=(uint8_t)Copy_Length;
+    memcpy(&LOOPBACK_TestRequest[9], &LOOPBACK_TestImage[Copy_Seq*LOOPBACK_TEST_STREAM_FRAME], Copy_Length);
+    LOOPBACK_TestExpected[0]=BL_ACK;
+    LOOPBACK_TestExpected[1]=3U;
+    LOOPBACK_TestExpected[2]=(uint8_t)Copy_Expected;
+    LOOPBACK_TestExpected[3]=(uint8_t)(Copy_Expected>>8);
+    LOOPBACK_TestExpected[4]=Copy_Status;
+    LOOPBACK_TestExpectedLen=5U;
+    return LOOPBACK_TestFrame(1U, 8U+Copy_Length);
+}
+
+/* BL_VERIFY_CRC of the tail range and its status, with the CRC of erased flash when it is BL_READ_OK */
+static uint16_t LOOPBACK_TestVerify(uint8_t Copy_Status)
+{
+    uint32_t Local_Value=FLASH_BASE+(LOOPBACK_TEST_TAIL_SECTOR*FLASH_SECTOR_SIZE);
+    uint8_t Local_Erased[LOOPBACK_TEST_TAIL];
+    LOOPBACK_TestRequest[1]=BL_VERIFY_CRC;
+    memcpy(&LOOPBACK_TestRequest[2], &Local_Value, 4U);
+    Local_Value=LOOPBACK_TEST_TAIL;
+    memcpy(&LOOPBACK_TestRequest[6], &Local_Value, 4U);
+    memset(Local_Erased, 0xFF, sizeof(Local_Erased));
+    Local_Value=(Copy_Status==BL_READ_OK) ? CRC32_Calculate(Local_Erased, sizeof(Local_Erased)) : 0U;
+    LOOPBACK_TestExpected[0]=BL_ACK;
+    LOOPBACK_TestExpected[1]=5U;
+    LOOPBACK_TestExpected[2]=Copy_Status;
+    memcpy(&LOOPBACK_TestExpected[3], &Local_Value, 4U);
+    LOOPBACK_TestExpectedLen=7U;
+    return LOOPBACK_TestFrame(1U, 9U);
+}
+
+/* Builds the frame and the expected reply of the current step */
+static void LOOPBACK_TestPrepare(void)
+{
+    uint32_t Local_Value=0U;
+    uint8_t Local_Erased[FLASH_SECTOR_SIZE];
+    LOOPBACK_TestSent=0U;
+    LOOPBACK_TestReceived=0U;
+    switch(LOOPBACK_TestStep)
+    {
+    case 0U:
+        LOOPBACK_TestRequest[0]=BL_WAKE_BYTE;
+        LOOPBACK_TestRequestLen=1U;
+        LOOPBACK_TestExpected[0]=BL_ACK;
+        LOOPBACK_TestExpectedLen=1U;
+        break;
+    case 1U:
+        LOOPBACK_TestRequest[1]=BL_GET_VER;
+        LOOPBACK_TestRequestLen=LOOPBACK_TestFrame(1U, 1U);
+        LOOPBACK_TestVersion();
+        break;
+    case 2U:
+        LOOPBACK_TestRequest[1]=BL_GET_VER;
+        LOOPBACK_TestRequestLen=LOOPBACK_TestFrame(1U, 1U);
+        LOOPBACK_TestRequest[LOOPBACK_TestRequestLen-1U]^=0x01U;
+        LOOPBACK_TestExpected[0]=BL_NACK;
+        LOOPBACK_TestExpectedLen=1U;
+        break;
+    case 3U:
+        /*Dropped without a look at its bytes*/
+        LOOPBACK_TestRequest[0]=BL_MIN_FRAME_LEN-1U;
+        memset(&LOOPBACK_TestRequest[1], BL_GET_VER, BL_MIN_FRAME_LEN-1U);
+        LOOPBACK_TestRequestLen=BL_MIN_FRAME_LEN;
+        LOOPBACK_TestExpected[0]=BL_NACK;
+        LOOPBACK_TestExpectedLen=1U;
+        break;
+    case 4U:
+        LOOPBACK_TestRequest[3]=BL_GET_VER;
+        LOOPBACK_TestRequestLen=LOOPBACK_TestFrame(BL_EXT_HEADER_LEN, 1U);
+        LOOPBACK_TestVersion();
+        break;
+    case 5U:
+        LOOPBACK_TestRequestLen=LOOPBACK_TestWrite(1U, LOOPBACK_TEST_ADDRESS, LOOPBACK_TestImage, LOOPBACK_TEST_WRITE, true);
+        break;
+    case 6U:
+        LOOPBACK_TestRequestLen=LOOPBACK_TestWrite(BL_EXT_HEADER_LEN, LOOPBACK_TEST_ADDRESS+LOOPBACK_TEST_WRITE, &LOOPBACK_TestImage[LOOPBACK_TEST_WRITE],
+                                                   LOOPBACK_TEST_EXT_WRITE, true);
+        break;
+    case 7U:
+        /*Both writes back in one chunk: ACK, state, then [LenLo][LenHi][Data][CRC32]*/
+        LOOPBACK_TestRequest[1]=BL_READ_MEM;
+        Local_Value=LOOPBACK_TEST_ADDRESS;
+        memcpy(&LOOPBACK_TestRequest[2], &Local_Value, 4U);
+        Local_Value=sizeof(LOOPBACK_TestImage);
+        memcpy(&LOOPBACK_TestRequest[6], &Local_Value, 4U);
+        LOOPBACK_TestRequestLen=LOOPBACK_TestFrame(1U, 9U);
+        LOOPBACK_TestExpected[0]=BL_ACK;
+        LOOPBACK_TestExpected[1]=1U;
+        LOOPBACK_TestExpected[2]=BL_READ_OK;
+        LOOPBACK_TestExpected[3]=(uint8_t)sizeof(LOOPBACK_TestImage);
+        LOOPBACK_TestExpected[4]=(uint8_t)(sizeof(LOOPBACK_TestImage)>>8);
+        memcpy(&LOOPBACK_TestExpected[5], LOOPBACK_TestImage, sizeof(LOOPBACK_TestImage));
+        Local_Value=CRC32_Calculate(&LOOPBACK_TestExpected[3], 2U+sizeof(LOOPBACK_TestImage));
+        memcpy(&LOOPBACK_TestExpected[5U+sizeof(LOOPBACK_TestImage)], &Local_Value, 4U);
+        LOOPBACK_TestExpectedLen=5U+sizeof(LOOPBACK_TestImage)+4U;
+        break;
+    case 8U:
+        LOOPBACK_TestRequestLen=LOOPBACK_TestStream(0U, LOOPBACK_TEST_STREAM, LOOPBACK_TEST_STREAM_FRAME, 1U, BL_PIPE_PASSED);
+        break;
+    case 9U:
+        LOOPBACK_TestRequestLen=LOOPBACK_TestStream(1U, FLASH_END_ADDRESS, LOOPBACK_TEST_STREAM_FRAME, 2U, BL_PIPE_FAILED);
+        break;
+    case 10U:
+        /*The host resends sequence 0 after a NACK or a timeout, the stream goes on with its failure*/
+        LOOPBACK_TestRequestLen=LOOPBACK_TestStream(0U, LOOPBACK_TEST_STREAM, LOOPBACK_TEST_STREAM_FRAME, 2U, BL_PIPE_FAILED);
+        break;
+    case 11U:
+        LOOPBACK_TestRequestLen=LOOPBACK_TestStream(2U, LOOPBACK_TEST_STREAM+(2U*LOOPBACK_TEST_STREAM_FRAME), LOOPBACK_TEST_STREAM_FRAME,
+                                                    3U, BL_PIPE_FAILED);
+        break;
+    case 12U:
+        LOOPBACK_TestRequestLen=LOOPBACK_TestStream(3U, 0U, 0U, 3U, BL_PIPE_FAILED);
+        break;
+    case 13U:
+        LOOPBACK_TestRequest[1]=BL_GET_SECTOR_CRC;
+        LOOPBACK_TestRequest[2]=LOOPBACK_TEST_CRC_SECTOR;
+        LOOPBACK_TestRequest[3]=1U;
+        LOOPBACK_TestRequestLen=LOOPBACK_TestFrame(1U, 3U);
+        memset(Local_Erased, 0xFF, sizeof(Local_Erased));
+        Local_Value=CRC32_Calculate(Local_Erased, sizeof(Local_Erased));
+        LOOPBACK_TestExpected[0]=BL_ACK;
+        LOOPBACK_TestExpected[1]=5U;
+        LOOPBACK_TestExpected[2]=BL_READ_OK;
+        memcpy(&LOOPBACK_TestExpected[3], &Local_Value, 4U);
+        LOOPBACK_TestExpectedLen=7U;
+        break;
+    case 14U:
+        /*The CRC of an execute only sector would reveal its content like a read back*/
+        FlashProtectSet(FLASH_BASE+(LOOPBACK_TEST_CRC_SECTOR*FLASH_SECTOR_SIZE), FlashExecuteOnly);
+        LOOPBACK_TestRequest[1]=BL_GET_SECTOR_CRC;
+        LOOPBACK_TestRequest[2]=LOOPBACK_TEST_CRC_SECTOR;
+        LOOPBACK_TestRequest[3]=1U;
+        LOOPBACK_TestRequestLen=LOOPBACK_TestFrame(1U, 3U);
+        LOOPBACK_TestExpected[0]=BL_ACK;
+        LOOPBACK_TestExpected[1]=1U;
+        LOOPBACK_TestExpected[2]=BL_READ_PROTECTED;
+        LOOPBACK_TestExpectedLen=3U;
+        break;
+    case 15U:
+    case 17U:
+        /*Other bytes over the image, the block is only programmed, and fails, once the sequence ends*/
+        LOOPBACK_TestRequestLen=LOOPBACK_TestWrite(1U, LOOPBACK_TEST_ADDRESS, &LOOPBACK_TestImage[1], LOOPBACK_TEST_TAIL, true);
+        break;
+    case 16U:
+        LOOPBACK_TestRequestLen=LOOPBACK_TestWrite(1U, LOOPBACK_TEST_ADDRESS, LOOPBACK_TestImage, 0U, false);
+        break;
+    case 18U:
+        /*Ends the sequence without its empty frame, the tail fails with no write left to report it*/
+        LOOPBACK_TestRequest[1]=BL_GET_VER;
+        LOOPBACK_TestRequestLen=LOOPBACK_TestFrame(1U, 1U);
+        LOOPBACK_TestVersion();
+        break;
+    case 19U:
+        /*A new sequence, the failure before it is not charged to its writes*/
+        LOOPBACK_TestRequestLen=LOOPBACK_TestWrite(1U, FLASH_BASE+(LOOPBACK_TEST_TAIL_SECTOR*FLASH_SECTOR_SIZE)+FLASH_SECTOR_SIZE/2U,
+                                                   LOOPBACK_TestImage, LOOPBACK_TEST_TAIL, true);
+        break;
+    case 20U:
+        LOOPBACK_TestRequestLen=LOOPBACK_TestWrite(1U, FLASH_BASE+(LOOPBACK_TEST_TAIL_SECTOR*FLASH_SECTOR_SIZE), LOOPBACK_TestImage, 0U, true);
+        break;
+    case 21U:
+        /*But the host is told before it checks the image*/
+        LOOPBACK_TestRequestLen=LOOPBACK_TestVerify(BL_READ_WRITE_FAILED);
+        break;
+    case 22U:
+        LOOPBACK_TestRequest[1]=BL_ERASE_FLASH;
+        LOOPBACK_TestRequest[2]=LOOPBACK_TEST_TAIL_SECTOR;
+        LOOPBACK_TestRequest[3]=1U;
+        LOOPBACK_TestRequestLen=LOOPBACK_TestFrame(1U, 3U);
+        LOOPBACK_TestExpected[0]=BL_ACK;
+        LOOPBACK_TestExpected[1]=2U;
+        LOOPBACK_TestExpected[2]=true;
+        LOOPBACK_TestExpected[3]=BL_SECTOR_ERASED;
+        LOOPBACK_TestExpectedLen=4U;
+        break;
+    case 23U:
+        /*The erase starts a new update*/
+        LOOPBACK_TestRequestLen=LOOPBACK_TestVerify(BL_READ_OK);
+        break;
+    default:
+        /*Answered on the link it came from*/
+        LOOPBACK_TestRequest[1]=BL_GET_STATS+1U;
+        LOOPBACK_TestRequestLen=LOOPBACK_TestFrame(1U, 1U);
+        LOOPBACK_TestExpected[0]=BL_NACK;
+        LOOPBACK_TestExpectedLen=1U;
+        break;
+    }
+}
+
+/* The host: a few bytes of the frame, whatever the bootloader replied, the next step once the reply is whole */
+static void LOOPBACK_TestFeed(void)
+{
+    uint16_t Local_Chunk=(uint16_t)((TEST_Random(&LOOPBACK_TestSeed)%LOOPBACK_TEST_MAX_CHUNK)+1U);
+    uint16_t Local_Moved=0U;
+    uint8_t Local_Extra=0U;
+    if(Local_Chunk>(LOOPBACK_TestRequestLen-LOOPBACK_TestSent))
+    {
+        Local_Chunk=LOOPBACK_TestRequestLen-LOOPBACK_TestSent;
+    }
+    Local_Moved=LOOPBACK_HostWrite(&LOOPBACK_TestRequest[LOOPBACK_TestSent], Local_Chunk);
+    LOOPBACK_TestSent+=Local_Moved;
+    Local_Chunk=(uint16_t)((TEST_Random(&LOOPBACK_TestSeed)%LOOPBACK_TEST_MAX_CHUNK)+1U);
+    if(Local_Chunk>(LOOPBACK_TestExpectedLen-LOOPBACK_TestReceived))
+    {
+        Local_Chunk=LOOPBACK_TestExpectedLen-LOOPBACK_TestReceived;
+    }
+    Local_Chunk=LOOPBACK_HostRead(&LOOPBACK_TestReply[LOOPBACK_TestReceived], Local_Chunk);
+    LOOPBACK_TestReceived+=Local_Chunk;
+    Local_Moved+=Local_Chunk;
+    LOOPBACK_TestIdle=(Local_Moved!=0U) ? 0U : (LOOPBACK_TestIdle+1U);
+    if((LOOPBACK_TestSent==LOOPBACK_TestRequestLen) && (LOOPBACK_TestReceived==LOOPBACK_TestExpectedLen))
+    {
+        if((memcmp(LOOPBACK_TestReply, LOOPBACK_TestExpected, LOOPBACK_TestExpectedLen)!=0) ||
+           (LOOPBACK_HostRead(&Local_Extra, 1U)!=0U))
+        {
+            printf("  %s: wrong reply\n", LOOPBACK_TestSteps[LOOPBACK_TestStep]);
+            TEST_Failures++;
+        }
+        LOOPBACK_TestStep++;
+        if(LOOPBACK_TestStep==LOOPBACK_TEST_STEPS)
+        {
+            /*The bootloader never returns, the script is over*/
+            exit(TEST_RESULT("LoopbackTest"));
+        }
+        LOOPBACK_TestPrepare();
+    }
+    else if(LOOPBACK_TestIdle>=LOOPBACK_TEST_STALL)
+    {
+        printf("  %s: sent %u of %u bytes, %u of %u reply bytes\n", LOOPBACK_TestSteps[LOOPBACK_TestStep],
+               (unsigned)LOOPBACK_TestSent, (unsigned)LOOPBACK_TestRequestLen, (unsigned)LOOPBACK_TestReceived, (unsigned)LOOPBACK_TestExpectedLen);
+        TEST_Failures++;
+        exit(TEST_RESULT("LoopbackTest"));
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+}
+
+int main(int argc,char** argv)
+{
+    uint16_t Local_Counter=0U;
+    for(Local_Counter=0U;Local_Counter<sizeof(LOOPBACK_TestImage);Local_Counter++)
+    {
+        LOOPBACK_TestImage[Local_Counter]=(uint8_t)TEST_Random(&LOOPBACK_TestSeed);
+    }
+    /*Erased flash of this run only, the pty of the UARTs stays unused*/
+    SIM_CoreInit(argc, argv);
+    SIM_FlashInit();
+    SIM_UartInit();
+    LOOPBACK_Init(LOOPBACK_TestToTarget, sizeof(LOOPBACK_TestToTarget), LOOPBACK_TestToHost, sizeof(LOOPBACK_TestToHost), LOOPBACK_TestFeed);
+    TRANSPORT_Init();
+    LOOPBACK_TestPrepare();
+    while(1)
+    {
+        BL_FetchHostCommand();
+    }
+}
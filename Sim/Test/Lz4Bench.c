@@ -0,0 +1,84 @@
+/*
+ * Lz4Bench.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Ratio and decode speed of Lz4Dec.c on a 64 KB sample of every kind of Lz4Enc.h, decoded into
+ *  1 KB outputs as BL_CompressedWrite hands over the staging buffer. The ratio is the one the link
+ *  gains with BL_COMPRESSED_WRITE, the decode speed on the host CPU only compares the samples with
+ *  each other, the cycles of the target come from BL_GET_STATS.
+ */
+#include "Test.h"
+#include "Lz4Enc.h"
+#include "Lz4Dec.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define LZ4_BENCH_CYCLES()      __rdtsc()
+#endif
+
+#define LZ4_BENCH_SIZE          (64UL*1024UL)
+#define LZ4_BENCH_OUTPUT        1024U
+#define LZ4_BENCH_TIME          0.2
+
+static uint8_t LZ4_BenchData[LZ4_BENCH_SIZE];
+static uint8_t LZ4_BenchStream[LZ4ENC_BOUND(LZ4_BENCH_SIZE)];
+static uint8_t LZ4_BenchOutput[LZ4_BENCH_OUTPUT];
+static LZ4DEC_t LZ4_BenchDecoder;
+/* Keeps the decoding from being optimized away */
+static volatile uint8_t LZ4_BenchSink=0U;
+
+/* Decodes the whole stream once */
+static void LZ4_BenchDecode(uint32_t Copy_Length)
+{
+    uint32_t Local_In=0U;
+    uint32_t Local_Consumed=0U;
+    uint32_t Local_Produced=0U;
+    LZ4DEC_Status_t Local_Status=LZ4DEC_OUTPUT_FULL;
+    LZ4DEC_Init(&LZ4_BenchDecoder);
+    while((Local_Status==LZ4DEC_OUTPUT_FULL) || ((Local_Status==LZ4DEC_NEED_INPUT) && (Local_In<Copy_Length)))
+    {
+        Local_Status=LZ4DEC_Decode(&LZ4_BenchDecoder, &LZ4_BenchStream[Local_In], Copy_Length-Local_In, &Local_Consumed,
+                                   LZ4_BenchOutput, LZ4_BENCH_OUTPUT, &Local_Produced);
+        Local_In+=Local_Consumed;
+        LZ4_BenchSink^=LZ4_BenchOutput[0];
+    }
+}
+
+int main(void)
+{
+    uint32_t Local_Sample=0U;
+    uint32_t Local_Stream=0U;
+    uint32_t Local_Rounds=0U;
+    double Local_Start=0.0;
+    double Local_Elapsed=0.0;
+#ifdef LZ4_BENCH_CYCLES
+    uint64_t Local_Cycles=0U;
+#endif
+    printf("%-8s %10s %8s %10s %12s\n", "sample", "stream", "ratio", "MB/s", "bytes/cycle");
+    for(Local_Sample=0U;Local_Sample<LZ4ENC_SAMPLES_NUM;Local_Sample++)
+    {
+        LZ4ENC_Sample((LZ4ENC_Sample_t)Local_Sample, LZ4_BenchData, LZ4_BENCH_SIZE, Local_Sample+1U);
+        Local_Stream=LZ4ENC_Compress(LZ4_BenchData, LZ4_BENCH_SIZE, LZ4_BenchStream);
+        Local_Rounds=0U;
+        Local_Start=TEST_Seconds();
+#ifdef LZ4_BENCH_CYCLES
+        Local_Cycles=LZ4_BENCH_CYCLES();
+#endif
+        do
+        {
+            LZ4_BenchDecode(Local_Stream);
+            Local_Rounds++;
+            Local_Elapsed=TEST_Seconds()-Local_Start;
+        }while(Local_Elapsed<LZ4_BENCH_TIME);
+        printf("%-8s %10u %8.2f %10.1f", LZ4ENC_SampleNames[Local_Sample], (unsigned)Local_Stream,
+               (double)LZ4_BENCH_SIZE/(double)Local_Stream, ((double)LZ4_BENCH_SIZE*(double)Local_Rounds)/(Local_Elapsed*1e6));
+#ifdef LZ4_BENCH_CYCLES
+        Local_Cycles=LZ4_BENCH_CYCLES()-Local_Cycles;
+        printf(" %12.3f\n", ((double)LZ4_BENCH_SIZE*(double)Local_Rounds)/(double)Local_Cycles);
+#else
+        printf(" %12s\n", "n/a");
+#endif
+    }
+    return 0;
+}
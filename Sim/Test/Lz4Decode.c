@@ -0,0 +1,41 @@
+/*
+ * Lz4Decode.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Decodes the LZ4 stream of stdin to stdout with Lz4Dec.c, in 61 byte inputs and 100 byte outputs
+ *  so the sequences straddle the calls. Exits with 1 when the stream is malformed or cut short.
+ *  Lz4RoundTrip.py feeds it the streams of Host.LZ4_Compress.
+ */
+#include <stdio.h>
+#include "Lz4Dec.h"
+
+#define LZ4_DECODE_INPUT        61U
+#define LZ4_DECODE_OUTPUT       100U
+
+static LZ4DEC_t LZ4_Decoder;
+
+int main(void)
+{
+    uint8_t Local_Input[LZ4_DECODE_INPUT];
+    uint8_t Local_Output[LZ4_DECODE_OUTPUT];
+    uint32_t Local_Length=0U;
+    uint32_t Local_In=0U;
+    uint32_t Local_Consumed=0U;
+    uint32_t Local_Produced=0U;
+    LZ4DEC_Status_t Local_Status=LZ4DEC_NEED_INPUT;
+    LZ4DEC_Init(&LZ4_Decoder);
+    while((Local_Status!=LZ4DEC_ERROR) && ((Local_Length=(uint32_t)fread(Local_Input, 1U, sizeof(Local_Input), stdin))!=0U))
+    {
+        Local_In=0U;
+        do
+        {
+            Local_Status=LZ4DEC_Decode(&LZ4_Decoder, &Local_Input[Local_In], Local_Length-Local_In, &Local_Consumed,
+                                       Local_Output, sizeof(Local_Output), &Local_Produced);
+            Local_In+=Local_Consumed;
+            fwrite(Local_Output, 1U, Local_Produced, stdout);
+        }while((Local_Status==LZ4DEC_OUTPUT_FULL) || ((Local_Status==LZ4DEC_NEED_INPUT) && (Local_In<Local_Length)));
+    }
+    return ((Local_Status!=LZ4DEC_ERROR) && (LZ4DEC_IsComplete(&LZ4_Decoder)==true)) ? 0 : 1;
+}
@@ -0,0 +1,209 @@
+/*
+ * Lz4Enc.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  See Lz4Enc.h.
+ */
+#include <string.h>
+#include "Test.h"
+#include "Lz4Enc.h"
+#include "Lz4Dec.h"
+
+#define LZ4ENC_HASH_BITS        12U
+#define LZ4ENC_MIN(A,B)         (((A)<(B)) ? (A) : (B))
+
+const char* const LZ4ENC_SampleNames[LZ4ENC_SAMPLES_NUM]={"random", "erased", "code", "tables", "image"};
+
+/* Position+1 of the last 4 bytes with this hash, 0 when none */
+static uint32_t LZ4ENC_Last[1U<<LZ4ENC_HASH_BITS];
+
+static uint32_t LZ4ENC_Hash(const uint8_t* Copy_Data)
+{
+    uint32_t Local_Word=(uint32_t)Copy_Data[0] | ((uint32_t)Copy_Data[1]<<8) | ((uint32_t)Copy_Data[2]<<16) | ((uint32_t)Copy_Data[3]<<24);
+    return (uint32_t)(Local_Word*2654435761UL)>>(32U-LZ4ENC_HASH_BITS);
+}
+
+static uint32_t LZ4ENC_EmitLength(uint8_t* Copy_Output,uint32_t Copy_Length)
+{
+    uint32_t Local_Out=0U;
+    while(Copy_Length>=255U)
+    {
+        Copy_Output[Local_Out++]=255U;
+        Copy_Length-=255U;
+    }
+    Copy_Output[Local_Out++]=(uint8_t)Copy_Length;
+    return Local_Out;
+}
+
+uint32_t LZ4ENC_Compress(const uint8_t* Copy_Input,uint32_t Copy_Length,uint8_t* Copy_Output)
+{
+    uint32_t Local_Out=0U;
+    uint32_t Local_Anchor=0U;
+    uint32_t Local_Position=0U;
+    uint32_t Local_Candidate=0U;
+    uint32_t Local_Match=0U;
+    uint32_t Local_Literals=0U;
+    uint32_t Local_Index=0U;
+    uint32_t Local_Hash=0U;
+    memset(LZ4ENC_Last, 0, sizeof(LZ4ENC_Last));
+    while((Local_Position+LZ4DEC_MIN_MATCH)<=Copy_Length)
+    {
+        Local_Hash=LZ4ENC_Hash(&Copy_Input[Local_Position]);
+        Local_Candidate=LZ4ENC_Last[Local_Hash];
+        LZ4ENC_Last[Local_Hash]=Local_Position+1U;
+        if((Local_Candidate==0U) || ((Local_Position-(Local_Candidate-1U))>=LZ4DEC_WINDOW_SIZE) ||
+           (memcmp(&Copy_Input[Local_Candidate-1U], &Copy_Input[Local_Position], LZ4DEC_MIN_MATCH)!=0))
+        {
+            Local_Position++;
+            continue;
+        }
+        Local_Candidate--;
+        Local_Match=LZ4DEC_MIN_MATCH;
+        while(((Local_Position+Local_Match)<Copy_Length) && (Copy_Input[Local_Candidate+Local_Match]==Copy_Input[Local_Position+Local_Match]))
+        {
+            Local_Match++;
+        }
+        Local_Literals=Local_Position-Local_Anchor;
+        Copy_Output[Local_Out++]=(uint8_t)((LZ4ENC_MIN(Local_Literals, 15U)<<4) | LZ4ENC_MIN(Local_Match-LZ4DEC_MIN_MATCH, 15U));
+        if(Local_Literals>=15U)
+        {
+            Local_Out+=LZ4ENC_EmitLength(&Copy_Output[Local_Out], Local_Literals-15U);
+        }
+        memcpy(&Copy_Output[Local_Out], &Copy_Input[Local_Anchor], Local_Literals);
+        Local_Out+=Local_Literals;
+        Copy_Output[Local_Out++]=(uint8_t)(Local_Position-Local_Candidate);
+        Copy_Output[Local_Out++]=(uint8_t)((Local_Position-Local_Candidate)>>8);
+        if((Local_Match-LZ4DEC_MIN_MATCH)>=15U)
+        {
+            Local_Out+=LZ4ENC_EmitLength(&Copy_Output[Local_Out], Local_Match-LZ4DEC_MIN_MATCH-15U);
+        }
+        /*Index the start of the match too, the rest is skipped for speed*/
+        for(Local_Index=Local_Position+1U;Local_Index<LZ4ENC_MIN(Local_Position+Local_Match, Copy_Length-3U);Local_Index+=((Local_Match/8U)!=0U) ? (Local_Match/8U) : 1U)
+        {
+            LZ4ENC_Last[LZ4ENC_Hash(&Copy_Input[Local_Index])]=Local_Index+1U;
+        }
+        Local_Position+=Local_Match;
+        Local_Anchor=Local_Position;
+    }
+    Local_Literals=Copy_Length-Local_Anchor;
+    Copy_Output[Local_Out++]=(uint8_t)(LZ4ENC_MIN(Local_Literals, 15U)<<4);
+    if(Local_Literals>=15U)
+    {
+        Local_Out+=LZ4ENC_EmitLength(&Copy_Output[Local_Out], Local_Literals-15U);
+    }
+    memcpy(&Copy_Output[Local_Out], &Copy_Input[Local_Anchor], Local_Literals);
+    return Local_Out+Local_Literals;
+}
+
+/* One Thumb instruction: a few opcodes with random register and immediate fields */
+static uint16_t LZ4ENC_Instruction(uint32_t* Copy_Seed)
+{
+    static const uint16_t Local_Opcodes[]={0x4600U, 0x6800U, 0x6000U, 0x2000U, 0x3000U, 0xB500U, 0xBD00U, 0xD000U,
+                                           0xF000U, 0x4400U, 0x1C00U, 0x2800U, 0x4280U, 0xE000U, 0x7800U, 0x9000U};
+    uint32_t Local_Random=TEST_Random(Copy_Seed);
+    return (uint16_t)(Local_Opcodes[Local_Random & 0x0FU] | ((Local_Random>>4) & 0x3FU));
+}
+
+/* Compiled code: 3 in 4 groups of 4 instructions are one of 16 idioms (prologue, load-modify-store,
+ * compare and branch...), the others are any instructions */
+static void LZ4ENC_Code(uint8_t* Copy_Data,uint32_t Copy_Length,uint32_t* Copy_Seed)
+{
+    uint16_t Local_Idioms[16][4];
+    uint16_t Local_Group[4];
+    uint32_t Local_Counter=0U;
+    uint32_t Local_Random=0U;
+    uint8_t Local_Slot=0U;
+    for(Local_Counter=0U;Local_Counter<(16U*4U);Local_Counter++)
+    {
+        Local_Idioms[Local_Counter/4U][Local_Counter%4U]=LZ4ENC_Instruction(Copy_Seed);
+    }
+    for(Local_Counter=0U;(Local_Counter+1U)<Copy_Length;Local_Counter+=2U)
+    {
+        Local_Slot=(uint8_t)((Local_Counter/2U)%4U);
+        if(Local_Slot==0U)
+        {
+            Local_Random=TEST_Random(Copy_Seed);
+            memcpy(Local_Group, Local_Idioms[(Local_Random>>2) & 0x0FU], sizeof(Local_Group));
+        }
+        if((Local_Random & 3U)==0U)
+        {
+            Local_Group[Local_Slot]=LZ4ENC_Instruction(Copy_Seed);
+        }
+        Copy_Data[Local_Counter]=(uint8_t)Local_Group[Local_Slot];
+        Copy_Data[Local_Counter+1U]=(uint8_t)(Local_Group[Local_Slot]>>8);
+    }
+    if((Copy_Length & 1U)!=0U)
+    {
+        Copy_Data[Copy_Length-1U]=0U;
+    }
+}
+
+/* 16 byte records: a counter, a field from a few constants, a random word now and then */
+static void LZ4ENC_Tables(uint8_t* Copy_Data,uint32_t Copy_Length,uint32_t* Copy_Seed)
+{
+    static const uint8_t Local_Fields[4][8]={{0x00U, 0x00U, 0x80U, 0x3FU, 0x00U, 0x00U, 0x00U, 0x00U},
+                                             {0x00U, 0x00U, 0x00U, 0x40U, 0x01U, 0x00U, 0x00U, 0x00U},
+                                             {0xDBU, 0x0FU, 0x49U, 0x40U, 0x02U, 0x00U, 0x00U, 0x00U},
+                                             {0x00U, 0x00U, 0x00U, 0x00U, 0xFFU, 0xFFU, 0x00U, 0x00U}};
+    uint32_t Local_Counter=0U;
+    uint32_t Local_Random=0U;
+    uint8_t Local_Record[16];
+    for(Local_Counter=0U;Local_Counter<Copy_Length;Local_Counter+=sizeof(Local_Record))
+    {
+        Local_Random=TEST_Random(Copy_Seed);
+        Local_Record[0]=(uint8_t)(Local_Counter>>4);
+        Local_Record[1]=(uint8_t)(Local_Counter>>12);
+        Local_Record[2]=0U;
+        Local_Record[3]=0U;
+        memcpy(&Local_Record[4], Local_Fields[Local_Random & 3U], 8U);
+        memset(&Local_Record[12], 0, 4U);
+        if((Local_Random & 0x30U)==0U)
+        {
+            Local_Random=TEST_Random(Copy_Seed);
+            memcpy(&Local_Record[12], &Local_Random, 4U);
+        }
+        memcpy(&Copy_Data[Local_Counter], Local_Record, LZ4ENC_MIN(sizeof(Local_Record), Copy_Length-Local_Counter));
+    }
+}
+
+void LZ4ENC_Sample(LZ4ENC_Sample_t Copy_Sample,uint8_t* Copy_Data,uint32_t Copy_Length,uint32_t Copy_Seed)
+{
+    uint32_t Local_Counter=0U;
+    uint32_t Local_Code=0U;
+    uint32_t Local_Tables=0U;
+    uint32_t Local_Vector=0U;
+    switch(Copy_Sample)
+    {
+    case LZ4ENC_RANDOM:
+        for(Local_Counter=0U;Local_Counter<Copy_Length;Local_Counter++)
+        {
+            Copy_Data[Local_Counter]=(uint8_t)TEST_Random(&Copy_Seed);
+        }
+        break;
+    case LZ4ENC_ERASED:
+        memset(Copy_Data, 0xFF, Copy_Length);
+        break;
+    case LZ4ENC_CODE:
+        LZ4ENC_Code(Copy_Data, Copy_Length, &Copy_Seed);
+        break;
+    case LZ4ENC_TABLES:
+        LZ4ENC_Tables(Copy_Data, Copy_Length, &Copy_Seed);
+        break;
+    default:
+        /*Vector table of thumb addresses, half code, a sixth tables, the rest erased*/
+        Local_Vector=LZ4ENC_MIN(0x26CU, Copy_Length) & ~3U;
+        for(Local_Counter=0U;Local_Counter<Local_Vector;Local_Counter+=4U)
+        {
+            Local_Code=0x00008201UL+((TEST_Random(&Copy_Seed) & 0x3FFU)*2U);
+            memcpy(&Copy_Data[Local_Counter], &Local_Code, 4U);
+        }
+        Local_Code=(Copy_Length-Local_Vector)/2U;
+        Local_Tables=(Copy_Length-Local_Vector)/6U;
+        LZ4ENC_Code(&Copy_Data[Local_Vector], Local_Code, &Copy_Seed);
+        LZ4ENC_Tables(&Copy_Data[Local_Vector+Local_Code], Local_Tables, &Copy_Seed);
+        memset(&Copy_Data[Local_Vector+Local_Code+Local_Tables], 0xFF, Copy_Length-Local_Vector-Local_Code-Local_Tables);
+        break;
+    }
+}
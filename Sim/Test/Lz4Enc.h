@@ -0,0 +1,38 @@
+/*
+ * Lz4Enc.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Greedy LZ4 block encoder of the LZ4 tests and benchmark, the C port of Host.LZ4_Compress: the same
+ *  sequences with offsets below LZ4DEC_WINDOW_SIZE, a hash of the last 4 bytes instead of the
+ *  dictionary of Host.py. Also the sample data the tests and the benchmark compress, shaped like an
+ *  application image.
+ */
+
+#ifndef LZ4ENC_H_
+#define LZ4ENC_H_
+
+#include <stdint.h>
+
+typedef enum
+{
+    LZ4ENC_RANDOM=0,        /* Nothing to compress */
+    LZ4ENC_ERASED,          /* All 0xFF */
+    LZ4ENC_CODE,            /* Instructions from a small set of opcodes and registers */
+    LZ4ENC_TABLES,          /* Constant tables repeating with small changes */
+    LZ4ENC_IMAGE,           /* Vector table, code, tables, then 0xFF padding up to the end */
+    LZ4ENC_SAMPLES_NUM
+}LZ4ENC_Sample_t;
+
+extern const char* const LZ4ENC_SampleNames[LZ4ENC_SAMPLES_NUM];
+
+/* Worst case of LZ4ENC_Compress for Copy_Length input bytes */
+#define LZ4ENC_BOUND(Length)    ((Length)+((Length)/255U)+16U)
+
+/* Returns the length of the stream written to Copy_Output */
+uint32_t LZ4ENC_Compress(const uint8_t* Copy_Input,uint32_t Copy_Length,uint8_t* Copy_Output);
+
+void LZ4ENC_Sample(LZ4ENC_Sample_t Copy_Sample,uint8_t* Copy_Data,uint32_t Copy_Length,uint32_t Copy_Seed);
+
+#endif /* LZ4ENC_H_ */
@@ -0,0 +1,54 @@
+''' Host.LZ4_Compress against the decoder of the bootloader: every stream the host sends with
+    BL_COMPRESSED_WRITE goes through Lz4Dec.c (build/test/Lz4Decode) and must come back unchanged.
+    The data covers the cases of the encoder: nothing to compress, long runs, repeats at the edge of
+    the window, matches running to the end.
+    Run by make -C Sim test.
+    Usage: python3 Lz4RoundTrip.py <build directory> '''
+import sys
+import os
+import random
+import subprocess
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..'))
+import Host
+
+Failures = 0
+
+def Sample_Data():
+    ''' Name and data of every round trip '''
+    Generator = random.Random(4)
+    Random_Bytes = bytes(Generator.getrandbits(8) for Index in range(8192))
+    Samples = [("empty", b''), ("one byte", b'\x5a'), ("four bytes", b'abcd'), ("random", Random_Bytes),
+               ("erased", b'\xff' * 65536), ("one byte run", b'\x00' * 300 + b'\x01'),
+               ("short repeats", b'abcabcabcabcabcabcXabc' * 100)]
+    ''' A block repeated at the farthest offset the encoder uses, then one past it '''
+    Block = Random_Bytes[:Host.BL_LZ4_WINDOW - 1]
+    Samples.append(("window - 1", Block + Block))
+    Samples.append(("window", Block + b'\x00' + Block))
+    Words = [b'MOV', b'LDR', b'STR', b'BL ', b'PUSH', b'POP', b'\x00\xbf', b'\x70\x47']
+    Samples.append(("code", b''.join(Generator.choice(Words) for Index in range(20000))))
+    return Samples
+
+def Round_Trip(Decoder, Name, Data):
+    global Failures
+    Stream = Host.LZ4_Compress(Data)
+    Result = subprocess.run([Decoder], input = Stream, stdout = subprocess.PIPE)
+    if((Result.returncode != 0) or (Result.stdout != Data)):
+        Failures = Failures + 1
+        print("  %s: decoded %d of %d bytes, exit %d" % (Name, len(Result.stdout), len(Data), Result.returncode))
+    else:
+        print("  %-14s %7d bytes, stream %7d bytes" % (Name, len(Data), len(Stream)))
+
+if(__name__ == "__main__"):
+    if(len(sys.argv) != 2):
+        sys.exit("Usage: python3 Lz4RoundTrip.py <build directory>")
+    Decoder = os.path.join(sys.argv[1], 'test', 'Lz4Decode')
+    for Name, Data in Sample_Data():
+        Round_Trip(Decoder, Name, Data)
+    ''' A stream cut short must not pass for a whole one '''
+    Stream = Host.LZ4_Compress(b'abcd' * 64 + b'tail of literals')
+    Result = subprocess.run([Decoder], input = Stream[:-1], stdout = subprocess.PIPE)
+    if(Result.returncode == 0):
+        Failures = Failures + 1
+        print("  truncated stream accepted")
+    print("Lz4RoundTrip: %s" % ("passed" if Failures == 0 else "FAILED"))
+    sys.exit(0 if Failures == 0 else 1)
@@ -0,0 +1,204 @@
+/*
+ * Lz4Test.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Lz4Dec.c on its own: hand made streams for the extended lengths and the overlapping matches,
+ *  round trips of the Lz4Enc.c streams of every sample decoded in random input chunks and output
+ *  sizes as BL_CompressedWrite does, matches at the edge of the window, the malformed streams that
+ *  must fail (offset 0, before the start, outside the window) and stay failed, the truncated ones,
+ *  and random garbage that must never write past the output. Lz4RoundTrip.py decodes the streams
+ *  of Host.LZ4_Compress.
+ */
+#include <string.h>
+#include "Test.h"
+#include "Lz4Enc.h"
+#include "Lz4Dec.h"
+
+#define LZ4_TEST_MAX            (64UL*1024UL)
+#define LZ4_TEST_GUARD          64U
+#define LZ4_TEST_GARBAGE        3000U
+
+static uint8_t LZ4_TestData[LZ4_TEST_MAX];
+static uint8_t LZ4_TestStream[LZ4ENC_BOUND(LZ4_TEST_MAX)];
+static uint8_t LZ4_TestOutput[LZ4_TEST_MAX+LZ4_TEST_GUARD];
+static LZ4DEC_t LZ4_TestDecoder;
+
+/* Decodes Copy_Stream in chunks of at most Copy_MaxIn bytes into outputs of at most Copy_MaxOut bytes,
+ * returns the decoded length or -1 on LZ4DEC_ERROR, never writes past Copy_OutputSize */
+static int32_t LZ4_TestDecode(const uint8_t* Copy_Stream,uint32_t Copy_Length,uint32_t Copy_OutputSize,
+                              uint32_t Copy_MaxIn,uint32_t Copy_MaxOut,uint32_t* Copy_Seed)
+{
+    int32_t Local_Result=0;
+    uint32_t Local_In=0U;
+    uint32_t Local_Out=0U;
+    uint32_t Local_Chunk=0U;
+    uint32_t Local_Space=0U;
+    uint32_t Local_Consumed=0U;
+    uint32_t Local_Produced=0U;
+    LZ4DEC_Status_t Local_Status=LZ4DEC_NEED_INPUT;
+    LZ4DEC_Init(&LZ4_TestDecoder);
+    while((Local_Status!=LZ4DEC_ERROR) && ((Local_In<Copy_Length) || (Local_Status==LZ4DEC_OUTPUT_FULL)) && (Local_Out<Copy_OutputSize))
+    {
+        Local_Chunk=(TEST_Random(Copy_Seed)%Copy_MaxIn)+1U;
+        Local_Chunk=(Local_Chunk>(Copy_Length-Local_In)) ? (Copy_Length-Local_In) : Local_Chunk;
+        Local_Space=(TEST_Random(Copy_Seed)%Copy_MaxOut)+1U;
+        Local_Space=(Local_Space>(Copy_OutputSize-Local_Out)) ? (Copy_OutputSize-Local_Out) : Local_Space;
+        Local_Status=LZ4DEC_Decode(&LZ4_TestDecoder, &Copy_Stream[Local_In], Local_Chunk, &Local_Consumed,
+                                   &LZ4_TestOutput[Local_Out], Local_Space, &Local_Produced);
+        TEST_CHECK((Local_Consumed<=Local_Chunk) && (Local_Produced<=Local_Space));
+        Local_In+=Local_Consumed;
+        Local_Out+=Local_Produced;
+    }
+    Local_Result=(Local_Status==LZ4DEC_ERROR) ? -1 : (int32_t)Local_Out;
+    return Local_Result;
+}
+
+static void LZ4_TestHandMade(void)
+{
+    static const uint8_t Local_Literals[]={0x50U, 'h', 'e', 'l', 'l', 'o'};
+    /*One literal, then a match of 4+15+5 at offset 1: a run of 25 bytes*/
+    static const uint8_t Local_Run[]={0x1FU, 'a', 0x01U, 0x00U, 0x05U};
+    /*"abc" then a match of 4+3 at offset 3 repeating it, then 2 literals*/
+    static const uint8_t Local_Repeat[]={0x33U, 'a', 'b', 'c', 0x03U, 0x00U, 0x20U, 'x', 'y'};
+    uint32_t Local_Seed=5U;
+    uint32_t Local_Counter=0U;
+    TEST_CHECK(LZ4_TestDecode(Local_Literals, sizeof(Local_Literals), LZ4_TEST_MAX, 1U, 1U, &Local_Seed)==5);
+    TEST_CHECK((memcmp(LZ4_TestOutput, "hello", 5U)==0) && (LZ4DEC_IsComplete(&LZ4_TestDecoder)==true));
+    /*Without the empty token of the end too*/
+    TEST_CHECK(LZ4_TestDecode(Local_Run, sizeof(Local_Run), LZ4_TEST_MAX, 2U, 3U, &Local_Seed)==25);
+    TEST_CHECK(LZ4DEC_IsComplete(&LZ4_TestDecoder)==true);
+    for(Local_Counter=0U;Local_Counter<25U;Local_Counter++)
+    {
+        TEST_CHECK(LZ4_TestOutput[Local_Counter]=='a');
+    }
+    TEST_CHECK(LZ4_TestDecode(Local_Repeat, sizeof(Local_Repeat), LZ4_TEST_MAX, 4U, 4U, &Local_Seed)==12);
+    TEST_CHECK(memcmp(LZ4_TestOutput, "abcabcabcaxy", 12U)==0);
+    /*300 literals: 15 in the token, then 255 and 30*/
+    LZ4_TestStream[0]=0xF0U;
+    LZ4_TestStream[1]=255U;
+    LZ4_TestStream[2]=30U;
+    LZ4ENC_Sample(LZ4ENC_RANDOM, &LZ4_TestStream[3], 300U, 9U);
+    TEST_CHECK(LZ4_TestDecode(LZ4_TestStream, 303U, LZ4_TEST_MAX, 7U, 50U, &Local_Seed)==300);
+    TEST_CHECK((memcmp(LZ4_TestOutput, &LZ4_TestStream[3], 300U)==0) && (LZ4DEC_IsComplete(&LZ4_TestDecoder)==true));
+}
+
+static void LZ4_TestRoundTrips(void)
+{
+    static const uint32_t Local_Lengths[]={0U, 1U, 4U, 5U, 15U, 16U, 300U, 1024U, 4099U, LZ4_TEST_MAX};
+    uint32_t Local_Seed=6U;
+    uint32_t Local_Sample=0U;
+    uint32_t Local_Length=0U;
+    uint32_t Local_Stream=0U;
+    int32_t Local_Decoded=0;
+    for(Local_Sample=0U;Local_Sample<LZ4ENC_SAMPLES_NUM;Local_Sample++)
+    {
+        for(Local_Length=0U;Local_Length<(sizeof(Local_Lengths)/sizeof(Local_Lengths[0]));Local_Length++)
+        {
+            LZ4ENC_Sample((LZ4ENC_Sample_t)Local_Sample, LZ4_TestData, Local_Lengths[Local_Length], Local_Sample+Local_Length);
+            Local_Stream=LZ4ENC_Compress(LZ4_TestData, Local_Lengths[Local_Length], LZ4_TestStream);
+            TEST_CHECK(Local_Stream<=LZ4ENC_BOUND(Local_Lengths[Local_Length]));
+            memset(LZ4_TestOutput, 0xA5, sizeof(LZ4_TestOutput));
+            /*Whole stream at once, then as the frames and the staging buffer of the bootloader cut it*/
+            Local_Decoded=LZ4_TestDecode(LZ4_TestStream, Local_Stream, LZ4_TEST_MAX, Local_Stream+1U, LZ4_TEST_MAX, &Local_Seed);
+            TEST_CHECK((Local_Decoded==(int32_t)Local_Lengths[Local_Length]) && (LZ4DEC_IsComplete(&LZ4_TestDecoder)==true));
+            TEST_CHECK(memcmp(LZ4_TestOutput, LZ4_TestData, Local_Lengths[Local_Length])==0);
+            Local_Decoded=LZ4_TestDecode(LZ4_TestStream, Local_Stream, LZ4_TEST_MAX, 200U, 1024U, &Local_Seed);
+            if((Local_Decoded!=(int32_t)Local_Lengths[Local_Length]) || (LZ4DEC_IsComplete(&LZ4_TestDecoder)==false) ||
+               (memcmp(LZ4_TestOutput, LZ4_TestData, Local_Lengths[Local_Length])!=0))
+            {
+                printf("  %s sample of %u bytes: FAILED\n", LZ4ENC_SampleNames[Local_Sample], (unsigned)Local_Lengths[Local_Length]);
+                TEST_Failures++;
+            }
+            TEST_CHECK(LZ4_TestOutput[LZ4_TEST_MAX]==0xA5U);
+        }
+    }
+}
+
+/* A window and one byte of literals, then a 4 byte match Copy_Offset back */
+static uint32_t LZ4_TestFarMatch(uint16_t Copy_Offset)
+{
+    uint32_t Local_Out=0U;
+    uint32_t Local_Length=LZ4DEC_WINDOW_SIZE+1U-15U;
+    LZ4_TestStream[Local_Out++]=0xF0U;
+    for( ;Local_Length>=255U;Local_Length-=255U)
+    {
+        LZ4_TestStream[Local_Out++]=255U;
+    }
+    LZ4_TestStream[Local_Out++]=(uint8_t)Local_Length;
+    LZ4ENC_Sample(LZ4ENC_RANDOM, &LZ4_TestStream[Local_Out], LZ4DEC_WINDOW_SIZE+1U, 11U);
+    memcpy(LZ4_TestData, &LZ4_TestStream[Local_Out], LZ4DEC_WINDOW_SIZE+1U);
+    Local_Out+=LZ4DEC_WINDOW_SIZE+1U;
+    LZ4_TestStream[Local_Out++]=(uint8_t)Copy_Offset;
+    LZ4_TestStream[Local_Out++]=(uint8_t)(Copy_Offset>>8);
+    return Local_Out;
+}
+
+static void LZ4_TestMalformed(void)
+{
+    static const uint8_t Local_OffsetZero[]={0x10U, 'a', 0x00U, 0x00U};
+    static const uint8_t Local_BeforeStart[]={0x10U, 'a', 0x02U, 0x00U};
+    uint32_t Local_Seed=7U;
+    uint32_t Local_Stream=0U;
+    uint32_t Local_Consumed=0U;
+    uint32_t Local_Produced=0U;
+    uint32_t Local_Counter=0U;
+    TEST_CHECK(LZ4_TestDecode(Local_OffsetZero, sizeof(Local_OffsetZero), LZ4_TEST_MAX, 4U, 16U, &Local_Seed)==-1);
+    TEST_CHECK(LZ4_TestDecode(Local_BeforeStart, sizeof(Local_BeforeStart), LZ4_TEST_MAX, 4U, 16U, &Local_Seed)==-1);
+    /*A failed stream stays failed*/
+    TEST_CHECK(LZ4DEC_Decode(&LZ4_TestDecoder, (const uint8_t*)"\x10" "a", 2U, &Local_Consumed, LZ4_TestOutput, 16U, &Local_Produced)==LZ4DEC_ERROR);
+    TEST_CHECK((Local_Produced==0U) && (LZ4DEC_IsComplete(&LZ4_TestDecoder)==false));
+    /*The oldest byte of the window is the farthest a match can reach, even with more decoded before it*/
+    Local_Stream=LZ4_TestFarMatch(LZ4DEC_WINDOW_SIZE);
+    TEST_CHECK(LZ4_TestDecode(LZ4_TestStream, Local_Stream, LZ4_TEST_MAX, 97U, 300U, &Local_Seed)==(int32_t)(LZ4DEC_WINDOW_SIZE+5U));
+    TEST_CHECK(memcmp(&LZ4_TestOutput[LZ4DEC_WINDOW_SIZE+1U], &LZ4_TestData[1], 4U)==0);
+    Local_Stream=LZ4_TestFarMatch(LZ4DEC_WINDOW_SIZE+1U);
+    TEST_CHECK(LZ4_TestDecode(LZ4_TestStream, Local_Stream, LZ4_TEST_MAX, 97U, 300U, &Local_Seed)==-1);
+    /*A stream cut short decodes short, cut inside a sequence it isn't complete either. The tail doesn't
+     *compress: a stream ending on a match ends on an empty token, cut off it goes unnoticed*/
+    LZ4ENC_Sample(LZ4ENC_TABLES, LZ4_TestData, 4096U, 12U);
+    LZ4ENC_Sample(LZ4ENC_RANDOM, &LZ4_TestData[4096U-16U], 16U, 13U);
+    Local_Stream=LZ4ENC_Compress(LZ4_TestData, 4096U, LZ4_TestStream);
+    for(Local_Counter=1U;Local_Counter<Local_Stream;Local_Counter+=37U)
+    {
+        TEST_CHECK(LZ4_TestDecode(LZ4_TestStream, Local_Counter, LZ4_TEST_MAX, 64U, 1024U, &Local_Seed)<4096);
+    }
+    TEST_CHECK(LZ4_TestDecode(LZ4_TestStream, 1U, LZ4_TEST_MAX, 1U, 1U, &Local_Seed)==0);
+    TEST_CHECK(LZ4DEC_IsComplete(&LZ4_TestDecoder)==false);
+    TEST_CHECK(LZ4_TestDecode(LZ4_TestStream, Local_Stream-1U, LZ4_TEST_MAX, 64U, 1024U, &Local_Seed)<4096);
+}
+
+static void LZ4_TestGarbage(void)
+{
+    uint32_t Local_Seed=8U;
+    uint32_t Local_Round=0U;
+    uint32_t Local_Length=0U;
+    uint32_t Local_Limit=0U;
+    uint32_t Local_Failed=0U;
+    for(Local_Round=0U;Local_Round<LZ4_TEST_GARBAGE;Local_Round++)
+    {
+        Local_Length=(TEST_Random(&Local_Seed)%200U)+1U;
+        Local_Limit=(TEST_Random(&Local_Seed)%4096U)+1U;
+        LZ4ENC_Sample(LZ4ENC_RANDOM, LZ4_TestStream, Local_Length, Local_Round);
+        memset(LZ4_TestOutput, 0xA5, Local_Limit+LZ4_TEST_GUARD);
+        if(LZ4_TestDecode(LZ4_TestStream, Local_Length, Local_Limit, 16U, 512U, &Local_Seed)<0)
+        {
+            Local_Failed++;
+        }
+        for(Local_Length=0U;Local_Length<LZ4_TEST_GUARD;Local_Length++)
+        {
+            TEST_CHECK(LZ4_TestOutput[Local_Limit+Local_Length]==0xA5U);
+        }
+    }
+    printf("  %u random streams, %u rejected\n", (unsigned)LZ4_TEST_GARBAGE, (unsigned)Local_Failed);
+}
+
+int main(void)
+{
+    LZ4_TestHandMade();
+    LZ4_TestRoundTrips();
+    LZ4_TestMalformed();
+    LZ4_TestGarbage();
+    return TEST_RESULT("Lz4Test");
+}
@@ -0,0 +1,144 @@
+/*
+ * RingBufferTest.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  RingBuffer.c on its own first (empty, full, wrap of the masked and of the 16-bit indices,
+ *  partial block transfers), then a producer and a consumer thread moving a numbered byte
+ *  stream through a small ring with random mixes of single bytes and blocks, as the UART ISR
+ *  and the main loop do. The consumer checks that every byte arrives once and in order.
+ *  The test build defines RINGBUFFER_BARRIER as a fence, the two threads may run on two cores.
+ */
+#include <pthread.h>
+#include <sched.h>
+#include "Test.h"
+#include "RingBuffer.h"
+
+#define RINGBUFFER_TEST_SIZE    64U
+#define RINGBUFFER_TEST_BYTES   4000000UL
+
+static uint8_t RingBuffer_TestStorage[RINGBUFFER_TEST_SIZE];
+static RingBuffer_t RingBuffer_TestRing;
+
+static void* RingBuffer_Producer(void* Copy_Arg)
+{
+    uint32_t Local_Seed=2U;
+    uint32_t Local_Sent=0U;
+    uint16_t Local_Length=0U;
+    uint16_t Local_Counter=0U;
+    uint8_t Local_Block[RINGBUFFER_TEST_SIZE];
+    (void)Copy_Arg;
+    while(Local_Sent<RINGBUFFER_TEST_BYTES)
+    {
+        if((TEST_Random(&Local_Seed) & 1U)!=0U)
+        {
+            if(RingBuffer_Put(&RingBuffer_TestRing, (uint8_t)Local_Sent)==true)
+            {
+                Local_Sent++;
+            }
+        }
+        else
+        {
+            Local_Length=(uint16_t)(TEST_Random(&Local_Seed)%RINGBUFFER_TEST_SIZE)+1U;
+            for(Local_Counter=0U;Local_Counter<Local_Length;Local_Counter++)
+            {
+                Local_Block[Local_Counter]=(uint8_t)(Local_Sent+Local_Counter);
+            }
+            if((RINGBUFFER_TEST_BYTES-Local_Sent)<Local_Length)
+            {
+                Local_Length=(uint16_t)(RINGBUFFER_TEST_BYTES-Local_Sent);
+            }
+            Local_Sent+=RingBuffer_Write(&RingBuffer_TestRing, Local_Block, Local_Length);
+        }
+        if(RingBuffer_Free(&RingBuffer_TestRing)==0U)
+        {
+            /*Let the consumer run on a single core host*/
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void RingBuffer_Consume(void)
+{
+    uint32_t Local_Seed=3U;
+    uint32_t Local_Received=0U;
+    uint32_t Local_Errors=0U;
+    uint16_t Local_Length=0U;
+    uint16_t Local_Counter=0U;
+    uint8_t Local_Block[RINGBUFFER_TEST_SIZE];
+    while(Local_Received<RINGBUFFER_TEST_BYTES)
+    {
+        if(RingBuffer_Count(&RingBuffer_TestRing)==0U)
+        {
+            sched_yield();
+        }
+        if((TEST_Random(&Local_Seed) & 1U)!=0U)
+        {
+            Local_Length=RingBuffer_Get(&RingBuffer_TestRing, Local_Block) ? 1U : 0U;
+        }
+        else
+        {
+            Local_Length=(uint16_t)(TEST_Random(&Local_Seed)%RINGBUFFER_TEST_SIZE)+1U;
+            Local_Length=RingBuffer_Read(&RingBuffer_TestRing, Local_Block, Local_Length);
+        }
+        for(Local_Counter=0U;Local_Counter<Local_Length;Local_Counter++)
+        {
+            if(Local_Block[Local_Counter]!=(uint8_t)Local_Received)
+            {
+                Local_Errors++;
+            }
+            Local_Received++;
+        }
+    }
+    TEST_CHECK(Local_Errors==0U);
+    TEST_CHECK(RingBuffer_Count(&RingBuffer_TestRing)==0U);
+}
+
+int main(void)
+{
+    uint8_t Local_Byte=0U;
+    uint16_t Local_Counter=0U;
+    uint8_t Local_Data[RINGBUFFER_TEST_SIZE*2U];
+    pthread_t Local_Thread;
+    RingBuffer_Init(&RingBuffer_TestRing, RingBuffer_TestStorage, RINGBUFFER_TEST_SIZE);
+    /*Empty*/
+    TEST_CHECK(RingBuffer_Count(&RingBuffer_TestRing)==0U);
+    TEST_CHECK(RingBuffer_Free(&RingBuffer_TestRing)==RINGBUFFER_TEST_SIZE);
+    TEST_CHECK(RingBuffer_Get(&RingBuffer_TestRing, &Local_Byte)==false);
+    TEST_CHECK(RingBuffer_Read(&RingBuffer_TestRing, Local_Data, 4U)==0U);
+    /*Full, all the slots are usable*/
+    for(Local_Counter=0U;Local_Counter<RINGBUFFER_TEST_SIZE;Local_Counter++)
+    {
+        TEST_CHECK(RingBuffer_Put(&RingBuffer_TestRing, (uint8_t)Local_Counter)==true);
+    }
+    TEST_CHECK(RingBuffer_Put(&RingBuffer_TestRing, 0xAAU)==false);
+    TEST_CHECK(RingBuffer_Write(&RingBuffer_TestRing, Local_Data, 1U)==0U);
+    TEST_CHECK(RingBuffer_Free(&RingBuffer_TestRing)==0U);
+    TEST_CHECK((RingBuffer_Get(&RingBuffer_TestRing, &Local_Byte)==true) && (Local_Byte==0U));
+    /*Partial block transfers across the end of the storage*/
+    for(Local_Counter=0U;Local_Counter<sizeof(Local_Data);Local_Counter++)
+    {
+        Local_Data[Local_Counter]=(uint8_t)(Local_Counter+RINGBUFFER_TEST_SIZE);
+    }
+    TEST_CHECK(RingBuffer_Write(&RingBuffer_TestRing, Local_Data, 10U)==1U);
+    TEST_CHECK(RingBuffer_Read(&RingBuffer_TestRing, Local_Data, sizeof(Local_Data))==RINGBUFFER_TEST_SIZE);
+    for(Local_Counter=0U;Local_Counter<RINGBUFFER_TEST_SIZE;Local_Counter++)
+    {
+        TEST_CHECK(Local_Data[Local_Counter]==(uint8_t)(Local_Counter+1U));
+    }
+    /*The free running indices wrap at 65536*/
+    for(Local_Counter=0U;Local_Counter<2000U;Local_Counter++)
+    {
+        TEST_CHECK(RingBuffer_Write(&RingBuffer_TestRing, Local_Data, 50U)==50U);
+        TEST_CHECK(RingBuffer_Read(&RingBuffer_TestRing, Local_Data, 50U)==50U);
+    }
+    TEST_CHECK(RingBuffer_Count(&RingBuffer_TestRing)==0U);
+    /*Producer and consumer on two threads*/
+    RingBuffer_Init(&RingBuffer_TestRing, RingBuffer_TestStorage, RINGBUFFER_TEST_SIZE);
+    TEST_CHECK(pthread_create(&Local_Thread, NULL, RingBuffer_Producer, NULL)==0);
+    RingBuffer_Consume();
+    pthread_join(Local_Thread, NULL);
+    return TEST_RESULT("RingBufferTest");
+}
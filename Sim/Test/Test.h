@@ -0,0 +1,43 @@
+/*
+ * Test.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Host tests and benchmarks of the target modules, built by Sim/Makefile (make test, make bench).
+ *  A test is a program that reports every failed check and exits with 1 when one failed.
+ *  The benchmarks measure host time, they compare the alternatives of a module with each other,
+ *  the cycle counts on the target come from BL_GET_STATS.
+ */
+
+#ifndef TEST_H_
+#define TEST_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+static uint32_t TEST_Failures __attribute__((unused))=0U;
+
+#define TEST_CHECK(Cond)        do { if(!(Cond)) { TEST_Failures++; \
+                                     printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #Cond); } } while(0)
+
+/* Exit status of the test */
+#define TEST_RESULT(Name)       (printf("%s: %s\n", (Name), (TEST_Failures==0U) ? "passed" : "FAILED"), \
+                                 (TEST_Failures==0U) ? 0 : 1)
+
+/* Deterministic data, the same on every run */
+static inline uint32_t TEST_Random(uint32_t* Copy_State)
+{
+    *Copy_State=(*Copy_State*1103515245UL)+12345UL;
+    return *Copy_State>>8;
+}
+
+static inline double TEST_Seconds(void)
+{
+    struct timespec Local_Time;
+    clock_gettime(CLOCK_MONOTONIC, &Local_Time);
+    return (double)Local_Time.tv_sec+((double)Local_Time.tv_nsec*1e-9);
+}
+
+#endif /* TEST_H_ */
@@ -0,0 +1,125 @@
+/*
+ * UartBaudTest.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  UartBaud.c on its own: the divisor of every standard rate at the clocks of the board against
+ *  the rounding of UARTConfigSetExpClk and the baud rate it really gives, the refused rates (zero,
+ *  above Clock/8, IBRD out of range), then the switch / ping / fallback state machine. Test/BaudTest.py
+ *  runs the same negotiation with Host.py against the simulator.
+ */
+#include "Test.h"
+#include "UartBaud.h"
+
+/* The divisor of TivaWare UARTConfigSetExpClk */
+static bool UARTBAUD_Reference(uint32_t Copy_Clock,uint32_t Copy_Baud,UARTBAUD_Divisor_t* Copy_Divisor)
+{
+    uint32_t Local_Baud=Copy_Baud;
+    double Local_Actual=0.0;
+    double Local_Error=0.0;
+    Copy_Divisor->HighSpeed=((Copy_Baud*16U)>Copy_Clock);
+    if(Copy_Divisor->HighSpeed==true)
+    {
+        Local_Baud/=2U;
+    }
+    Copy_Divisor->Divisor=(((Copy_Clock*8U)/Local_Baud)+1U)/2U;
+    /*Clock / (oversampling * (IBRD + FBRD / 64))*/
+    Local_Actual=((double)Copy_Clock*64.0)/((Copy_Divisor->HighSpeed ? 8.0 : 16.0)*(double)Copy_Divisor->Divisor);
+    Local_Error=((Local_Actual>Copy_Baud) ? (Local_Actual-Copy_Baud) : (Copy_Baud-Local_Actual))*1e6/(double)Copy_Baud;
+    Copy_Divisor->ActualBaud=(uint32_t)Local_Actual;
+    Copy_Divisor->ErrorPpm=(uint32_t)Local_Error;
+    return ((Copy_Baud*8U)<=Copy_Clock) && ((Copy_Divisor->Divisor>>6)!=0U) && ((Copy_Divisor->Divisor>>6)<=0xFFFFU) &&
+           (Local_Error<=(double)UARTBAUD_MAX_ERROR_PPM);
+}
+
+static void UARTBAUD_TestDivisors(void)
+{
+    static const uint32_t Local_Clocks[]={16000000UL, 40000000UL, 50000000UL, 66666666UL, 80000000UL};
+    static const uint32_t Local_Bauds[]={300UL, 1200UL, 9600UL, 19200UL, 38400UL, 57600UL, 115200UL, 230400UL,
+                                         460800UL, 500000UL, 921600UL, 1000000UL, 1500000UL, 2000000UL,
+                                         3000000UL, 4000000UL, 5000000UL, 6250000UL, 8000000UL, 10000000UL};
+    uint8_t Local_Clock=0U;
+    uint8_t Local_Baud=0U;
+    bool Local_State=false;
+    uint32_t Local_Margin=0U;
+    UARTBAUD_Divisor_t Local_Divisor;
+    UARTBAUD_Divisor_t Local_Expected;
+    for(Local_Clock=0U;Local_Clock<(sizeof(Local_Clocks)/sizeof(Local_Clocks[0]));Local_Clock++)
+    {
+        for(Local_Baud=0U;Local_Baud<(sizeof(Local_Bauds)/sizeof(Local_Bauds[0]));Local_Baud++)
+        {
+            Local_State=UARTBAUD_Calculate(Local_Clocks[Local_Clock], Local_Bauds[Local_Baud], &Local_Divisor);
+            if(Local_State!=UARTBAUD_Reference(Local_Clocks[Local_Clock], Local_Bauds[Local_Baud], &Local_Expected))
+            {
+                printf("  %lu baud at %lu Hz: %s\n", (unsigned long)Local_Bauds[Local_Baud],
+                       (unsigned long)Local_Clocks[Local_Clock], Local_State ? "accepted" : "refused");
+                TEST_Failures++;
+            }
+            else if(Local_State==true)
+            {
+                TEST_CHECK(Local_Divisor.Divisor==Local_Expected.Divisor);
+                TEST_CHECK(Local_Divisor.HighSpeed==Local_Expected.HighSpeed);
+                /*The actual rate is rounded down to a whole baud, so is the error on slow rates*/
+                Local_Margin=(1000000UL/Local_Bauds[Local_Baud])+1U;
+                TEST_CHECK((Local_Divisor.ActualBaud+1U>=Local_Expected.ActualBaud) && (Local_Divisor.ActualBaud<=Local_Expected.ActualBaud+1U));
+                TEST_CHECK((Local_Divisor.ErrorPpm+Local_Margin>=Local_Expected.ErrorPpm) && (Local_Divisor.ErrorPpm<=Local_Expected.ErrorPpm+Local_Margin));
+            }
+            else
+            {
+                /*Do Nothing*/
+            }
+        }
+    }
+    /*Figures of the datasheet: IBRD 43 FBRD 26 at 80 MHz, IBRD 8 FBRD 44 at 16 MHz*/
+    TEST_CHECK((UARTBAUD_Calculate(80000000UL, 115200UL, &Local_Divisor)==true) && (Local_Divisor.Divisor==((43U<<6)|26U)) && (Local_Divisor.HighSpeed==false));
+    TEST_CHECK((UARTBAUD_Calculate(16000000UL, 115200UL, &Local_Divisor)==true) && (Local_Divisor.Divisor==((8U<<6)|44U)));
+    /*Clock/8 is the fastest rate, with HSE and IBRD 1*/
+    TEST_CHECK((UARTBAUD_Calculate(80000000UL, 10000000UL, &Local_Divisor)==true) && (Local_Divisor.Divisor==(1U<<6)) &&
+               (Local_Divisor.HighSpeed==true) && (Local_Divisor.ActualBaud==10000000UL) && (Local_Divisor.ErrorPpm==0U));
+    TEST_CHECK(UARTBAUD_Calculate(80000000UL, 10000001UL, &Local_Divisor)==false);
+    TEST_CHECK(UARTBAUD_Calculate(80000000UL, 0UL, &Local_Divisor)==false);
+    /*IBRD is 16 bits wide*/
+    TEST_CHECK(UARTBAUD_Calculate(16000000UL, 16UL, &Local_Divisor)==true);
+    TEST_CHECK(UARTBAUD_Calculate(16000000UL, 15UL, &Local_Divisor)==false);
+}
+
+static void UARTBAUD_TestSession(void)
+{
+    uint32_t Local_Counter=0U;
+    UARTBAUD_Session_t Local_Session={UARTBAUD_IDLE, 115200UL, 0UL, 0UL};
+    TEST_CHECK(UARTBAUD_ActiveBaud(&Local_Session)==115200UL);
+    /*The ping confirms the new rate, the noise of the switch over doesn't*/
+    UARTBAUD_Start(&Local_Session, 115200UL, 921600UL, 10U);
+    TEST_CHECK(UARTBAUD_ActiveBaud(&Local_Session)==921600UL);
+    TEST_CHECK(UARTBAUD_OnByte(&Local_Session, 0x00U)==UARTBAUD_WAIT_PING);
+    TEST_CHECK(UARTBAUD_OnByte(&Local_Session, UARTBAUD_PONG)==UARTBAUD_WAIT_PING);
+    TEST_CHECK(UARTBAUD_OnTick(&Local_Session)==UARTBAUD_WAIT_PING);
+    TEST_CHECK(UARTBAUD_OnByte(&Local_Session, UARTBAUD_PING)==UARTBAUD_CONFIRMED);
+    for(Local_Counter=0U;Local_Counter<20U;Local_Counter++)
+    {
+        TEST_CHECK(UARTBAUD_OnTick(&Local_Session)==UARTBAUD_CONFIRMED);
+    }
+    TEST_CHECK(UARTBAUD_ActiveBaud(&Local_Session)==921600UL);
+    /*No ping within the timeout: back to the old rate, a late ping doesn't change it*/
+    UARTBAUD_Start(&Local_Session, 115200UL, 2000000UL, 5U);
+    for(Local_Counter=0U;Local_Counter<4U;Local_Counter++)
+    {
+        TEST_CHECK(UARTBAUD_OnTick(&Local_Session)==UARTBAUD_WAIT_PING);
+    }
+    TEST_CHECK(UARTBAUD_OnTick(&Local_Session)==UARTBAUD_FALLBACK);
+    TEST_CHECK(UARTBAUD_ActiveBaud(&Local_Session)==115200UL);
+    TEST_CHECK(UARTBAUD_OnByte(&Local_Session, UARTBAUD_PING)==UARTBAUD_FALLBACK);
+    TEST_CHECK(UARTBAUD_OnTick(&Local_Session)==UARTBAUD_FALLBACK);
+    /*A zero timeout falls back on the first tick*/
+    UARTBAUD_Start(&Local_Session, 921600UL, 115200UL, 0U);
+    TEST_CHECK(UARTBAUD_OnTick(&Local_Session)==UARTBAUD_FALLBACK);
+    TEST_CHECK(UARTBAUD_ActiveBaud(&Local_Session)==921600UL);
+}
+
+int main(void)
+{
+    UARTBAUD_TestDivisors();
+    UARTBAUD_TestSession();
+    return TEST_RESULT("UartBaudTest");
+}
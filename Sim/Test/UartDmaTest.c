@@ -0,0 +1,95 @@
+/*
+ * UartDmaTest.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  DMA receive path of Uart.c against the fake DMA engine: the host sends a length byte, the body
+ *  and the next frame back to back, as Host.py does. The length byte comes through the ring, the
+ *  body arrives in the caller buffer, split in UARTDMA_MAX_TRANSFER chunks when longer, whatever
+ *  part of it the ring already held, and the following bytes go to the ring again.
+ */
+#include <string.h>
+#include "Test.h"
+#include "FakeUart.h"
+#include "Uart.h"
+
+#define UARTDMA_TEST_MAX        3000U
+/* Bytes of the body already in the ring when the receive starts */
+#define UARTDMA_TEST_EARLY_MAX  40U
+
+static uint8_t UARTDMA_TestWire[1U+UARTDMA_TEST_MAX+UARTDMA_TEST_EARLY_MAX+16U];
+static uint8_t UARTDMA_TestBody[UARTDMA_TEST_MAX];
+
+/* One frame, returns false when the body isn't received as sent */
+static bool UARTDMA_TestFrame(uint16_t Copy_Length,uint16_t Copy_Early,uint32_t* Copy_Seed)
+{
+    bool Local_State=true;
+    uint32_t Local_Counter=0U;
+    uint32_t Local_Wire=1U+Copy_Length+16U;
+    uint8_t Local_Byte=0U;
+    uint8_t Local_Tail[16];
+    uint32_t Local_Arms=FAKE_UartStats.DmaArms;
+    for(Local_Counter=0U;Local_Counter<Local_Wire;Local_Counter++)
+    {
+        UARTDMA_TestWire[Local_Counter]=(uint8_t)TEST_Random(Copy_Seed);
+    }
+    memset(UARTDMA_TestBody, 0, sizeof(UARTDMA_TestBody));
+    FAKE_UartScript(UARTDMA_TestWire, Local_Wire);
+    /*The length byte, then the start of the body reaches the ring before the receive is armed*/
+    FAKE_UartRun(1U+Copy_Early);
+    Local_State&=(UART_ReadBytes(UART_0, &Local_Byte, 1U)==1U) && (Local_Byte==UARTDMA_TestWire[0]);
+    UART_StartReceive(UART_0, UARTDMA_TestBody, Copy_Length);
+    while((Local_State==true) && (UART_IsReceiveComplete(UART_0)==false))
+    {
+        /*Running out of script before the end of the body is a failure*/
+        Local_State=(FAKE_UartRun(3U)!=0U);
+    }
+    Local_State&=(memcmp(UARTDMA_TestBody, &UARTDMA_TestWire[1], Copy_Length)==0);
+    /*The body past the early bytes went by DMA, in chunks of at most UARTDMA_MAX_TRANSFER*/
+    if(Copy_Length>Copy_Early)
+    {
+        Local_State&=((FAKE_UartStats.DmaArms-Local_Arms)==(((Copy_Length-Copy_Early)+UARTDMA_MAX_TRANSFER-1U)/UARTDMA_MAX_TRANSFER));
+    }
+    /*The next frame is back in the ring*/
+    FAKE_UartRun(FAKE_UartPending());
+    Local_State&=(UART_ReadBytes(UART_0, Local_Tail, sizeof(Local_Tail))==sizeof(Local_Tail));
+    Local_State&=(memcmp(Local_Tail, &UARTDMA_TestWire[1U+Copy_Length], sizeof(Local_Tail))==0);
+    return Local_State;
+}
+
+int main(void)
+{
+    static const uint16_t Local_Lengths[]={1U, 2U, 15U, 16U, 17U, 255U, 1023U, 1024U, 1025U, 2048U, 2049U, UARTDMA_TEST_MAX};
+    static const uint16_t Local_EarlyBytes[]={0U, 1U, 7U, 16U, UARTDMA_TEST_EARLY_MAX};
+    uint32_t Local_Seed=4U;
+    uint8_t Local_Length=0U;
+    uint8_t Local_Early=0U;
+    uint8_t Local_Reply[4]={0xCDU, 0x01U, 0x02U, 0x03U};
+    uint8_t Local_Sent[8];
+    UART_Init(UART_0);
+    for(Local_Length=0U;Local_Length<(sizeof(Local_Lengths)/sizeof(Local_Lengths[0]));Local_Length++)
+    {
+        for(Local_Early=0U;Local_Early<(sizeof(Local_EarlyBytes)/sizeof(Local_EarlyBytes[0]));Local_Early++)
+        {
+            if(UARTDMA_TestFrame(Local_Lengths[Local_Length], Local_EarlyBytes[Local_Early], &Local_Seed)==false)
+            {
+                printf("  frame of %u bytes, %u early: FAILED\n", Local_Lengths[Local_Length], Local_EarlyBytes[Local_Early]);
+                TEST_Failures++;
+            }
+        }
+    }
+    TEST_CHECK(FAKE_UartStats.Overruns==0U);
+    TEST_CHECK(FAKE_UartStats.DmaLongest==UARTDMA_MAX_TRANSFER);
+    /*Replies go out through the TX ring*/
+    UART_SendBytes(UART_0, Local_Reply, sizeof(Local_Reply));
+    TEST_CHECK(FAKE_UartTaken(Local_Sent, sizeof(Local_Sent))==sizeof(Local_Reply));
+    TEST_CHECK(memcmp(Local_Sent, Local_Reply, sizeof(Local_Reply))==0);
+    /*A byte arriving after the UART is closed finds no owner*/
+    UART_Close(UART_0);
+    UART_IntHandler();
+    printf("  %u frames, %u interrupts, %u DMA transfers, %u bytes by DMA\n",
+           (unsigned)((sizeof(Local_Lengths)/sizeof(Local_Lengths[0]))*(sizeof(Local_EarlyBytes)/sizeof(Local_EarlyBytes[0]))),
+           (unsigned)FAKE_UartStats.Interrupts, (unsigned)FAKE_UartStats.DmaArms, (unsigned)FAKE_UartStats.DmaBytes);
+    return TEST_RESULT("UartDmaTest");
+}
@@ -0,0 +1,26 @@
+/*
+ * can.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header, declarations only: the simulator has no CAN
+ *  controller, Can.c is left out of its build (TRANSPORT_CAN_ENABLE off).
+ */
+
+#ifndef __DRIVERLIB_CAN_H__
+#define __DRIVERLIB_CAN_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef struct
+{
+    uint32_t ui32MsgID;
+    uint32_t ui32MsgIDMask;
+    uint32_t ui32Flags;
+    uint32_t ui32MsgLen;
+    uint8_t* pui8MsgData;
+}tCANMsgObject;
+
+#endif /* __DRIVERLIB_CAN_H__ */
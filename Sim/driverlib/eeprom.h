@@ -0,0 +1,24 @@
+/*
+ * eeprom.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header.
+ */
+
+#ifndef __DRIVERLIB_EEPROM_H__
+#define __DRIVERLIB_EEPROM_H__
+
+#include <stdint.h>
+
+#define EEPROM_INIT_OK          0
+#define EEPROM_INIT_ERROR       2
+/* EEPROMProgram status, 0 when done */
+#define EEPROM_RC_INVPL         0x00000100
+
+uint32_t EEPROMInit(void);
+void EEPROMRead(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count);
+uint32_t EEPROMProgram(uint32_t *pui32Data, uint32_t ui32Address, uint32_t ui32Count);
+
+#endif /* __DRIVERLIB_EEPROM_H__ */
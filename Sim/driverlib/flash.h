@@ -0,0 +1,28 @@
+/*
+ * flash.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header.
+ */
+
+#ifndef __DRIVERLIB_FLASH_H__
+#define __DRIVERLIB_FLASH_H__
+
+#include <stdint.h>
+
+typedef enum
+{
+    FlashReadWrite,
+    FlashReadOnly,
+    FlashExecuteOnly
+}tFlashProtection;
+
+int32_t FlashErase(uint32_t ui32Address);
+int32_t FlashProgram(uint32_t* pui32Data, uint32_t ui32Address, uint32_t ui32Count);
+tFlashProtection FlashProtectGet(uint32_t ui32Address);
+int32_t FlashProtectSet(uint32_t ui32Address, tFlashProtection eProtect);
+int32_t FlashProtectSave(void);
+
+#endif /* __DRIVERLIB_FLASH_H__ */
@@ -0,0 +1,33 @@
+/*
+ * gpio.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header, the pins have no behavior in the simulator.
+ */
+
+#ifndef __DRIVERLIB_GPIO_H__
+#define __DRIVERLIB_GPIO_H__
+
+#include <stdint.h>
+
+#define GPIO_PIN_0              0x00000001
+#define GPIO_PIN_1              0x00000002
+#define GPIO_PIN_2              0x00000004
+#define GPIO_PIN_3              0x00000008
+#define GPIO_PIN_4              0x00000010
+#define GPIO_PIN_5              0x00000020
+#define GPIO_PIN_6              0x00000040
+#define GPIO_PIN_7              0x00000080
+
+#define GPIO_STRENGTH_2MA       0x00000001
+#define GPIO_PIN_TYPE_STD       0x00000008
+#define GPIO_PIN_TYPE_STD_WPU   0x0000000A
+
+void GPIOPinTypeUART(uint32_t ui32Port, uint8_t ui8Pins);
+void GPIOPinTypeCAN(uint32_t ui32Port, uint8_t ui8Pins);
+void GPIOPinConfigure(uint32_t ui32PinConfig);
+void GPIOPadConfigSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32Strength, uint32_t ui32PinType);
+
+#endif /* __DRIVERLIB_GPIO_H__ */
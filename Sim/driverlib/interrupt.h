@@ -0,0 +1,22 @@
+/*
+ * interrupt.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header.
+ */
+
+#ifndef __DRIVERLIB_INTERRUPT_H__
+#define __DRIVERLIB_INTERRUPT_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+bool IntMasterEnable(void);
+bool IntMasterDisable(void);
+void IntEnable(uint32_t ui32Interrupt);
+void IntDisable(uint32_t ui32Interrupt);
+void IntPendClear(uint32_t ui32Interrupt);
+
+#endif /* __DRIVERLIB_INTERRUPT_H__ */
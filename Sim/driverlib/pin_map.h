@@ -0,0 +1,32 @@
+/*
+ * pin_map.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header, TM4C123GH6PM alternate functions.
+ */
+
+#ifndef __DRIVERLIB_PIN_MAP_H__
+#define __DRIVERLIB_PIN_MAP_H__
+
+#define GPIO_PA0_U0RX           0x00000001
+#define GPIO_PA1_U0TX           0x00000401
+#define GPIO_PB0_U1RX           0x00010001
+#define GPIO_PB1_U1TX           0x00010401
+#define GPIO_PB4_CAN0RX         0x00011008
+#define GPIO_PB5_CAN0TX         0x00011408
+#define GPIO_PC4_U4RX           0x00021001
+#define GPIO_PC5_U4TX           0x00021401
+#define GPIO_PC6_U3RX           0x00021801
+#define GPIO_PC7_U3TX           0x00021C01
+#define GPIO_PD4_U6RX           0x00031001
+#define GPIO_PD5_U6TX           0x00031401
+#define GPIO_PD6_U2RX           0x00031801
+#define GPIO_PD7_U2TX           0x00031C01
+#define GPIO_PE0_U7RX           0x00040001
+#define GPIO_PE1_U7TX           0x00040401
+#define GPIO_PE4_U5RX           0x00041001
+#define GPIO_PE5_U5TX           0x00041401
+
+#endif /* __DRIVERLIB_PIN_MAP_H__ */
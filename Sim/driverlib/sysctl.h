@@ -0,0 +1,64 @@
+/*
+ * sysctl.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header.
+ */
+
+#ifndef __DRIVERLIB_SYSCTL_H__
+#define __DRIVERLIB_SYSCTL_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SYSCTL_PERIPH_UDMA      0xF0000C00
+#define SYSCTL_PERIPH_GPIOA     0xF0000800
+#define SYSCTL_PERIPH_GPIOB     0xF0000801
+#define SYSCTL_PERIPH_GPIOC     0xF0000802
+#define SYSCTL_PERIPH_GPIOD     0xF0000803
+#define SYSCTL_PERIPH_GPIOE     0xF0000804
+#define SYSCTL_PERIPH_GPIOF     0xF0000805
+#define SYSCTL_PERIPH_UART0     0xF0001800
+#define SYSCTL_PERIPH_UART1     0xF0001801
+#define SYSCTL_PERIPH_UART2     0xF0001802
+#define SYSCTL_PERIPH_UART3     0xF0001803
+#define SYSCTL_PERIPH_UART4     0xF0001804
+#define SYSCTL_PERIPH_UART5     0xF0001805
+#define SYSCTL_PERIPH_UART6     0xF0001806
+#define SYSCTL_PERIPH_UART7     0xF0001807
+#define SYSCTL_PERIPH_CAN0      0xF0003400
+#define SYSCTL_PERIPH_EEPROM0   0xF0005800
+
+/* SysCtlClockSet configuration, the dividers and sources of the clock profiles */
+#define SYSCTL_SYSDIV_1         0x07800000
+#define SYSCTL_SYSDIV_4         0x01C00000
+#define SYSCTL_SYSDIV_5         0x02400000
+#define SYSCTL_SYSDIV_2_5       0xC1000000
+#define SYSCTL_USE_PLL          0x00000000
+#define SYSCTL_USE_OSC          0x00003800
+#define SYSCTL_XTAL_16MHZ       0x00000540
+#define SYSCTL_OSC_MAIN         0x00000000
+#define SYSCTL_OSC_INT          0x00000010
+#define SYSCTL_MAIN_OSC_DIS     0x00000001
+
+/* Reset causes */
+#define SYSCTL_CAUSE_EXT        0x00000001
+#define SYSCTL_CAUSE_POR        0x00000002
+#define SYSCTL_CAUSE_BOR        0x00000004
+#define SYSCTL_CAUSE_WDOG0      0x00000008
+#define SYSCTL_CAUSE_SW         0x00000010
+
+void SysCtlPeripheralEnable(uint32_t ui32Peripheral);
+void SysCtlPeripheralDisable(uint32_t ui32Peripheral);
+void SysCtlPeripheralReset(uint32_t ui32Peripheral);
+bool SysCtlPeripheralReady(uint32_t ui32Peripheral);
+void SysCtlClockSet(uint32_t ui32Config);
+uint32_t SysCtlClockGet(void);
+void SysCtlDelay(uint32_t ui32Count);
+void SysCtlReset(void);
+uint32_t SysCtlResetCauseGet(void);
+void SysCtlResetCauseClear(uint32_t ui32Causes);
+
+#endif /* __DRIVERLIB_SYSCTL_H__ */
@@ -0,0 +1,21 @@
+/*
+ * systick.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header.
+ */
+
+#ifndef __DRIVERLIB_SYSTICK_H__
+#define __DRIVERLIB_SYSTICK_H__
+
+#include <stdint.h>
+
+void SysTickPeriodSet(uint32_t ui32Period);
+void SysTickEnable(void);
+void SysTickDisable(void);
+void SysTickIntEnable(void);
+void SysTickIntDisable(void);
+
+#endif /* __DRIVERLIB_SYSTICK_H__ */
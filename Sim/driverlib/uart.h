@@ -0,0 +1,67 @@
+/*
+ * uart.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header.
+ */
+
+#ifndef __DRIVERLIB_UART_H__
+#define __DRIVERLIB_UART_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define UART_INT_OE             0x400
+#define UART_INT_BE             0x200
+#define UART_INT_PE             0x100
+#define UART_INT_FE             0x080
+#define UART_INT_RT             0x040
+#define UART_INT_TX             0x020
+#define UART_INT_RX             0x010
+
+#define UART_CONFIG_WLEN_MASK   0x00000060
+#define UART_CONFIG_WLEN_8      0x00000060
+#define UART_CONFIG_WLEN_7      0x00000040
+#define UART_CONFIG_WLEN_6      0x00000020
+#define UART_CONFIG_WLEN_5      0x00000000
+#define UART_CONFIG_STOP_MASK   0x00000008
+#define UART_CONFIG_STOP_ONE    0x00000000
+#define UART_CONFIG_STOP_TWO    0x00000008
+#define UART_CONFIG_PAR_MASK    0x00000086
+#define UART_CONFIG_PAR_NONE    0x00000000
+
+#define UART_FIFO_TX1_8         0x00000000
+#define UART_FIFO_TX2_8         0x00000001
+#define UART_FIFO_TX4_8         0x00000002
+#define UART_FIFO_TX6_8         0x00000003
+#define UART_FIFO_TX7_8         0x00000004
+#define UART_FIFO_RX1_8         0x00000000
+#define UART_FIFO_RX2_8         0x00000008
+#define UART_FIFO_RX4_8         0x00000010
+#define UART_FIFO_RX6_8         0x00000018
+#define UART_FIFO_RX7_8         0x00000020
+
+#define UART_DMA_RX             0x00000001
+#define UART_DMA_TX             0x00000002
+
+void UARTEnable(uint32_t ui32Base);
+void UARTDisable(uint32_t ui32Base);
+void UARTConfigSetExpClk(uint32_t ui32Base, uint32_t ui32UARTClk, uint32_t ui32Baud, uint32_t ui32Config);
+void UARTFIFOLevelSet(uint32_t ui32Base, uint32_t ui32TxLevel, uint32_t ui32RxLevel);
+bool UARTCharsAvail(uint32_t ui32Base);
+bool UARTSpaceAvail(uint32_t ui32Base);
+int32_t UARTCharGetNonBlocking(uint32_t ui32Base);
+int32_t UARTCharGet(uint32_t ui32Base);
+bool UARTCharPutNonBlocking(uint32_t ui32Base, unsigned char ucData);
+void UARTCharPut(uint32_t ui32Base, unsigned char ucData);
+bool UARTBusy(uint32_t ui32Base);
+void UARTIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags);
+void UARTIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags);
+uint32_t UARTIntStatus(uint32_t ui32Base, bool bMasked);
+void UARTIntClear(uint32_t ui32Base, uint32_t ui32IntFlags);
+void UARTDMAEnable(uint32_t ui32Base, uint32_t ui32DMAFlags);
+void UARTDMADisable(uint32_t ui32Base, uint32_t ui32DMAFlags);
+
+#endif /* __DRIVERLIB_UART_H__ */
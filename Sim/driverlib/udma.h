@@ -0,0 +1,53 @@
+/*
+ * udma.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header, only the basic mode peripheral to memory
+ *  transfers of the UART receive requests are simulated.
+ */
+
+#ifndef __DRIVERLIB_UDMA_H__
+#define __DRIVERLIB_UDMA_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define UDMA_ATTR_USEBURST      0x00000001
+#define UDMA_ATTR_ALTSELECT     0x00000002
+#define UDMA_ATTR_HIGH_PRIORITY 0x00000004
+#define UDMA_ATTR_REQMASK       0x00000008
+
+#define UDMA_PRI_SELECT         0x00000000
+#define UDMA_ALT_SELECT         0x00000020
+
+#define UDMA_MODE_BASIC         0x00000001
+
+#define UDMA_DST_INC_8          0x00000000
+#define UDMA_SRC_INC_NONE       0x0C000000
+#define UDMA_SIZE_8             0x00000000
+#define UDMA_ARB_4              0x00008000
+
+/* Channel assignments, the encoding is in the upper bits and the channel in the low byte */
+#define UDMA_CH6_UART5RX        0x00020006
+#define UDMA_CH8_UART0RX        0x00000008
+#define UDMA_CH10_UART6RX       0x0002000A
+#define UDMA_CH12_UART2RX       0x0001000C
+#define UDMA_CH16_UART3RX       0x00020010
+#define UDMA_CH18_UART4RX       0x00020012
+#define UDMA_CH20_UART7RX       0x00020014
+#define UDMA_CH22_UART1RX       0x00000016
+
+void uDMAEnable(void);
+void uDMAControlBaseSet(void* pControlTable);
+void uDMAChannelAssign(uint32_t ui32Mapping);
+void uDMAChannelAttributeDisable(uint32_t ui32ChannelNum, uint32_t ui32Attr);
+void uDMAChannelControlSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Control);
+void uDMAChannelTransferSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Mode, void* pvSrcAddr, void* pvDstAddr, uint32_t ui32TransferSize);
+void uDMAChannelEnable(uint32_t ui32ChannelNum);
+void uDMAChannelDisable(uint32_t ui32ChannelNum);
+bool uDMAChannelIsEnabled(uint32_t ui32ChannelNum);
+void uDMAIntClear(uint32_t ui32ChanMask);
+
+#endif /* __DRIVERLIB_UDMA_H__ */
@@ -0,0 +1,56 @@
+/*
+ * hw_flash.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header, flash controller and protection registers.
+ */
+
+#ifndef __HW_FLASH_H__
+#define __HW_FLASH_H__
+
+#define FLASH_FMA               0x400FD000
+#define FLASH_FMD               0x400FD004
+#define FLASH_FMC               0x400FD008
+#define FLASH_FCRIS             0x400FD00C
+#define FLASH_FCIM              0x400FD010
+#define FLASH_FCMISC            0x400FD014
+#define FLASH_FMC2              0x400FD020
+#define FLASH_FWBVAL            0x400FD030
+#define FLASH_FWBN              0x400FD100
+#define FLASH_FMPRE0            0x400FE200
+#define FLASH_FMPRE1            0x400FE204
+#define FLASH_FMPRE2            0x400FE208
+#define FLASH_FMPRE3            0x400FE20C
+#define FLASH_FMPPE0            0x400FE400
+#define FLASH_FMPPE1            0x400FE404
+#define FLASH_FMPPE2            0x400FE408
+#define FLASH_FMPPE3            0x400FE40C
+
+#define FLASH_FMC_WRKEY         0xA4420000
+#define FLASH_FMC_COMT          0x00000008
+#define FLASH_FMC_MERASE        0x00000004
+#define FLASH_FMC_ERASE         0x00000002
+#define FLASH_FMC_WRITE         0x00000001
+
+#define FLASH_FMC2_WRKEY        0xA4420000
+#define FLASH_FMC2_WRBUF        0x00000001
+
+#define FLASH_FCRIS_PROGRIS     0x00002000
+#define FLASH_FCRIS_ERRIS       0x00000800
+#define FLASH_FCRIS_INVDRIS     0x00000400
+#define FLASH_FCRIS_VOLTRIS     0x00000200
+#define FLASH_FCRIS_ERIS        0x00000004
+#define FLASH_FCRIS_PRIS        0x00000002
+#define FLASH_FCRIS_ARIS        0x00000001
+
+#define FLASH_FCMISC_PROGMISC   0x00002000
+#define FLASH_FCMISC_ERMISC     0x00000800
+#define FLASH_FCMISC_INVDMISC   0x00000400
+#define FLASH_FCMISC_VOLTMISC   0x00000200
+#define FLASH_FCMISC_EMISC      0x00000004
+#define FLASH_FCMISC_PMISC      0x00000002
+#define FLASH_FCMISC_AMISC      0x00000001
+
+#endif /* __HW_FLASH_H__ */
@@ -0,0 +1,17 @@
+/*
+ * hw_gpio.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header.
+ */
+
+#ifndef __HW_GPIO_H__
+#define __HW_GPIO_H__
+
+#define GPIO_O_LOCK             0x00000520
+#define GPIO_O_CR               0x00000524
+#define GPIO_LOCK_KEY           0x4C4F434B
+
+#endif /* __HW_GPIO_H__ */
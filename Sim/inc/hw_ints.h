@@ -0,0 +1,26 @@
+/*
+ * hw_ints.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header, TM4C123GH6PM interrupt numbers.
+ */
+
+#ifndef __HW_INTS_H__
+#define __HW_INTS_H__
+
+#define FAULT_SYSTICK           15
+#define INT_UART0               21
+#define INT_UART1               22
+#define INT_UART2               49
+#define INT_CAN0                55
+#define INT_CAN1                56
+#define INT_UART3               75
+#define INT_UART4               76
+#define INT_UART5               77
+#define INT_UART6               78
+#define INT_UART7               79
+#define NUM_INTERRUPTS          155
+
+#endif /* __HW_INTS_H__ */
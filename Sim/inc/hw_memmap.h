@@ -0,0 +1,37 @@
+/*
+ * hw_memmap.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header, TM4C123GH6PM memory map.
+ */
+
+#ifndef __HW_MEMMAP_H__
+#define __HW_MEMMAP_H__
+
+#define FLASH_BASE              0x00000000
+#define SRAM_BASE               0x20000000
+#define GPIO_PORTA_BASE         0x40004000
+#define GPIO_PORTB_BASE         0x40005000
+#define GPIO_PORTC_BASE         0x40006000
+#define GPIO_PORTD_BASE         0x40007000
+#define UART0_BASE              0x4000C000
+#define UART1_BASE              0x4000D000
+#define UART2_BASE              0x4000E000
+#define UART3_BASE              0x4000F000
+#define UART4_BASE              0x40010000
+#define UART5_BASE              0x40011000
+#define UART6_BASE              0x40012000
+#define UART7_BASE              0x40013000
+#define GPIO_PORTE_BASE         0x40024000
+#define GPIO_PORTF_BASE         0x40025000
+#define CAN0_BASE               0x40040000
+#define CAN1_BASE               0x40041000
+#define EEPROM_BASE             0x400AF000
+#define FLASH_CTRL_BASE         0x400FD000
+#define SYSCTL_BASE             0x400FE000
+#define UDMA_BASE               0x400FF000
+#define NVIC_BASE               0xE000E000
+
+#endif /* __HW_MEMMAP_H__ */
@@ -0,0 +1,21 @@
+/*
+ * hw_nvic.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header.
+ */
+
+#ifndef __HW_NVIC_H__
+#define __HW_NVIC_H__
+
+#define NVIC_DIS0               0xE000E180
+#define NVIC_UNPEND0            0xE000E280
+#define NVIC_INT_CTRL           0xE000ED04
+#define NVIC_INT_CTRL_PENDSTCLR 0x02000000
+#define NVIC_INT_CTRL_UNPEND_SV 0x08000000
+#define NVIC_VTABLE             0xE000ED08
+#define NVIC_APINT              0xE000ED0C
+
+#endif /* __HW_NVIC_H__ */
@@ -0,0 +1,20 @@
+/*
+ * hw_sysctl.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header.
+ */
+
+#ifndef __HW_SYSCTL_H__
+#define __HW_SYSCTL_H__
+
+#define SYSCTL_DID0             0x400FE000
+#define SYSCTL_DID1             0x400FE004
+#define SYSCTL_RESC             0x400FE05C
+#define SYSCTL_RCC_BYPASS       0x00000800
+#define SYSCTL_PLLSTAT          0x400FE168
+#define SYSCTL_PLLSTAT_LOCK     0x00000001
+
+#endif /* __HW_SYSCTL_H__ */
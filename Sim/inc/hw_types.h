@@ -0,0 +1,21 @@
+/*
+ * hw_types.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header: HWREG goes through the simulator, which decodes
+ *  the address (flash, SRAM or a peripheral register) and runs the flash controller commands.
+ */
+
+#ifndef __HW_TYPES_H__
+#define __HW_TYPES_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+volatile uint32_t* SIM_Register(uint32_t Copy_Address);
+
+#define HWREG(x)                (*SIM_Register((uint32_t)(x)))
+
+#endif /* __HW_TYPES_H__ */
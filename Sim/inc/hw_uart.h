@@ -0,0 +1,22 @@
+/*
+ * hw_uart.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Simulator version of the TivaWare header.
+ */
+
+#ifndef __HW_UART_H__
+#define __HW_UART_H__
+
+#define UART_O_DR               0x00000000
+#define UART_O_FR               0x00000018
+
+/* Error flags read together with a character from UART_O_DR */
+#define UART_DR_OE              0x00000800
+#define UART_DR_BE              0x00000400
+#define UART_DR_PE              0x00000200
+#define UART_DR_FE              0x00000100
+
+#endif /* __HW_UART_H__ */
@@ -0,0 +1,386 @@
+/*
+ * Transport.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ */
+#include <stddef.h>
+#include "Transport.h"
+
+#if TRANSPORT_LOOPBACK_ENABLE==TRANSPORT_ON
+#include "Loopback.h"
+#else
+#if TRANSPORT_UART_CHANNELS!=0U
+#include "Uart.h"
+#endif
+#if TRANSPORT_CAN_ENABLE==TRANSPORT_ON
+#include "Can.h"
+#endif
+#endif
+
+/*Backend adapters, the channel is the UART_t / CAN_t of the driver*/
+#if TRANSPORT_LOOPBACK_ENABLE==TRANSPORT_ON
+static void TRANSPORT_LoopbackOpen(uint8_t Copy_Channel)
+{
+    /*The caller opens the link with LOOPBACK_Init*/
+}
+
+static bool TRANSPORT_LoopbackIsHostActive(uint8_t Copy_Channel)
+{
+    return LOOPBACK_IsHostActive();
+}
+
+static void TRANSPORT_LoopbackAttach(uint8_t Copy_Channel)
+{
+    /*Do Nothing*/
+}
+
+static void TRANSPORT_LoopbackSendBytes(uint8_t Copy_Channel,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    LOOPBACK_SendBytes(Copy_Data, Copy_DataLength);
+}
+
+static uint16_t TRANSPORT_LoopbackReadBytes(uint8_t Copy_Channel,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    return LOOPBACK_ReadBytes(Copy_Data, Copy_DataLength);
+}
+
+static void TRANSPORT_LoopbackStartReceive(uint8_t Copy_Channel,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    LOOPBACK_StartReceive(Copy_Data, Copy_DataLength);
+}
+
+static bool TRANSPORT_LoopbackIsReceiveComplete(uint8_t Copy_Channel)
+{
+    return LOOPBACK_IsReceiveComplete();
+}
+
+static uint32_t TRANSPORT_LoopbackGetBitRate(uint8_t Copy_Channel)
+{
+    return 0U;
+}
+
+static bool TRANSPORT_LoopbackSetBitRate(uint8_t Copy_Channel,uint32_t Copy_BitRate)
+{
+    return true;
+}
+
+static void TRANSPORT_LoopbackClose(uint8_t Copy_Channel)
+{
+    /*Do Nothing, the bytes are in memory*/
+}
+
+static const TRANSPORT_Ops_t TRANSPORT_LoopbackOps=
+{
+    TRANSPORT_KIND_LOOPBACK, true,
+    TRANSPORT_LoopbackOpen, TRANSPORT_LoopbackIsHostActive, TRANSPORT_LoopbackAttach,
+    TRANSPORT_LoopbackSendBytes, TRANSPORT_LoopbackReadBytes,
+    TRANSPORT_LoopbackStartReceive, TRANSPORT_LoopbackIsReceiveComplete,
+    TRANSPORT_LoopbackGetBitRate, TRANSPORT_LoopbackSetBitRate, TRANSPORT_LoopbackClose
+};
+
+static const TRANSPORT_t TRANSPORT_Candidates[]=
+{
+    {&TRANSPORT_LoopbackOps, 0U}
+};
+#else
+#if TRANSPORT_UART_CHANNELS!=0U
+static void TRANSPORT_UartOpen(uint8_t Copy_Channel)
+{
+    UART_Open((UART_t)Copy_Channel);
+}
+
+static bool TRANSPORT_UartIsHostActive(uint8_t Copy_Channel)
+{
+    return UART_IsHostActive((UART_t)Copy_Channel);
+}
+
+static void TRANSPORT_UartAttach(uint8_t Copy_Channel)
+{
+    UART_Attach((UART_t)Copy_Channel);
+}
+
+static void TRANSPORT_UartSendBytes(uint8_t Copy_Channel,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    UART_SendBytes((UART_t)Copy_Channel, Copy_Data, Copy_DataLength);
+}
+
+static uint16_t TRANSPORT_UartReadBytes(uint8_t Copy_Channel,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    return UART_ReadBytes((UART_t)Copy_Channel, Copy_Data, Copy_DataLength);
+}
+
+static void TRANSPORT_UartStartReceive(uint8_t Copy_Channel,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    UART_StartReceive((UART_t)Copy_Channel, Copy_Data, Copy_DataLength);
+}
+
+static bool TRANSPORT_UartIsReceiveComplete(uint8_t Copy_Channel)
+{
+    return UART_IsReceiveComplete((UART_t)Copy_Channel);
+}
+
+static uint32_t TRANSPORT_UartGetBitRate(uint8_t Copy_Channel)
+{
+    return UART_GetBaudRate((UART_t)Copy_Channel);
+}
+
+static bool TRANSPORT_UartSetBitRate(uint8_t Copy_Channel,uint32_t Copy_BitRate)
+{
+    return UART_SetBaudRate((UART_t)Copy_Channel, Copy_BitRate);
+}
+
+static void TRANSPORT_UartClose(uint8_t Copy_Channel)
+{
+    UART_Close((UART_t)Copy_Channel);
+}
+
+/*Only uDMA keeps filling the buffer while the CPU is stalled, the FIFO overruns in the other modes*/
+static const TRANSPORT_Ops_t TRANSPORT_UartOps=
+{
+    TRANSPORT_KIND_UART, (UART_MODE==UART_DMA_MODE),
+    TRANSPORT_UartOpen, TRANSPORT_UartIsHostActive, TRANSPORT_UartAttach,
+    TRANSPORT_UartSendBytes, TRANSPORT_UartReadBytes,
+    TRANSPORT_UartStartReceive, TRANSPORT_UartIsReceiveComplete,
+    TRANSPORT_UartGetBitRate, TRANSPORT_UartSetBitRate, TRANSPORT_UartClose
+};
+#endif
+
+#if TRANSPORT_CAN_ENABLE==TRANSPORT_ON
+static void TRANSPORT_CanOpen(uint8_t Copy_Channel)
+{
+    CAN_Init((CAN_t)Copy_Channel);
+}
+
+static bool TRANSPORT_CanIsHostActive(uint8_t Copy_Channel)
+{
+    return CAN_IsHostActive((CAN_t)Copy_Channel);
+}
+
+static void TRANSPORT_CanAttach(uint8_t Copy_Channel)
+{
+    /*Do Nothing, the mailboxes already receive since CAN_Init*/
+}
+
+static void TRANSPORT_CanSendBytes(uint8_t Copy_Channel,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    CAN_SendBytes((CAN_t)Copy_Channel, Copy_Data, Copy_DataLength);
+}
+
+static uint16_t TRANSPORT_CanReadBytes(uint8_t Copy_Channel,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    return CAN_ReadBytes((CAN_t)Copy_Channel, Copy_Data, Copy_DataLength);
+}
+
+static void TRANSPORT_CanStartReceive(uint8_t Copy_Channel,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    CAN_StartReceive((CAN_t)Copy_Channel, Copy_Data, Copy_DataLength);
+}
+
+static bool TRANSPORT_CanIsReceiveComplete(uint8_t Copy_Channel)
+{
+    return CAN_IsReceiveComplete((CAN_t)Copy_Channel);
+}
+
+static uint32_t TRANSPORT_CanGetBitRate(uint8_t Copy_Channel)
+{
+    return CAN_BITRATE;
+}
+
+static bool TRANSPORT_CanSetBitRate(uint8_t Copy_Channel,uint32_t Copy_BitRate)
+{
+    /*The bit rate of the bus is fixed*/
+    return (Copy_BitRate==CAN_BITRATE);
+}
+
+static void TRANSPORT_CanClose(uint8_t Copy_Channel)
+{
+    CAN_Close((CAN_t)Copy_Channel);
+}
+
+static const TRANSPORT_Ops_t TRANSPORT_CanOps=
+{
+    TRANSPORT_KIND_CAN, true,
+    TRANSPORT_CanOpen, TRANSPORT_CanIsHostActive, TRANSPORT_CanAttach,
+    TRANSPORT_CanSendBytes, TRANSPORT_CanReadBytes,
+    TRANSPORT_CanStartReceive, TRANSPORT_CanIsReceiveComplete,
+    TRANSPORT_CanGetBitRate, TRANSPORT_CanSetBitRate, TRANSPORT_CanClose
+};
+#endif
+
+/*Polled in this order, the UARTs left out of TRANSPORT_UART_CHANNELS are skipped at run time*/
+static const TRANSPORT_t TRANSPORT_Candidates[]=
+{
+#if TRANSPORT_CAN_ENABLE==TRANSPORT_ON
+    {&TRANSPORT_CanOps, (uint8_t)CAN_0},
+#endif
+#if TRANSPORT_UART_CHANNELS!=0U
+    {&TRANSPORT_UartOps, (uint8_t)UART_0},
+    {&TRANSPORT_UartOps, (uint8_t)UART_1},
+    {&TRANSPORT_UartOps, (uint8_t)UART_2},
+    {&TRANSPORT_UartOps, (uint8_t)UART_3},
+    {&TRANSPORT_UartOps, (uint8_t)UART_4},
+    {&TRANSPORT_UartOps, (uint8_t)UART_5},
+    {&TRANSPORT_UartOps, (uint8_t)UART_6},
+    {&TRANSPORT_UartOps, (uint8_t)UART_7},
+#endif
+};
+#endif
+
+#define TRANSPORT_CANDIDATES    (sizeof(TRANSPORT_Candidates)/sizeof(TRANSPORT_Candidates[0]))
+
+static const TRANSPORT_t* TRANSPORT_Active=NULL;
+static bool TRANSPORT_Opened=false;
+
+static bool TRANSPORT_IsEnabled(const TRANSPORT_t* Copy_Candidate)
+{
+    bool Local_Enabled=true;
+    if(Copy_Candidate->Ops->Kind==TRANSPORT_KIND_UART)
+    {
+        Local_Enabled=(((TRANSPORT_UART_CHANNELS>>Copy_Candidate->Channel)&1U)!=0U);
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    return Local_Enabled;
+}
+
+void TRANSPORT_Init(void)
+{
+    uint8_t Local_Counter=0;
+    TRANSPORT_Active=NULL;
+    TRANSPORT_Opened=true;
+    for(Local_Counter=0;Local_Counter<TRANSPORT_CANDIDATES;Local_Counter++)
+    {
+        if(TRANSPORT_IsEnabled(&TRANSPORT_Candidates[Local_Counter])==true)
+        {
+            TRANSPORT_Candidates[Local_Counter].Ops->Open(TRANSPORT_Candidates[Local_Counter].Channel);
+        }
+        else
+        {
+            /*Do Nothing*/
+        }
+    }
+}
+
+const TRANSPORT_t* TRANSPORT_Detect(void)
+{
+    uint8_t Local_Counter=0;
+    const TRANSPORT_t* Local_Candidate=NULL;
+    for(Local_Counter=0;(Local_Counter<TRANSPORT_CANDIDATES) && (TRANSPORT_Active==NULL);Local_Counter++)
+    {
+        Local_Candidate=&TRANSPORT_Candidates[Local_Counter];
+        if((TRANSPORT_IsEnabled(Local_Candidate)==true) && (Local_Candidate->Ops->IsHostActive(Local_Candidate->Channel)==true))
+        {
+            /*The host talked here, the other interfaces stay quiet until the next reset*/
+            Local_Candidate->Ops->Attach(Local_Candidate->Channel);
+            TRANSPORT_Active=Local_Candidate;
+        }
+        else
+        {
+            /*Do Nothing*/
+        }
+    }
+    return TRANSPORT_Active;
+}
+
+void TRANSPORT_SendBytes(const TRANSPORT_t* Copy_Transport,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    Copy_Transport->Ops->SendBytes(Copy_Transport->Channel, Copy_Data, Copy_DataLength);
+}
+
+uint16_t TRANSPORT_ReadBytes(const TRANSPORT_t* Copy_Transport,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    return Copy_Transport->Ops->ReadBytes(Copy_Transport->Channel, Copy_Data, Copy_DataLength);
+}
+
+void TRANSPORT_StartReceive(const TRANSPORT_t* Copy_Transport,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    Copy_Transport->Ops->StartReceive(Copy_Transport->Channel, Copy_Data, Copy_DataLength);
+}
+
+bool TRANSPORT_IsReceiveComplete(const TRANSPORT_t* Copy_Transport)
+{
+    return Copy_Transport->Ops->IsReceiveComplete(Copy_Transport->Channel);
+}
+
+const TRANSPORT_t* TRANSPORT_Resume(TRANSPORT_Kind_t Copy_Kind,uint8_t Copy_Channel,uint32_t Copy_BitRate)
+{
+    uint8_t Local_Counter=0;
+    const TRANSPORT_t* Local_Candidate=NULL;
+    const TRANSPORT_t* Local_Link=NULL;
+    TRANSPORT_Active=NULL;
+    for(Local_Counter=0;(Local_Counter<TRANSPORT_CANDIDATES) && (Local_Link==NULL);Local_Counter++)
+    {
+        Local_Candidate=&TRANSPORT_Candidates[Local_Counter];
+        if((Local_Candidate->Ops->Kind==Copy_Kind) && (Local_Candidate->Channel==Copy_Channel) &&
+           (TRANSPORT_IsEnabled(Local_Candidate)==true))
+        {
+            Local_Link=Local_Candidate;
+        }
+        else
+        {
+            /*Do Nothing*/
+        }
+    }
+    if(Local_Link!=NULL)
+    {
+        Local_Link->Ops->Open(Local_Link->Channel);
+        if((Copy_BitRate==0U) || (Local_Link->Ops->SetBitRate(Local_Link->Channel, Copy_BitRate)==true))
+        {
+            /*The host already talks at this rate, no byte of it is needed to pick the link*/
+            Local_Link->Ops->Attach(Local_Link->Channel);
+            TRANSPORT_Active=Local_Link;
+        }
+        else
+        {
+            Local_Link->Ops->Close(Local_Link->Channel);
+        }
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    return TRANSPORT_Active;
+}
+
+const TRANSPORT_t* TRANSPORT_GetActive(void)
+{
+    return TRANSPORT_Active;
+}
+
+uint32_t TRANSPORT_GetBitRate(const TRANSPORT_t* Copy_Transport)
+{
+    return Copy_Transport->Ops->GetBitRate(Copy_Transport->Channel);
+}
+
+void TRANSPORT_DeInit(void)
+{
+    uint8_t Local_Counter=0;
+    const TRANSPORT_t* Local_Candidate=NULL;
+    /*The host link first, the others share its pin ports and are idle*/
+    if(TRANSPORT_Active!=NULL)
+    {
+        TRANSPORT_Active->Ops->Close(TRANSPORT_Active->Channel);
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    /*A link taken with TRANSPORT_Resume is the only one opened*/
+    for(Local_Counter=0;(Local_Counter<TRANSPORT_CANDIDATES) && (TRANSPORT_Opened==true);Local_Counter++)
+    {
+        Local_Candidate=&TRANSPORT_Candidates[Local_Counter];
+        if((Local_Candidate!=TRANSPORT_Active) && (TRANSPORT_IsEnabled(Local_Candidate)==true))
+        {
+            Local_Candidate->Ops->Close(Local_Candidate->Channel);
+        }
+        else
+        {
+            /*Do Nothing*/
+        }
+    }
+    TRANSPORT_Active=NULL;
+    TRANSPORT_Opened=false;
+}
@@ -0,0 +1,99 @@
+/*
+ * Transport.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Host link independent of the interface: every backend (UART, CAN, loopback) fills the same
+ *  table of operations. After reset all the configured interfaces listen, the first one the host
+ *  talks on stays the host link until the next reset, so one binary serves all of them.
+ */
+
+#ifndef TRANSPORT_H_
+#define TRANSPORT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define TRANSPORT_OFF               0x00
+#define TRANSPORT_ON                0x01
+
+/* UARTs listened to after reset, bit n = UART_n. A listening UART takes its pins with a pull up on RX
+ * and the jump resets its whole GPIO port, so only UART0 (the LaunchPad virtual COM port) by default.
+ * Add a UART only when nothing else is wired to its port, e.g. -DTRANSPORT_UART_CHANNELS=0x03U for
+ * UART1 too. UART2 takes the locked NMI pin PD7 and UART6 the USB pins PD4 / PD5 */
+#ifndef TRANSPORT_UART_CHANNELS
+#define TRANSPORT_UART_CHANNELS     0x01U
+#endif
+
+/* CAN0 listened to after reset (PB4 / PB5) */
+#ifndef TRANSPORT_CAN_ENABLE
+#define TRANSPORT_CAN_ENABLE        TRANSPORT_ON
+#endif
+
+/* Memory link of Loopback.h for off target runs, when on it is the only interface */
+#ifndef TRANSPORT_LOOPBACK_ENABLE
+#define TRANSPORT_LOOPBACK_ENABLE   TRANSPORT_OFF
+#endif
+
+typedef enum
+{
+    TRANSPORT_KIND_UART=0,
+    TRANSPORT_KIND_CAN,
+    TRANSPORT_KIND_LOOPBACK
+}TRANSPORT_Kind_t;
+
+typedef struct
+{
+    TRANSPORT_Kind_t Kind;
+    bool ReceivesDuringStall;   /* Keeps receiving while the CPU is stalled by a flash erase or program */
+    void (*Open)(uint8_t Copy_Channel);
+    bool (*IsHostActive)(uint8_t Copy_Channel);
+    void (*Attach)(uint8_t Copy_Channel);
+    void (*SendBytes)(uint8_t Copy_Channel,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+    uint16_t (*ReadBytes)(uint8_t Copy_Channel,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+    void (*StartReceive)(uint8_t Copy_Channel,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+    bool (*IsReceiveComplete)(uint8_t Copy_Channel);
+    uint32_t (*GetBitRate)(uint8_t Copy_Channel);
+    bool (*SetBitRate)(uint8_t Copy_Channel,uint32_t Copy_BitRate);
+    void (*Close)(uint8_t Copy_Channel);
+}TRANSPORT_Ops_t;
+
+typedef struct
+{
+    const TRANSPORT_Ops_t* Ops;
+    uint8_t Channel;            /* UART_t / CAN_t of the backend */
+}TRANSPORT_t;
+
+/* Open every configured interface */
+void TRANSPORT_Init(void);
+
+/* Non blocking, returns the host link once the host talked on one of the interfaces, NULL before */
+const TRANSPORT_t* TRANSPORT_Detect(void);
+
+void TRANSPORT_SendBytes(const TRANSPORT_t* Copy_Transport,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+/* Non blocking, returns the number of bytes copied */
+uint16_t TRANSPORT_ReadBytes(const TRANSPORT_t* Copy_Transport,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+/* Asynchronous receive of exactly Copy_DataLength bytes, poll TRANSPORT_IsReceiveComplete until it returns true */
+void TRANSPORT_StartReceive(const TRANSPORT_t* Copy_Transport,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+bool TRANSPORT_IsReceiveComplete(const TRANSPORT_t* Copy_Transport);
+
+/* Open only the interface of a link handed over by the application and make it the host link at once,
+ * Copy_BitRate 0 keeps the default rate. Returns NULL, nothing left open, when that interface isn't
+ * configured or can't run at that rate */
+const TRANSPORT_t* TRANSPORT_Resume(TRANSPORT_Kind_t Copy_Kind,uint8_t Copy_Channel,uint32_t Copy_BitRate);
+
+/* The host link, NULL before the host talked, nothing is polled */
+const TRANSPORT_t* TRANSPORT_GetActive(void);
+
+/* Line rate of the link in bit/s, 0 for the loopback */
+uint32_t TRANSPORT_GetBitRate(const TRANSPORT_t* Copy_Transport);
+
+/* Wait for the last reply on the host link, then put every interface opened by TRANSPORT_Init or TRANSPORT_Resume
+ * back in its reset state (peripheral, pins, interrupt), nothing is done when none was opened */
+void TRANSPORT_DeInit(void);
+
+#endif /* TRANSPORT_H_ */
@@ -6,33 +6,382 @@
  */
 #include "Uart.h"
 
+static const UART_Config_t UART_Config[UART_NUM]=
+{
+    {UART0_BASE, SYSCTL_PERIPH_UART0, SYSCTL_PERIPH_GPIOA, GPIO_PORTA_BASE, GPIO_PIN_0, GPIO_PIN_1, GPIO_PA0_U0RX, GPIO_PA1_U0TX, INT_UART0, UDMA_CH8_UART0RX},
+    {UART1_BASE, SYSCTL_PERIPH_UART1, SYSCTL_PERIPH_GPIOB, GPIO_PORTB_BASE, GPIO_PIN_0, GPIO_PIN_1, GPIO_PB0_U1RX, GPIO_PB1_U1TX, INT_UART1, UDMA_CH22_UART1RX},
+    {UART2_BASE, SYSCTL_PERIPH_UART2, SYSCTL_PERIPH_GPIOD, GPIO_PORTD_BASE, GPIO_PIN_6, GPIO_PIN_7, GPIO_PD6_U2RX, GPIO_PD7_U2TX, INT_UART2, UDMA_CH12_UART2RX},
+    {UART3_BASE, SYSCTL_PERIPH_UART3, SYSCTL_PERIPH_GPIOC, GPIO_PORTC_BASE, GPIO_PIN_6, GPIO_PIN_7, GPIO_PC6_U3RX, GPIO_PC7_U3TX, INT_UART3, UDMA_CH16_UART3RX},
+    {UART4_BASE, SYSCTL_PERIPH_UART4, SYSCTL_PERIPH_GPIOC, GPIO_PORTC_BASE, GPIO_PIN_4, GPIO_PIN_5, GPIO_PC4_U4RX, GPIO_PC5_U4TX, INT_UART4, UDMA_CH18_UART4RX},
+    {UART5_BASE, SYSCTL_PERIPH_UART5, SYSCTL_PERIPH_GPIOE, GPIO_PORTE_BASE, GPIO_PIN_4, GPIO_PIN_5, GPIO_PE4_U5RX, GPIO_PE5_U5TX, INT_UART5, UDMA_CH6_UART5RX},
+    {UART6_BASE, SYSCTL_PERIPH_UART6, SYSCTL_PERIPH_GPIOD, GPIO_PORTD_BASE, GPIO_PIN_4, GPIO_PIN_5, GPIO_PD4_U6RX, GPIO_PD5_U6TX, INT_UART6, UDMA_CH10_UART6RX},
+    {UART7_BASE, SYSCTL_PERIPH_UART7, SYSCTL_PERIPH_GPIOE, GPIO_PORTE_BASE, GPIO_PIN_0, GPIO_PIN_1, GPIO_PE0_U7RX, GPIO_PE1_U7TX, INT_UART7, UDMA_CH20_UART7RX}
+};
+
+/*State of the pending UART_StartReceive request*/
+static uint8_t* UART_RxDest=0;
+static volatile uint16_t UART_RxRemaining=0;
+static uint32_t UART_BaudRate[UART_NUM]={0};
+static uint8_t UART_Owner=UART_NO_OWNER;
+/*First host byte taken by UART_IsHostActive, -1 when none is pending*/
+static int16_t UART_PendingByte=-1;
+static uint8_t UART_PendingNum=UART_NO_OWNER;
+
+#if UART_MODE!=UART_POLLING_MODE
+static uint8_t UART_RxStorage[UART_RX_BUFFER_SIZE];
+static uint8_t UART_TxStorage[UART_TX_BUFFER_SIZE];
+static RingBuffer_t UART_RxRing;
+static RingBuffer_t UART_TxRing;
+
+/*Move queued bytes to the hardware FIFO, the TX interrupt is only left on while bytes are pending*/
+static void UART_FillTxFifo(void)
+{
+    uint8_t Local_Data=0;
+    uint32_t Local_Base=UART_Config[UART_Owner].Base;
+    while((UARTSpaceAvail(Local_Base)==true) && (RingBuffer_Get(&UART_TxRing, &Local_Data)==true))
+    {
+        UARTCharPutNonBlocking(Local_Base, Local_Data);
+    }
+    if(RingBuffer_Count(&UART_TxRing)==0U)
+    {
+        UARTIntDisable(Local_Base, UART_INT_TX);
+    }
+    else
+    {
+        UARTIntEnable(Local_Base, UART_INT_TX);
+    }
+}
+#endif
+
+#if UART_MODE==UART_DMA_MODE
+static volatile bool UART_RxDmaActive=false;
+static uint16_t UART_RxDmaChunk=0;
+
+/*Arm the next transfer of the pending receive, long bodies are split into UARTDMA_MAX_TRANSFER chunks*/
+static void UART_ArmRxDma(void)
+{
+    UART_RxDmaChunk=(UART_RxRemaining>UARTDMA_MAX_TRANSFER) ? UARTDMA_MAX_TRANSFER : UART_RxRemaining;
+    UARTDMA_Arm(UART_RxDest, UART_RxDmaChunk);
+}
+#endif
+
 void UART_Init(UART_t Copy_UartNum)
 {
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_UART0);
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
-    GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
-    GPIOPinConfigure(GPIO_PA0_U0RX);
-    GPIOPinConfigure(GPIO_PA1_U0TX);
-    UARTDisable(UART0_BASE);
-    UARTConfigSetExpClk(UART0_BASE, SysCtlClockGet(), 115200,UART_CONFIG_PAR_NONE | UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE);
-    UARTEnable(UART0_BASE);
+    UART_Open(Copy_UartNum);
+    UART_Attach(Copy_UartNum);
+}
+
+void UART_Open(UART_t Copy_UartNum)
+{
+    const UART_Config_t* Local_Config=&UART_Config[Copy_UartNum];
+    SysCtlPeripheralEnable(Local_Config->Peripheral);
+    SysCtlPeripheralEnable(Local_Config->GpioPeripheral);
+    if(Copy_UartNum==UART_2)
+    {
+        /*PD7 is the NMI pin, its function can't be changed before it is unlocked*/
+        HWREG(GPIO_PORTD_BASE+GPIO_O_LOCK)=GPIO_LOCK_KEY;
+        HWREG(GPIO_PORTD_BASE+GPIO_O_CR)|=GPIO_PIN_7;
+        HWREG(GPIO_PORTD_BASE+GPIO_O_LOCK)=0U;
+    }
+    GPIOPinTypeUART(Local_Config->GpioBase, Local_Config->RxPin | Local_Config->TxPin);
+    GPIOPinConfigure(Local_Config->RxPinConfig);
+    GPIOPinConfigure(Local_Config->TxPinConfig);
+    GPIOPadConfigSet(Local_Config->GpioBase, Local_Config->RxPin, GPIO_STRENGTH_2MA, GPIO_PIN_TYPE_STD_WPU);
+    UARTDisable(Local_Config->Base);
+    UART_BaudRate[Copy_UartNum]=UART_DEFAULT_BAUD;
+    UARTConfigSetExpClk(Local_Config->Base, SysCtlClockGet(), UART_BaudRate[Copy_UartNum],UART_CONFIG_PAR_NONE | UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE);
+    UARTEnable(Local_Config->Base);
+}
+
+void UART_Attach(UART_t Copy_UartNum)
+{
+#if UART_MODE!=UART_POLLING_MODE
+    const UART_Config_t* Local_Config=&UART_Config[Copy_UartNum];
+    RingBuffer_Init(&UART_RxRing, UART_RxStorage, UART_RX_BUFFER_SIZE);
+    RingBuffer_Init(&UART_TxRing, UART_TxStorage, UART_TX_BUFFER_SIZE);
+    if((UART_PendingNum==Copy_UartNum) && (UART_PendingByte>=0))
+    {
+        RingBuffer_Put(&UART_RxRing, (uint8_t)UART_PendingByte);
+        UART_PendingByte=-1;
+    }
+    UART_Owner=Copy_UartNum;
+#if UART_MODE==UART_DMA_MODE
+    UARTDMA_Init(Local_Config->Base, Local_Config->DmaChannel);
+#endif
+    /*Interrupt at half full FIFO, the receive timeout flushes the tail of a packet*/
+    UARTFIFOLevelSet(Local_Config->Base, UART_FIFO_TX4_8, UART_FIFO_RX4_8);
+    UARTIntClear(Local_Config->Base, UART_INT_RX | UART_INT_RT | UART_INT_TX);
+    UARTIntEnable(Local_Config->Base, UART_INT_RX | UART_INT_RT);
+    IntEnable(Local_Config->Interrupt);
+    IntMasterEnable();
+#else
+    UART_Owner=Copy_UartNum;
+#endif
+}
+
+bool UART_IsHostActive(UART_t Copy_UartNum)
+{
+    bool Local_State=false;
+    int32_t Local_Data=0;
+    uint32_t Local_Base=UART_Config[Copy_UartNum].Base;
+    while((Local_State==false) && (UARTCharsAvail(Local_Base)==true))
+    {
+        /*The error flags come with the character, a floating line gives framing and break errors*/
+        Local_Data=UARTCharGetNonBlocking(Local_Base);
+        if((Local_Data & (UART_DR_OE | UART_DR_BE | UART_DR_PE | UART_DR_FE))==0)
+        {
+            UART_PendingByte=(int16_t)(Local_Data & 0xFF);
+            UART_PendingNum=Copy_UartNum;
+            Local_State=true;
+        }
+    }
+    return Local_State;
+}
+
+void UART_SendBytes(UART_t Copy_UartNum,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    uint16_t Local_Sent=0;
+    while(Local_Sent<Copy_DataLength)
+    {
+        Local_Sent+=UART_WriteBytes(Copy_UartNum, &Copy_Data[Local_Sent], Copy_DataLength-Local_Sent);
+    }
+}
+
+void UART_ReceiveBytes(UART_t Copy_UartNum,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+    uint16_t Local_Received=0;
+    while(Local_Received<Copy_DataLength)
+    {
+        Local_Received+=UART_ReadBytes(Copy_UartNum, &Copy_Data[Local_Received], Copy_DataLength-Local_Received);
+    }
 }
 
-void UART_SendBytes(UART_t Copy_UartNum,uint8_t* Copy_Data,uint8_t Copy_DataLength)
+uint16_t UART_WriteBytes(UART_t Copy_UartNum,const uint8_t* Copy_Data,uint16_t Copy_DataLength)
 {
-    uint8_t Local_Counter=0;
-    for( ;Local_Counter<Copy_DataLength;Local_Counter++)
+    uint16_t Local_Counter=0;
+    uint32_t Local_Base=UART_Config[Copy_UartNum].Base;
+#if UART_MODE!=UART_POLLING_MODE
+    if(Copy_UartNum==UART_Owner)
     {
-        UARTCharPut((UART0_BASE+Copy_UartNum), Copy_Data[Local_Counter]);
+        Local_Counter=RingBuffer_Write(&UART_TxRing, Copy_Data, Copy_DataLength);
+        /*The ISR must not drain the ring while the FIFO is being primed*/
+        UARTIntDisable(Local_Base, UART_INT_TX);
+        UART_FillTxFifo();
     }
+    else
+#endif
+    {
+        while((Local_Counter<Copy_DataLength) && (UARTCharPutNonBlocking(Local_Base, Copy_Data[Local_Counter])==true))
+        {
+            Local_Counter++;
+        }
+    }
+    return Local_Counter;
 }
 
-void UART_ReceiveBytes(UART_t Copy_UartNum,uint8_t* Copy_Data,uint8_t Copy_DataLength)
+uint16_t UART_ReadBytes(UART_t Copy_UartNum,uint8_t* Copy_Data,uint16_t Copy_DataLength)
 {
-    uint8_t Local_Counter=0;
-    for( ;Local_Counter<Copy_DataLength;Local_Counter++)
+    uint16_t Local_Counter=0;
+    uint32_t Local_Base=UART_Config[Copy_UartNum].Base;
+#if UART_MODE!=UART_POLLING_MODE
+    if(Copy_UartNum==UART_Owner)
+    {
+        Local_Counter=RingBuffer_Read(&UART_RxRing, Copy_Data, Copy_DataLength);
+    }
+    else
+#endif
     {
-        Copy_Data[Local_Counter]=UARTCharGet((UART0_BASE+Copy_UartNum));
+        if((UART_PendingNum==Copy_UartNum) && (UART_PendingByte>=0) && (Copy_DataLength!=0U))
+        {
+            Copy_Data[0]=(uint8_t)UART_PendingByte;
+            UART_PendingByte=-1;
+            Local_Counter=1U;
+        }
+        while((Local_Counter<Copy_DataLength) && (UARTCharsAvail(Local_Base)==true))
+        {
+            Copy_Data[Local_Counter]=(uint8_t)UARTCharGetNonBlocking(Local_Base);
+            Local_Counter++;
+        }
     }
+    return Local_Counter;
 }
 
+uint16_t UART_BytesAvailable(UART_t Copy_UartNum)
+{
+    uint16_t Local_Count=0;
+#if UART_MODE!=UART_POLLING_MODE
+    if(Copy_UartNum==UART_Owner)
+    {
+        Local_Count=RingBuffer_Count(&UART_RxRing);
+    }
+    else
+#endif
+    {
+        Local_Count=((UART_PendingNum==Copy_UartNum) && (UART_PendingByte>=0)) ? 1U : 0U;
+        if(UARTCharsAvail(UART_Config[Copy_UartNum].Base)==true)
+        {
+            Local_Count++;
+        }
+    }
+    return Local_Count;
+}
+
+void UART_StartReceive(UART_t Copy_UartNum,uint8_t* Copy_Data,uint16_t Copy_DataLength)
+{
+#if UART_MODE==UART_DMA_MODE
+    uint16_t Local_Copied=0;
+    uint32_t Local_Base=UART_Config[Copy_UartNum].Base;
+    uint32_t Local_Interrupt=UART_Config[Copy_UartNum].Interrupt;
+    /*Stop the ISR from feeding the ring so its content and the FIFO can be split between CPU and DMA*/
+    IntDisable(Local_Interrupt);
+    UARTIntDisable(Local_Base, UART_INT_RX | UART_INT_RT);
+    Local_Copied=RingBuffer_Read(&UART_RxRing, Copy_Data, Copy_DataLength);
+    UART_RxDest=&Copy_Data[Local_Copied];
+    UART_RxRemaining=Copy_DataLength-Local_Copied;
+    if(UART_RxRemaining!=0U)
+    {
+        UART_RxDmaActive=true;
+        UART_ArmRxDma();
+        UARTDMAEnable(Local_Base, UART_DMA_RX);
+    }
+    else
+    {
+        /*Nothing left for DMA, keep filling the ring*/
+        UARTIntEnable(Local_Base, UART_INT_RX | UART_INT_RT);
+    }
+    IntEnable(Local_Interrupt);
+#else
+    UART_RxDest=Copy_Data;
+    UART_RxRemaining=Copy_DataLength;
+#endif
+}
+
+bool UART_IsReceiveComplete(UART_t Copy_UartNum)
+{
+    uint16_t Local_Received=0;
+#if UART_MODE==UART_DMA_MODE
+    if(UART_RxDmaActive==true)
+    {
+        /*Cleared by the UART ISR on the DMA completion interrupt*/
+        return false;
+    }
+#endif
+    if(UART_RxRemaining!=0U)
+    {
+        Local_Received=UART_ReadBytes(Copy_UartNum, UART_RxDest, UART_RxRemaining);
+        UART_RxDest+=Local_Received;
+        UART_RxRemaining-=Local_Received;
+    }
+    return (UART_RxRemaining==0U);
+}
+
+void UART_Flush(UART_t Copy_UartNum)
+{
+#if UART_MODE!=UART_POLLING_MODE
+    while((Copy_UartNum==UART_Owner) && (RingBuffer_Count(&UART_TxRing)!=0U))
+    {
+        /*Drained by the TX interrupt*/
+    }
+#endif
+    while(UARTBusy(UART_Config[Copy_UartNum].Base)==true)
+    {
+        /*Last byte still in the shift register*/
+    }
+}
+
+bool UART_SetBaudRate(UART_t Copy_UartNum,uint32_t Copy_Baud)
+{
+    bool Local_State=false;
+    UARTBAUD_Divisor_t Local_Divisor;
+    if(UARTBAUD_Calculate(SysCtlClockGet(), Copy_Baud, &Local_Divisor)==true)
+    {
+        Local_State=true;
+        UART_Flush(Copy_UartNum);
+        UART_BaudRate[Copy_UartNum]=Copy_Baud;
+        /*Disables the UART, selects HSE and the divisor the same way UARTBAUD_Calculate did, enables it again*/
+        UARTConfigSetExpClk(UART_Config[Copy_UartNum].Base, SysCtlClockGet(), UART_BaudRate[Copy_UartNum],UART_CONFIG_PAR_NONE | UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE);
+    }
+    return Local_State;
+}
+
+uint32_t UART_GetBaudRate(UART_t Copy_UartNum)
+{
+    return UART_BaudRate[Copy_UartNum];
+}
+
+void UART_Close(UART_t Copy_UartNum)
+{
+    const UART_Config_t* Local_Config=&UART_Config[Copy_UartNum];
+    UART_Flush(Copy_UartNum);
+    IntDisable(Local_Config->Interrupt);
+    if(Copy_UartNum==UART_Owner)
+    {
+#if UART_MODE==UART_DMA_MODE
+        UARTDMA_DeInit();
+#endif
+        UART_Owner=UART_NO_OWNER;
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+    /*Registers and pins as after reset, PD7 locked again*/
+    SysCtlPeripheralReset(Local_Config->Peripheral);
+    SysCtlPeripheralDisable(Local_Config->Peripheral);
+    SysCtlPeripheralReset(Local_Config->GpioPeripheral);
+    SysCtlPeripheralDisable(Local_Config->GpioPeripheral);
+    UART_BaudRate[Copy_UartNum]=0U;
+}
+
+void UART_IntHandler(void)
+{
+#if UART_MODE!=UART_POLLING_MODE
+    uint32_t Local_Base=0U;
+    uint32_t Local_Status=0U;
+    /*A source left pending by UART_Close fires with nobody to serve it*/
+    if(UART_Owner!=UART_NO_OWNER)
+    {
+        Local_Base=UART_Config[UART_Owner].Base;
+        Local_Status=UARTIntStatus(Local_Base, true);
+        UARTIntClear(Local_Base, Local_Status);
+#if UART_MODE==UART_DMA_MODE
+        if(UART_RxDmaActive==true)
+        {
+            if(UARTDMA_IsDone()==true)
+            {
+                UART_RxDest+=UART_RxDmaChunk;
+                UART_RxRemaining-=UART_RxDmaChunk;
+                if(UART_RxRemaining!=0U)
+                {
+                    /*The FIFO holds the bytes arriving while the next chunk is armed*/
+                    UART_ArmRxDma();
+                }
+                else
+                {
+                    /*Packet body is in memory, hand the RX FIFO back to the ring*/
+                    UARTDMADisable(Local_Base, UART_DMA_RX);
+                    UART_RxDmaActive=false;
+                    UARTIntEnable(Local_Base, UART_INT_RX | UART_INT_RT);
+                }
+            }
+        }
+        else
+#endif
+        {
+            /*Drain the RX FIFO, bytes are dropped if the main loop let the ring overflow*/
+            while(UARTCharsAvail(Local_Base)==true)
+            {
+                RingBuffer_Put(&UART_RxRing, (uint8_t)UARTCharGetNonBlocking(Local_Base));
+            }
+        }
+        if(Local_Status & UART_INT_TX)
+        {
+            UART_FillTxFifo();
+        }
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
+#endif
+}
@@ -14,10 +14,33 @@
 #include "inc/hw_memmap.h"
 #include "inc/hw_types.h"
 #include "inc/hw_gpio.h"
+#include "inc/hw_uart.h"
 #include "driverlib/sysctl.h"
 #include "driverlib/gpio.h"
 #include "driverlib/pin_map.h"
 #include "driverlib/uart.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/udma.h"
+#include "RingBuffer.h"
+#include "UartDma.h"
+#include "UartBaud.h"
+
+#define UART_POLLING_MODE       0x01
+#define UART_INTERRUPT_MODE     0x02
+#define UART_DMA_MODE           0x03
+
+/* Set the UART Mode
+ * UART_POLLING_MODE   : Every byte is moved by the CPU with UARTCharGet/UARTCharPut
+ * UART_INTERRUPT_MODE : UART0 ISR fills the receive ring and drains the transmit ring
+ * UART_DMA_MODE       : As interrupt mode, but UART_StartReceive hands the packet body to uDMA */
+#define UART_MODE               UART_DMA_MODE
+
+/* Rate used after reset, BL_SET_BAUD can switch to another one at run time */
+#define UART_DEFAULT_BAUD       115200U
+
+/* Ring sizes, must be powers of two */
+#define UART_RX_BUFFER_SIZE     1024U
+#define UART_TX_BUFFER_SIZE     256U
 
 typedef enum
 {
@@ -31,10 +54,66 @@ typedef enum
     UART_7
 }UART_t;
 
+#define UART_NUM                8U
+/* No UART owns the rings and the interrupt path yet */
+#define UART_NO_OWNER           0xFFU
+
+/* Pins and resources of one UART, the receive pin is pulled up so an unconnected line stays idle */
+typedef struct
+{
+    uint32_t Base;
+    uint32_t Peripheral;
+    uint32_t GpioPeripheral;
+    uint32_t GpioBase;
+    uint8_t RxPin;
+    uint8_t TxPin;
+    uint32_t RxPinConfig;
+    uint32_t TxPinConfig;
+    uint32_t Interrupt;
+    uint32_t DmaChannel;        /* uDMA channel assignment of the receive request */
+}UART_Config_t;
+
+/* UART_Open + UART_Attach */
 void UART_Init(UART_t Copy_UartNum);
 
-void UART_SendBytes(UART_t Copy_UartNum,uint8_t* Copy_Data,uint8_t Copy_DataLength);
+/* Clocks, pins and default rate, the UART is polled until it is attached */
+void UART_Open(UART_t Copy_UartNum);
+
+/* Give the rings and the interrupt (uDMA) path to an open UART, the bytes it already received are kept,
+ * one UART owns them at a time, the other open UARTs stay polled */
+void UART_Attach(UART_t Copy_UartNum);
+
+/* Polled check of an open UART for a byte without framing or break error, the byte is handed over on attach */
+bool UART_IsHostActive(UART_t Copy_UartNum);
+
+void UART_SendBytes(UART_t Copy_UartNum,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+void UART_ReceiveBytes(UART_t Copy_UartNum,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+/* Non blocking API, return the number of bytes actually queued / copied */
+uint16_t UART_WriteBytes(UART_t Copy_UartNum,const uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+uint16_t UART_ReadBytes(UART_t Copy_UartNum,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+uint16_t UART_BytesAvailable(UART_t Copy_UartNum);
+
+/* Asynchronous receive of exactly Copy_DataLength bytes, poll UART_IsReceiveComplete until it returns true */
+void UART_StartReceive(UART_t Copy_UartNum,uint8_t* Copy_Data,uint16_t Copy_DataLength);
+
+bool UART_IsReceiveComplete(UART_t Copy_UartNum);
+
+/* Wait until every queued byte has left the shift register */
+void UART_Flush(UART_t Copy_UartNum);
+
+/* Flush and switch to Copy_Baud, returns false (rate unchanged) if the UART clock can't generate it */
+bool UART_SetBaudRate(UART_t Copy_UartNum,uint32_t Copy_Baud);
+
+uint32_t UART_GetBaudRate(UART_t Copy_UartNum);
+
+/* Flush, then reset and gate the UART and its pin port, the interrupt is left disabled */
+void UART_Close(UART_t Copy_UartNum);
 
-void UART_ReceiveBytes(UART_t Copy_UartNum,uint8_t* Copy_Data,uint8_t Copy_DataLength);
+/* Vector of every UART, only the attached one has its interrupt enabled */
+void UART_IntHandler(void);
 
 #endif /* UART_H_ */
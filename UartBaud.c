@@ -0,0 +1,81 @@
+/*
+ * UartBaud.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ */
+#include "UartBaud.h"
+
+bool UARTBAUD_Calculate(uint32_t Copy_Clock,uint32_t Copy_Baud,UARTBAUD_Divisor_t* Copy_Divisor)
+{
+    bool Local_State=false;
+    uint32_t Local_Baud=Copy_Baud;
+    uint32_t Local_Diff=0;
+    if((Copy_Baud!=0U) && ((uint64_t)Copy_Baud*8U<=Copy_Clock))
+    {
+        /*Above Clock/16 the UART has to oversample by 8, which doubles the divisor resolution needed*/
+        Copy_Divisor->HighSpeed=((uint64_t)Copy_Baud*16U>Copy_Clock);
+        if(Copy_Divisor->HighSpeed==true)
+        {
+            Local_Baud/=2U;
+        }
+        Copy_Divisor->Divisor=(uint32_t)(((((uint64_t)Copy_Clock*8U)/Local_Baud)+1U)/2U);
+        /*IBRD is 16 bits wide and must not be 0*/
+        if(((Copy_Divisor->Divisor>>6)!=0U) && ((Copy_Divisor->Divisor>>6)<=0xFFFFU))
+        {
+            Copy_Divisor->ActualBaud=(uint32_t)(((uint64_t)Copy_Clock*4U)/Copy_Divisor->Divisor);
+            if(Copy_Divisor->HighSpeed==true)
+            {
+                Copy_Divisor->ActualBaud*=2U;
+            }
+            Local_Diff=(Copy_Divisor->ActualBaud>Copy_Baud) ? (Copy_Divisor->ActualBaud-Copy_Baud) : (Copy_Baud-Copy_Divisor->ActualBaud);
+            Copy_Divisor->ErrorPpm=(uint32_t)(((uint64_t)Local_Diff*1000000U)/Copy_Baud);
+            Local_State=(Copy_Divisor->ErrorPpm<=UARTBAUD_MAX_ERROR_PPM);
+        }
+    }
+    return Local_State;
+}
+
+void UARTBAUD_Start(UARTBAUD_Session_t* Copy_Session,uint32_t Copy_OldBaud,uint32_t Copy_NewBaud,uint32_t Copy_TimeoutTicks)
+{
+    Copy_Session->State=UARTBAUD_WAIT_PING;
+    Copy_Session->OldBaud=Copy_OldBaud;
+    Copy_Session->NewBaud=Copy_NewBaud;
+    Copy_Session->TicksLeft=Copy_TimeoutTicks;
+}
+
+UARTBAUD_State_t UARTBAUD_OnByte(UARTBAUD_Session_t* Copy_Session,uint8_t Copy_Data)
+{
+    /*Anything else is noise of the switch over and is dropped*/
+    if((Copy_Session->State==UARTBAUD_WAIT_PING) && (Copy_Data==UARTBAUD_PING))
+    {
+        Copy_Session->State=UARTBAUD_CONFIRMED;
+    }
+    return Copy_Session->State;
+}
+
+UARTBAUD_State_t UARTBAUD_OnTick(UARTBAUD_Session_t* Copy_Session)
+{
+    if(Copy_Session->State==UARTBAUD_WAIT_PING)
+    {
+        if(Copy_Session->TicksLeft!=0U)
+        {
+            Copy_Session->TicksLeft--;
+        }
+        if(Copy_Session->TicksLeft==0U)
+        {
+            Copy_Session->State=UARTBAUD_FALLBACK;
+        }
+    }
+    return Copy_Session->State;
+}
+
+uint32_t UARTBAUD_ActiveBaud(const UARTBAUD_Session_t* Copy_Session)
+{
+    uint32_t Local_Baud=Copy_Session->OldBaud;
+    if((Copy_Session->State==UARTBAUD_WAIT_PING) || (Copy_Session->State==UARTBAUD_CONFIRMED))
+    {
+        Local_Baud=Copy_Session->NewBaud;
+    }
+    return Local_Baud;
+}
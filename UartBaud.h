@@ -0,0 +1,62 @@
+/*
+ * UartBaud.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  Baud rate divisor computation and the switch / ping / fallback state machine of the
+ *  baud rate negotiation. Nothing here touches the hardware, the caller feeds the received
+ *  bytes and the millisecond ticks, so the logic runs unchanged against a host side stand-in.
+ */
+
+#ifndef UARTBAUD_H_
+#define UARTBAUD_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Rates above what the divisor can reproduce within this error are refused (parts per million) */
+#define UARTBAUD_MAX_ERROR_PPM  10000U
+
+/* Sent by the host at the new rate, answered by the target once the new rate is confirmed */
+#define UARTBAUD_PING           0xA5
+#define UARTBAUD_PONG           0x5A
+
+typedef struct
+{
+    uint32_t Divisor;       /* 16.6 fixed point, IBRD = Divisor>>6, FBRD = Divisor&0x3F */
+    bool HighSpeed;         /* HSE: 8x instead of 16x oversampling */
+    uint32_t ActualBaud;
+    uint32_t ErrorPpm;
+}UARTBAUD_Divisor_t;
+
+typedef enum
+{
+    UARTBAUD_IDLE=0,
+    UARTBAUD_WAIT_PING,
+    UARTBAUD_CONFIRMED,
+    UARTBAUD_FALLBACK
+}UARTBAUD_State_t;
+
+typedef struct
+{
+    UARTBAUD_State_t State;
+    uint32_t OldBaud;
+    uint32_t NewBaud;
+    uint32_t TicksLeft;
+}UARTBAUD_Session_t;
+
+/* Same rounding as UARTConfigSetExpClk, returns false if the rate can't be generated from Copy_Clock */
+bool UARTBAUD_Calculate(uint32_t Copy_Clock,uint32_t Copy_Baud,UARTBAUD_Divisor_t* Copy_Divisor);
+
+/* The caller has just switched to Copy_NewBaud and waits Copy_TimeoutTicks for the ping */
+void UARTBAUD_Start(UARTBAUD_Session_t* Copy_Session,uint32_t Copy_OldBaud,uint32_t Copy_NewBaud,uint32_t Copy_TimeoutTicks);
+
+UARTBAUD_State_t UARTBAUD_OnByte(UARTBAUD_Session_t* Copy_Session,uint8_t Copy_Data);
+
+UARTBAUD_State_t UARTBAUD_OnTick(UARTBAUD_Session_t* Copy_Session);
+
+/* The rate the link has to run at in the current state */
+uint32_t UARTBAUD_ActiveBaud(const UARTBAUD_Session_t* Copy_Session);
+
+#endif /* UARTBAUD_H_ */
@@ -0,0 +1,62 @@
+/*
+ * UartDma.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ */
+#include "UartDma.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "inc/hw_uart.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/udma.h"
+
+/*Only the primary structures are used (basic mode) but the table base must be 1024 aligned*/
+#if defined(ccs)
+#pragma DATA_ALIGN(UARTDMA_ControlTable, 1024)
+static uint8_t UARTDMA_ControlTable[512];
+#else
+static uint8_t UARTDMA_ControlTable[512] __attribute__((aligned(1024)));
+#endif
+
+static uint32_t UARTDMA_Channel=0U;
+static uint32_t UARTDMA_DataRegister=0U;
+
+void UARTDMA_Init(uint32_t Copy_UartBase,uint32_t Copy_Channel)
+{
+    /*The channel number is the low byte of the assignment, the peripheral mapping is above it*/
+    UARTDMA_Channel=Copy_Channel & 0xFFU;
+    UARTDMA_DataRegister=Copy_UartBase + UART_O_DR;
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    uDMAEnable();
+    uDMAControlBaseSet(UARTDMA_ControlTable);
+    uDMAChannelAssign(Copy_Channel);
+    uDMAChannelAttributeDisable(UARTDMA_Channel, UDMA_ATTR_ALTSELECT | UDMA_ATTR_USEBURST | UDMA_ATTR_HIGH_PRIORITY | UDMA_ATTR_REQMASK);
+    /*Byte wide reads from the fixed data register into an incrementing buffer*/
+    uDMAChannelControlSet(UARTDMA_Channel | UDMA_PRI_SELECT, UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 | UDMA_ARB_4);
+}
+
+void UARTDMA_Arm(uint8_t* Copy_Dest,uint16_t Copy_Length)
+{
+    uDMAChannelTransferSet(UARTDMA_Channel | UDMA_PRI_SELECT, UDMA_MODE_BASIC, (void*)(uintptr_t)UARTDMA_DataRegister, Copy_Dest, Copy_Length);
+    uDMAChannelEnable(UARTDMA_Channel);
+}
+
+bool UARTDMA_IsDone(void)
+{
+    bool Local_State=false;
+    /*The controller disables the channel once the basic transfer completes*/
+    if(uDMAChannelIsEnabled(UARTDMA_Channel)==false)
+    {
+        uDMAIntClear(1UL << UARTDMA_Channel);
+        Local_State=true;
+    }
+    return Local_State;
+}
+
+void UARTDMA_DeInit(void)
+{
+    uDMAChannelDisable(UARTDMA_Channel);
+    SysCtlPeripheralReset(SYSCTL_PERIPH_UDMA);
+    SysCtlPeripheralDisable(SYSCTL_PERIPH_UDMA);
+}
@@ -0,0 +1,31 @@
+/*
+ * UartDma.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mahmoud Badr
+ *
+ *  DMA engine used by Uart.c to move a packet body from the RX FIFO of the attached UART to memory.
+ *  Uart.c only depends on these four functions, so another engine can be linked instead of the
+ *  uDMA one for off-target runs, Sim/Test/FakeUartDma.c copies from a scripted byte stream.
+ */
+
+#ifndef UARTDMA_H_
+#define UARTDMA_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Maximum number of bytes in one uDMA basic transfer */
+#define UARTDMA_MAX_TRANSFER    1024U
+
+/* Copy_Channel: uDMA channel assignment of the UART receive request (UDMA_CHn_UARTxRX) */
+void UARTDMA_Init(uint32_t Copy_UartBase,uint32_t Copy_Channel);
+
+void UARTDMA_Arm(uint8_t* Copy_Dest,uint16_t Copy_Length);
+
+bool UARTDMA_IsDone(void);
+
+/* Stop the channel, the uDMA controller is reset and gated */
+void UARTDMA_DeInit(void);
+
+#endif /* UARTDMA_H_ */
@@ -5,11 +5,20 @@
 #include "driverlib/sysctl.h"
 #include "driverlib/gpio.h"
 #include "driverlib/uart.h"
-#include "Uart.h"
+#include "Transport.h"
 #include "Bootloader/Bootloader.h"
+#include "Bootloader/Prof.h"
+#include "Bootloader/Boot.h"
+#include "Bootloader/Clock.h"
 int main(void)
 {
-    UART_Init(UART_0);
+    /*Cycle counter of the profiling, nothing when it is compiled out*/
+    PROF_INIT();
+    /*PLL before anything else, the UART divisors and every delay are calculated from the clock*/
+    CLOCK_Init();
+    /*Starts the valid application, returns with the interfaces open when the bootloader stays.
+     *The bootloader attaches to the first interface the host talks on*/
+    BOOT_Decide();
     while(1)
     {
         BL_FetchHostCommand();
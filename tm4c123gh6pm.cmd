@@ -10,8 +10,10 @@
 
 MEMORY
 {
-    FLASH (RX) : origin = 0x00000000, length = 0x00040000
-    SRAM (RWX) : origin = 0x20000000, length = 0x00008000
+    /* BL_FLASH_BOOT_SECTORS of Bootloader/Bootloader.h, the sectors above are erased by the mass erase */
+    FLASH (RX) : origin = 0x00000000, length = 0x00008000
+    /* The last 0x40 bytes are BOOT_SHARED_ADDRESS of Bootloader/Boot.h, shared with the application */
+    SRAM (RWX) : origin = 0x20000000, length = 0x00007FC0
 }
 
 /* The following command line options are set as part of the CCS project.    */
@@ -54,7 +54,9 @@ extern uint32_t __STACK_TOP;
 // External declarations for the interrupt handlers used by the application.
 //
 //*****************************************************************************
-// To be added by user
+extern void UART_IntHandler(void);
+extern void CAN0_IntHandler(void);
+extern void CAN_SysTickHandler(void);
 
 //*****************************************************************************
 //
@@ -82,14 +84,14 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // Debug monitor handler
     0,                                      // Reserved
     IntDefaultHandler,                      // The PendSV handler
-    IntDefaultHandler,                      // The SysTick handler
+    CAN_SysTickHandler,                     // The SysTick handler
     IntDefaultHandler,                      // GPIO Port A
     IntDefaultHandler,                      // GPIO Port B
     IntDefaultHandler,                      // GPIO Port C
     IntDefaultHandler,                      // GPIO Port D
     IntDefaultHandler,                      // GPIO Port E
-    IntDefaultHandler,                      // UART0 Rx and Tx
-    IntDefaultHandler,                      // UART1 Rx and Tx
+    UART_IntHandler,                        // UART0 Rx and Tx
+    UART_IntHandler,                        // UART1 Rx and Tx
     IntDefaultHandler,                      // SSI0 Rx and Tx
     IntDefaultHandler,                      // I2C0 Master and Slave
     IntDefaultHandler,                      // PWM Fault
@@ -116,13 +118,13 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // GPIO Port F
     IntDefaultHandler,                      // GPIO Port G
     IntDefaultHandler,                      // GPIO Port H
-    IntDefaultHandler,                      // UART2 Rx and Tx
+    UART_IntHandler,                        // UART2 Rx and Tx
     IntDefaultHandler,                      // SSI1 Rx and Tx
     IntDefaultHandler,                      // Timer 3 subtimer A
     IntDefaultHandler,                      // Timer 3 subtimer B
     IntDefaultHandler,                      // I2C1 Master and Slave
     IntDefaultHandler,                      // Quadrature Encoder 1
-    IntDefaultHandler,                      // CAN0
+    CAN0_IntHandler,                        // CAN0
     IntDefaultHandler,                      // CAN1
     0,                                      // Reserved
     0,                                      // Reserved
@@ -142,11 +144,11 @@ void (* const g_pfnVectors[])(void) =
     IntDefaultHandler,                      // GPIO Port L
     IntDefaultHandler,                      // SSI2 Rx and Tx
     IntDefaultHandler,                      // SSI3 Rx and Tx
-    IntDefaultHandler,                      // UART3 Rx and Tx
-    IntDefaultHandler,                      // UART4 Rx and Tx
-    IntDefaultHandler,                      // UART5 Rx and Tx
-    IntDefaultHandler,                      // UART6 Rx and Tx
-    IntDefaultHandler,                      // UART7 Rx and Tx
+    UART_IntHandler,                        // UART3 Rx and Tx
+    UART_IntHandler,                        // UART4 Rx and Tx
+    UART_IntHandler,                        // UART5 Rx and Tx
+    UART_IntHandler,                        // UART6 Rx and Tx
+    UART_IntHandler,                        // UART7 Rx and Tx
     0,                                      // Reserved
     0,                                      // Reserved
     0,                                      // Reserved
@@ -237,6 +239,14 @@ void (* const g_pfnVectors[])(void) =
 void
 ResetISR(void)
 {
+    //
+    // Start the DWT cycle counter from 0, the bootloader reports the cycles
+    // from here to the jump to the application.
+    //
+    (*((volatile uint32_t *)0xE000EDFC)) |= 0x01000000;
+    (*((volatile uint32_t *)0xE0001004)) = 0;
+    (*((volatile uint32_t *)0xE0001000)) |= 0x00000001;
+
     //
     // Jump to the CCS C initialization routine.  This will enable the
     // floating-point unit as well, so that does not need to be done here.